@@ -8,80 +8,430 @@
 //- Static global CRC tables                                           -//
 //----------------------------------------------------------------------//
 
-/*!< CRC table used to compute a 16 bit CRC with the polynom 0x8408. */
-static const uint16_t crc16LookupTable[256] = {
-    0x0000,0x1189,0x2312,0x329B,0x4624,0x57AD,0x6536,0x74BF,0x8C48,0x9DC1,0xAF5A,0xBED3,0xCA6C,0xDBE5,0xE97E,0xF8F7,
-    0x1081,0x0108,0x3393,0x221A,0x56A5,0x472C,0x75B7,0x643E,0x9CC9,0x8D40,0xBFDB,0xAE52,0xDAED,0xCB64,0xF9FF,0xE876,
-    0x2102,0x308B,0x0210,0x1399,0x6726,0x76AF,0x4434,0x55BD,0xAD4A,0xBCC3,0x8E58,0x9FD1,0xEB6E,0xFAE7,0xC87C,0xD9F5,
-    0x3183,0x200A,0x1291,0x0318,0x77A7,0x662E,0x54B5,0x453C,0xBDCB,0xAC42,0x9ED9,0x8F50,0xFBEF,0xEA66,0xD8FD,0xC974,
-    0x4204,0x538D,0x6116,0x709F,0x0420,0x15A9,0x2732,0x36BB,0xCE4C,0xDFC5,0xED5E,0xFCD7,0x8868,0x99E1,0xAB7A,0xBAF3,
-    0x5285,0x430C,0x7197,0x601E,0x14A1,0x0528,0x37B3,0x263A,0xDECD,0xCF44,0xFDDF,0xEC56,0x98E9,0x8960,0xBBFB,0xAA72,
-    0x6306,0x728F,0x4014,0x519D,0x2522,0x34AB,0x0630,0x17B9,0xEF4E,0xFEC7,0xCC5C,0xDDD5,0xA96A,0xB8E3,0x8A78,0x9BF1,
-    0x7387,0x620E,0x5095,0x411C,0x35A3,0x242A,0x16B1,0x0738,0xFFCF,0xEE46,0xDCDD,0xCD54,0xB9EB,0xA862,0x9AF9,0x8B70,
-    0x8408,0x9581,0xA71A,0xB693,0xC22C,0xD3A5,0xE13E,0xF0B7,0x0840,0x19C9,0x2B52,0x3ADB,0x4E64,0x5FED,0x6D76,0x7CFF,
-    0x9489,0x8500,0xB79B,0xA612,0xD2AD,0xC324,0xF1BF,0xE036,0x18C1,0x0948,0x3BD3,0x2A5A,0x5EE5,0x4F6C,0x7DF7,0x6C7E,
-    0xA50A,0xB483,0x8618,0x9791,0xE32E,0xF2A7,0xC03C,0xD1B5,0x2942,0x38CB,0x0A50,0x1BD9,0x6F66,0x7EEF,0x4C74,0x5DFD,
-    0xB58B,0xA402,0x9699,0x8710,0xF3AF,0xE226,0xD0BD,0xC134,0x39C3,0x284A,0x1AD1,0x0B58,0x7FE7,0x6E6E,0x5CF5,0x4D7C,
-    0xC60C,0xD785,0xE51E,0xF497,0x8028,0x91A1,0xA33A,0xB2B3,0x4A44,0x5BCD,0x6956,0x78DF,0x0C60,0x1DE9,0x2F72,0x3EFB,
-    0xD68D,0xC704,0xF59F,0xE416,0x90A9,0x8120,0xB3BB,0xA232,0x5AC5,0x4B4C,0x79D7,0x685E,0x1CE1,0x0D68,0x3FF3,0x2E7A,
-    0xE70E,0xF687,0xC41C,0xD595,0xA12A,0xB0A3,0x8238,0x93B1,0x6B46,0x7ACF,0x4854,0x59DD,0x2D62,0x3CEB,0x0E70,0x1FF9,
-    0xF78F,0xE606,0xD49D,0xC514,0xB1AB,0xA022,0x92B9,0x8330,0x7BC7,0x6A4E,0x58D5,0x495C,0x3DE3,0x2C6A,0x1EF1,0x0F78};
-
-/*!< CRC table used to compute an Ethernet 32 bit CRC using the normal polynom 0x04C11DB7. */
-static const uint32_t crc32EthernetTable[256] =
+/*!< CRC tables used to compute a 16 bit CRC with the polynom 0x8408, the first table is the standard byte-wise one and the others are used to process 8 bytes per iteration. */
+static const uint16_t crc16LookupTable[8][256] =
 {
-  0x00000000,
-  0x04c11db7, 0x09823b6e, 0x0d4326d9, 0x130476dc, 0x17c56b6b,
-  0x1a864db2, 0x1e475005, 0x2608edb8, 0x22c9f00f, 0x2f8ad6d6,
-  0x2b4bcb61, 0x350c9b64, 0x31cd86d3, 0x3c8ea00a, 0x384fbdbd,
-  0x4c11db70, 0x48d0c6c7, 0x4593e01e, 0x4152fda9, 0x5f15adac,
-  0x5bd4b01b, 0x569796c2, 0x52568b75, 0x6a1936c8, 0x6ed82b7f,
-  0x639b0da6, 0x675a1011, 0x791d4014, 0x7ddc5da3, 0x709f7b7a,
-  0x745e66cd, 0x9823b6e0, 0x9ce2ab57, 0x91a18d8e, 0x95609039,
-  0x8b27c03c, 0x8fe6dd8b, 0x82a5fb52, 0x8664e6e5, 0xbe2b5b58,
-  0xbaea46ef, 0xb7a96036, 0xb3687d81, 0xad2f2d84, 0xa9ee3033,
-  0xa4ad16ea, 0xa06c0b5d, 0xd4326d90, 0xd0f37027, 0xddb056fe,
-  0xd9714b49, 0xc7361b4c, 0xc3f706fb, 0xceb42022, 0xca753d95,
-  0xf23a8028, 0xf6fb9d9f, 0xfbb8bb46, 0xff79a6f1, 0xe13ef6f4,
-  0xe5ffeb43, 0xe8bccd9a, 0xec7dd02d, 0x34867077, 0x30476dc0,
-  0x3d044b19, 0x39c556ae, 0x278206ab, 0x23431b1c, 0x2e003dc5,
-  0x2ac12072, 0x128e9dcf, 0x164f8078, 0x1b0ca6a1, 0x1fcdbb16,
-  0x018aeb13, 0x054bf6a4, 0x0808d07d, 0x0cc9cdca, 0x7897ab07,
-  0x7c56b6b0, 0x71159069, 0x75d48dde, 0x6b93dddb, 0x6f52c06c,
-  0x6211e6b5, 0x66d0fb02, 0x5e9f46bf, 0x5a5e5b08, 0x571d7dd1,
-  0x53dc6066, 0x4d9b3063, 0x495a2dd4, 0x44190b0d, 0x40d816ba,
-  0xaca5c697, 0xa864db20, 0xa527fdf9, 0xa1e6e04e, 0xbfa1b04b,
-  0xbb60adfc, 0xb6238b25, 0xb2e29692, 0x8aad2b2f, 0x8e6c3698,
-  0x832f1041, 0x87ee0df6, 0x99a95df3, 0x9d684044, 0x902b669d,
-  0x94ea7b2a, 0xe0b41de7, 0xe4750050, 0xe9362689, 0xedf73b3e,
-  0xf3b06b3b, 0xf771768c, 0xfa325055, 0xfef34de2, 0xc6bcf05f,
-  0xc27dede8, 0xcf3ecb31, 0xcbffd686, 0xd5b88683, 0xd1799b34,
-  0xdc3abded, 0xd8fba05a, 0x690ce0ee, 0x6dcdfd59, 0x608edb80,
-  0x644fc637, 0x7a089632, 0x7ec98b85, 0x738aad5c, 0x774bb0eb,
-  0x4f040d56, 0x4bc510e1, 0x46863638, 0x42472b8f, 0x5c007b8a,
-  0x58c1663d, 0x558240e4, 0x51435d53, 0x251d3b9e, 0x21dc2629,
-  0x2c9f00f0, 0x285e1d47, 0x36194d42, 0x32d850f5, 0x3f9b762c,
-  0x3b5a6b9b, 0x0315d626, 0x07d4cb91, 0x0a97ed48, 0x0e56f0ff,
-  0x1011a0fa, 0x14d0bd4d, 0x19939b94, 0x1d528623, 0xf12f560e,
-  0xf5ee4bb9, 0xf8ad6d60, 0xfc6c70d7, 0xe22b20d2, 0xe6ea3d65,
-  0xeba91bbc, 0xef68060b, 0xd727bbb6, 0xd3e6a601, 0xdea580d8,
-  0xda649d6f, 0xc423cd6a, 0xc0e2d0dd, 0xcda1f604, 0xc960ebb3,
-  0xbd3e8d7e, 0xb9ff90c9, 0xb4bcb610, 0xb07daba7, 0xae3afba2,
-  0xaafbe615, 0xa7b8c0cc, 0xa379dd7b, 0x9b3660c6, 0x9ff77d71,
-  0x92b45ba8, 0x9675461f, 0x8832161a, 0x8cf30bad, 0x81b02d74,
-  0x857130c3, 0x5d8a9099, 0x594b8d2e, 0x5408abf7, 0x50c9b640,
-  0x4e8ee645, 0x4a4ffbf2, 0x470cdd2b, 0x43cdc09c, 0x7b827d21,
-  0x7f436096, 0x7200464f, 0x76c15bf8, 0x68860bfd, 0x6c47164a,
-  0x61043093, 0x65c52d24, 0x119b4be9, 0x155a565e, 0x18197087,
-  0x1cd86d30, 0x029f3d35, 0x065e2082, 0x0b1d065b, 0x0fdc1bec,
-  0x3793a651, 0x3352bbe6, 0x3e119d3f, 0x3ad08088, 0x2497d08d,
-  0x2056cd3a, 0x2d15ebe3, 0x29d4f654, 0xc5a92679, 0xc1683bce,
-  0xcc2b1d17, 0xc8ea00a0, 0xd6ad50a5, 0xd26c4d12, 0xdf2f6bcb,
-  0xdbee767c, 0xe3a1cbc1, 0xe760d676, 0xea23f0af, 0xeee2ed18,
-  0xf0a5bd1d, 0xf464a0aa, 0xf9278673, 0xfde69bc4, 0x89b8fd09,
-  0x8d79e0be, 0x803ac667, 0x84fbdbd0, 0x9abc8bd5, 0x9e7d9662,
-  0x933eb0bb, 0x97ffad0c, 0xafb010b1, 0xab710d06, 0xa6322bdf,
-  0xa2f33668, 0xbcb4666d, 0xb8757bda, 0xb5365d03, 0xb1f740b4
+    {
+        0x0000,0x1189,0x2312,0x329B,0x4624,0x57AD,0x6536,0x74BF,0x8C48,0x9DC1,0xAF5A,0xBED3,0xCA6C,0xDBE5,0xE97E,0xF8F7,
+        0x1081,0x0108,0x3393,0x221A,0x56A5,0x472C,0x75B7,0x643E,0x9CC9,0x8D40,0xBFDB,0xAE52,0xDAED,0xCB64,0xF9FF,0xE876,
+        0x2102,0x308B,0x0210,0x1399,0x6726,0x76AF,0x4434,0x55BD,0xAD4A,0xBCC3,0x8E58,0x9FD1,0xEB6E,0xFAE7,0xC87C,0xD9F5,
+        0x3183,0x200A,0x1291,0x0318,0x77A7,0x662E,0x54B5,0x453C,0xBDCB,0xAC42,0x9ED9,0x8F50,0xFBEF,0xEA66,0xD8FD,0xC974,
+        0x4204,0x538D,0x6116,0x709F,0x0420,0x15A9,0x2732,0x36BB,0xCE4C,0xDFC5,0xED5E,0xFCD7,0x8868,0x99E1,0xAB7A,0xBAF3,
+        0x5285,0x430C,0x7197,0x601E,0x14A1,0x0528,0x37B3,0x263A,0xDECD,0xCF44,0xFDDF,0xEC56,0x98E9,0x8960,0xBBFB,0xAA72,
+        0x6306,0x728F,0x4014,0x519D,0x2522,0x34AB,0x0630,0x17B9,0xEF4E,0xFEC7,0xCC5C,0xDDD5,0xA96A,0xB8E3,0x8A78,0x9BF1,
+        0x7387,0x620E,0x5095,0x411C,0x35A3,0x242A,0x16B1,0x0738,0xFFCF,0xEE46,0xDCDD,0xCD54,0xB9EB,0xA862,0x9AF9,0x8B70,
+        0x8408,0x9581,0xA71A,0xB693,0xC22C,0xD3A5,0xE13E,0xF0B7,0x0840,0x19C9,0x2B52,0x3ADB,0x4E64,0x5FED,0x6D76,0x7CFF,
+        0x9489,0x8500,0xB79B,0xA612,0xD2AD,0xC324,0xF1BF,0xE036,0x18C1,0x0948,0x3BD3,0x2A5A,0x5EE5,0x4F6C,0x7DF7,0x6C7E,
+        0xA50A,0xB483,0x8618,0x9791,0xE32E,0xF2A7,0xC03C,0xD1B5,0x2942,0x38CB,0x0A50,0x1BD9,0x6F66,0x7EEF,0x4C74,0x5DFD,
+        0xB58B,0xA402,0x9699,0x8710,0xF3AF,0xE226,0xD0BD,0xC134,0x39C3,0x284A,0x1AD1,0x0B58,0x7FE7,0x6E6E,0x5CF5,0x4D7C,
+        0xC60C,0xD785,0xE51E,0xF497,0x8028,0x91A1,0xA33A,0xB2B3,0x4A44,0x5BCD,0x6956,0x78DF,0x0C60,0x1DE9,0x2F72,0x3EFB,
+        0xD68D,0xC704,0xF59F,0xE416,0x90A9,0x8120,0xB3BB,0xA232,0x5AC5,0x4B4C,0x79D7,0x685E,0x1CE1,0x0D68,0x3FF3,0x2E7A,
+        0xE70E,0xF687,0xC41C,0xD595,0xA12A,0xB0A3,0x8238,0x93B1,0x6B46,0x7ACF,0x4854,0x59DD,0x2D62,0x3CEB,0x0E70,0x1FF9,
+        0xF78F,0xE606,0xD49D,0xC514,0xB1AB,0xA022,0x92B9,0x8330,0x7BC7,0x6A4E,0x58D5,0x495C,0x3DE3,0x2C6A,0x1EF1,0x0F78
+    },
+    {
+        0x0000,0x19D8,0x33B0,0x2A68,0x6760,0x7EB8,0x54D0,0x4D08,0xCEC0,0xD718,0xFD70,0xE4A8,0xA9A0,0xB078,0x9A10,0x83C8,
+        0x9591,0x8C49,0xA621,0xBFF9,0xF2F1,0xEB29,0xC141,0xD899,0x5B51,0x4289,0x68E1,0x7139,0x3C31,0x25E9,0x0F81,0x1659,
+        0x2333,0x3AEB,0x1083,0x095B,0x4453,0x5D8B,0x77E3,0x6E3B,0xEDF3,0xF42B,0xDE43,0xC79B,0x8A93,0x934B,0xB923,0xA0FB,
+        0xB6A2,0xAF7A,0x8512,0x9CCA,0xD1C2,0xC81A,0xE272,0xFBAA,0x7862,0x61BA,0x4BD2,0x520A,0x1F02,0x06DA,0x2CB2,0x356A,
+        0x4666,0x5FBE,0x75D6,0x6C0E,0x2106,0x38DE,0x12B6,0x0B6E,0x88A6,0x917E,0xBB16,0xA2CE,0xEFC6,0xF61E,0xDC76,0xC5AE,
+        0xD3F7,0xCA2F,0xE047,0xF99F,0xB497,0xAD4F,0x8727,0x9EFF,0x1D37,0x04EF,0x2E87,0x375F,0x7A57,0x638F,0x49E7,0x503F,
+        0x6555,0x7C8D,0x56E5,0x4F3D,0x0235,0x1BED,0x3185,0x285D,0xAB95,0xB24D,0x9825,0x81FD,0xCCF5,0xD52D,0xFF45,0xE69D,
+        0xF0C4,0xE91C,0xC374,0xDAAC,0x97A4,0x8E7C,0xA414,0xBDCC,0x3E04,0x27DC,0x0DB4,0x146C,0x5964,0x40BC,0x6AD4,0x730C,
+        0x8CCC,0x9514,0xBF7C,0xA6A4,0xEBAC,0xF274,0xD81C,0xC1C4,0x420C,0x5BD4,0x71BC,0x6864,0x256C,0x3CB4,0x16DC,0x0F04,
+        0x195D,0x0085,0x2AED,0x3335,0x7E3D,0x67E5,0x4D8D,0x5455,0xD79D,0xCE45,0xE42D,0xFDF5,0xB0FD,0xA925,0x834D,0x9A95,
+        0xAFFF,0xB627,0x9C4F,0x8597,0xC89F,0xD147,0xFB2F,0xE2F7,0x613F,0x78E7,0x528F,0x4B57,0x065F,0x1F87,0x35EF,0x2C37,
+        0x3A6E,0x23B6,0x09DE,0x1006,0x5D0E,0x44D6,0x6EBE,0x7766,0xF4AE,0xED76,0xC71E,0xDEC6,0x93CE,0x8A16,0xA07E,0xB9A6,
+        0xCAAA,0xD372,0xF91A,0xE0C2,0xADCA,0xB412,0x9E7A,0x87A2,0x046A,0x1DB2,0x37DA,0x2E02,0x630A,0x7AD2,0x50BA,0x4962,
+        0x5F3B,0x46E3,0x6C8B,0x7553,0x385B,0x2183,0x0BEB,0x1233,0x91FB,0x8823,0xA24B,0xBB93,0xF69B,0xEF43,0xC52B,0xDCF3,
+        0xE999,0xF041,0xDA29,0xC3F1,0x8EF9,0x9721,0xBD49,0xA491,0x2759,0x3E81,0x14E9,0x0D31,0x4039,0x59E1,0x7389,0x6A51,
+        0x7C08,0x65D0,0x4FB8,0x5660,0x1B68,0x02B0,0x28D8,0x3100,0xB2C8,0xAB10,0x8178,0x98A0,0xD5A8,0xCC70,0xE618,0xFFC0
+    },
+    {
+        0x0000,0x5ADC,0xB5B8,0xEF64,0x6361,0x39BD,0xD6D9,0x8C05,0xC6C2,0x9C1E,0x737A,0x29A6,0xA5A3,0xFF7F,0x101B,0x4AC7,
+        0x8595,0xDF49,0x302D,0x6AF1,0xE6F4,0xBC28,0x534C,0x0990,0x4357,0x198B,0xF6EF,0xAC33,0x2036,0x7AEA,0x958E,0xCF52,
+        0x033B,0x59E7,0xB683,0xEC5F,0x605A,0x3A86,0xD5E2,0x8F3E,0xC5F9,0x9F25,0x7041,0x2A9D,0xA698,0xFC44,0x1320,0x49FC,
+        0x86AE,0xDC72,0x3316,0x69CA,0xE5CF,0xBF13,0x5077,0x0AAB,0x406C,0x1AB0,0xF5D4,0xAF08,0x230D,0x79D1,0x96B5,0xCC69,
+        0x0676,0x5CAA,0xB3CE,0xE912,0x6517,0x3FCB,0xD0AF,0x8A73,0xC0B4,0x9A68,0x750C,0x2FD0,0xA3D5,0xF909,0x166D,0x4CB1,
+        0x83E3,0xD93F,0x365B,0x6C87,0xE082,0xBA5E,0x553A,0x0FE6,0x4521,0x1FFD,0xF099,0xAA45,0x2640,0x7C9C,0x93F8,0xC924,
+        0x054D,0x5F91,0xB0F5,0xEA29,0x662C,0x3CF0,0xD394,0x8948,0xC38F,0x9953,0x7637,0x2CEB,0xA0EE,0xFA32,0x1556,0x4F8A,
+        0x80D8,0xDA04,0x3560,0x6FBC,0xE3B9,0xB965,0x5601,0x0CDD,0x461A,0x1CC6,0xF3A2,0xA97E,0x257B,0x7FA7,0x90C3,0xCA1F,
+        0x0CEC,0x5630,0xB954,0xE388,0x6F8D,0x3551,0xDA35,0x80E9,0xCA2E,0x90F2,0x7F96,0x254A,0xA94F,0xF393,0x1CF7,0x462B,
+        0x8979,0xD3A5,0x3CC1,0x661D,0xEA18,0xB0C4,0x5FA0,0x057C,0x4FBB,0x1567,0xFA03,0xA0DF,0x2CDA,0x7606,0x9962,0xC3BE,
+        0x0FD7,0x550B,0xBA6F,0xE0B3,0x6CB6,0x366A,0xD90E,0x83D2,0xC915,0x93C9,0x7CAD,0x2671,0xAA74,0xF0A8,0x1FCC,0x4510,
+        0x8A42,0xD09E,0x3FFA,0x6526,0xE923,0xB3FF,0x5C9B,0x0647,0x4C80,0x165C,0xF938,0xA3E4,0x2FE1,0x753D,0x9A59,0xC085,
+        0x0A9A,0x5046,0xBF22,0xE5FE,0x69FB,0x3327,0xDC43,0x869F,0xCC58,0x9684,0x79E0,0x233C,0xAF39,0xF5E5,0x1A81,0x405D,
+        0x8F0F,0xD5D3,0x3AB7,0x606B,0xEC6E,0xB6B2,0x59D6,0x030A,0x49CD,0x1311,0xFC75,0xA6A9,0x2AAC,0x7070,0x9F14,0xC5C8,
+        0x09A1,0x537D,0xBC19,0xE6C5,0x6AC0,0x301C,0xDF78,0x85A4,0xCF63,0x95BF,0x7ADB,0x2007,0xAC02,0xF6DE,0x19BA,0x4366,
+        0x8C34,0xD6E8,0x398C,0x6350,0xEF55,0xB589,0x5AED,0x0031,0x4AF6,0x102A,0xFF4E,0xA592,0x2997,0x734B,0x9C2F,0xC6F3
+    },
+    {
+        0x0000,0x1CBB,0x3976,0x25CD,0x72EC,0x6E57,0x4B9A,0x5721,0xE5D8,0xF963,0xDCAE,0xC015,0x9734,0x8B8F,0xAE42,0xB2F9,
+        0xC3A1,0xDF1A,0xFAD7,0xE66C,0xB14D,0xADF6,0x883B,0x9480,0x2679,0x3AC2,0x1F0F,0x03B4,0x5495,0x482E,0x6DE3,0x7158,
+        0x8F53,0x93E8,0xB625,0xAA9E,0xFDBF,0xE104,0xC4C9,0xD872,0x6A8B,0x7630,0x53FD,0x4F46,0x1867,0x04DC,0x2111,0x3DAA,
+        0x4CF2,0x5049,0x7584,0x693F,0x3E1E,0x22A5,0x0768,0x1BD3,0xA92A,0xB591,0x905C,0x8CE7,0xDBC6,0xC77D,0xE2B0,0xFE0B,
+        0x16B7,0x0A0C,0x2FC1,0x337A,0x645B,0x78E0,0x5D2D,0x4196,0xF36F,0xEFD4,0xCA19,0xD6A2,0x8183,0x9D38,0xB8F5,0xA44E,
+        0xD516,0xC9AD,0xEC60,0xF0DB,0xA7FA,0xBB41,0x9E8C,0x8237,0x30CE,0x2C75,0x09B8,0x1503,0x4222,0x5E99,0x7B54,0x67EF,
+        0x99E4,0x855F,0xA092,0xBC29,0xEB08,0xF7B3,0xD27E,0xCEC5,0x7C3C,0x6087,0x454A,0x59F1,0x0ED0,0x126B,0x37A6,0x2B1D,
+        0x5A45,0x46FE,0x6333,0x7F88,0x28A9,0x3412,0x11DF,0x0D64,0xBF9D,0xA326,0x86EB,0x9A50,0xCD71,0xD1CA,0xF407,0xE8BC,
+        0x2D6E,0x31D5,0x1418,0x08A3,0x5F82,0x4339,0x66F4,0x7A4F,0xC8B6,0xD40D,0xF1C0,0xED7B,0xBA5A,0xA6E1,0x832C,0x9F97,
+        0xEECF,0xF274,0xD7B9,0xCB02,0x9C23,0x8098,0xA555,0xB9EE,0x0B17,0x17AC,0x3261,0x2EDA,0x79FB,0x6540,0x408D,0x5C36,
+        0xA23D,0xBE86,0x9B4B,0x87F0,0xD0D1,0xCC6A,0xE9A7,0xF51C,0x47E5,0x5B5E,0x7E93,0x6228,0x3509,0x29B2,0x0C7F,0x10C4,
+        0x619C,0x7D27,0x58EA,0x4451,0x1370,0x0FCB,0x2A06,0x36BD,0x8444,0x98FF,0xBD32,0xA189,0xF6A8,0xEA13,0xCFDE,0xD365,
+        0x3BD9,0x2762,0x02AF,0x1E14,0x4935,0x558E,0x7043,0x6CF8,0xDE01,0xC2BA,0xE777,0xFBCC,0xACED,0xB056,0x959B,0x8920,
+        0xF878,0xE4C3,0xC10E,0xDDB5,0x8A94,0x962F,0xB3E2,0xAF59,0x1DA0,0x011B,0x24D6,0x386D,0x6F4C,0x73F7,0x563A,0x4A81,
+        0xB48A,0xA831,0x8DFC,0x9147,0xC666,0xDADD,0xFF10,0xE3AB,0x5152,0x4DE9,0x6824,0x749F,0x23BE,0x3F05,0x1AC8,0x0673,
+        0x772B,0x6B90,0x4E5D,0x52E6,0x05C7,0x197C,0x3CB1,0x200A,0x92F3,0x8E48,0xAB85,0xB73E,0xE01F,0xFCA4,0xD969,0xC5D2
+    },
+    {
+        0x0000,0x0B44,0x1688,0x1DCC,0x2D10,0x2654,0x3B98,0x30DC,0x5A20,0x5164,0x4CA8,0x47EC,0x7730,0x7C74,0x61B8,0x6AFC,
+        0xB440,0xBF04,0xA2C8,0xA98C,0x9950,0x9214,0x8FD8,0x849C,0xEE60,0xE524,0xF8E8,0xF3AC,0xC370,0xC834,0xD5F8,0xDEBC,
+        0x6091,0x6BD5,0x7619,0x7D5D,0x4D81,0x46C5,0x5B09,0x504D,0x3AB1,0x31F5,0x2C39,0x277D,0x17A1,0x1CE5,0x0129,0x0A6D,
+        0xD4D1,0xDF95,0xC259,0xC91D,0xF9C1,0xF285,0xEF49,0xE40D,0x8EF1,0x85B5,0x9879,0x933D,0xA3E1,0xA8A5,0xB569,0xBE2D,
+        0xC122,0xCA66,0xD7AA,0xDCEE,0xEC32,0xE776,0xFABA,0xF1FE,0x9B02,0x9046,0x8D8A,0x86CE,0xB612,0xBD56,0xA09A,0xABDE,
+        0x7562,0x7E26,0x63EA,0x68AE,0x5872,0x5336,0x4EFA,0x45BE,0x2F42,0x2406,0x39CA,0x328E,0x0252,0x0916,0x14DA,0x1F9E,
+        0xA1B3,0xAAF7,0xB73B,0xBC7F,0x8CA3,0x87E7,0x9A2B,0x916F,0xFB93,0xF0D7,0xED1B,0xE65F,0xD683,0xDDC7,0xC00B,0xCB4F,
+        0x15F3,0x1EB7,0x037B,0x083F,0x38E3,0x33A7,0x2E6B,0x252F,0x4FD3,0x4497,0x595B,0x521F,0x62C3,0x6987,0x744B,0x7F0F,
+        0x8A55,0x8111,0x9CDD,0x9799,0xA745,0xAC01,0xB1CD,0xBA89,0xD075,0xDB31,0xC6FD,0xCDB9,0xFD65,0xF621,0xEBED,0xE0A9,
+        0x3E15,0x3551,0x289D,0x23D9,0x1305,0x1841,0x058D,0x0EC9,0x6435,0x6F71,0x72BD,0x79F9,0x4925,0x4261,0x5FAD,0x54E9,
+        0xEAC4,0xE180,0xFC4C,0xF708,0xC7D4,0xCC90,0xD15C,0xDA18,0xB0E4,0xBBA0,0xA66C,0xAD28,0x9DF4,0x96B0,0x8B7C,0x8038,
+        0x5E84,0x55C0,0x480C,0x4348,0x7394,0x78D0,0x651C,0x6E58,0x04A4,0x0FE0,0x122C,0x1968,0x29B4,0x22F0,0x3F3C,0x3478,
+        0x4B77,0x4033,0x5DFF,0x56BB,0x6667,0x6D23,0x70EF,0x7BAB,0x1157,0x1A13,0x07DF,0x0C9B,0x3C47,0x3703,0x2ACF,0x218B,
+        0xFF37,0xF473,0xE9BF,0xE2FB,0xD227,0xD963,0xC4AF,0xCFEB,0xA517,0xAE53,0xB39F,0xB8DB,0x8807,0x8343,0x9E8F,0x95CB,
+        0x2BE6,0x20A2,0x3D6E,0x362A,0x06F6,0x0DB2,0x107E,0x1B3A,0x71C6,0x7A82,0x674E,0x6C0A,0x5CD6,0x5792,0x4A5E,0x411A,
+        0x9FA6,0x94E2,0x892E,0x826A,0xB2B6,0xB9F2,0xA43E,0xAF7A,0xC586,0xCEC2,0xD30E,0xD84A,0xE896,0xE3D2,0xFE1E,0xF55A
+    },
+    {
+        0x0000,0x042B,0x0856,0x0C7D,0x10AC,0x1487,0x18FA,0x1CD1,0x2158,0x2573,0x290E,0x2D25,0x31F4,0x35DF,0x39A2,0x3D89,
+        0x42B0,0x469B,0x4AE6,0x4ECD,0x521C,0x5637,0x5A4A,0x5E61,0x63E8,0x67C3,0x6BBE,0x6F95,0x7344,0x776F,0x7B12,0x7F39,
+        0x8560,0x814B,0x8D36,0x891D,0x95CC,0x91E7,0x9D9A,0x99B1,0xA438,0xA013,0xAC6E,0xA845,0xB494,0xB0BF,0xBCC2,0xB8E9,
+        0xC7D0,0xC3FB,0xCF86,0xCBAD,0xD77C,0xD357,0xDF2A,0xDB01,0xE688,0xE2A3,0xEEDE,0xEAF5,0xF624,0xF20F,0xFE72,0xFA59,
+        0x02D1,0x06FA,0x0A87,0x0EAC,0x127D,0x1656,0x1A2B,0x1E00,0x2389,0x27A2,0x2BDF,0x2FF4,0x3325,0x370E,0x3B73,0x3F58,
+        0x4061,0x444A,0x4837,0x4C1C,0x50CD,0x54E6,0x589B,0x5CB0,0x6139,0x6512,0x696F,0x6D44,0x7195,0x75BE,0x79C3,0x7DE8,
+        0x87B1,0x839A,0x8FE7,0x8BCC,0x971D,0x9336,0x9F4B,0x9B60,0xA6E9,0xA2C2,0xAEBF,0xAA94,0xB645,0xB26E,0xBE13,0xBA38,
+        0xC501,0xC12A,0xCD57,0xC97C,0xD5AD,0xD186,0xDDFB,0xD9D0,0xE459,0xE072,0xEC0F,0xE824,0xF4F5,0xF0DE,0xFCA3,0xF888,
+        0x05A2,0x0189,0x0DF4,0x09DF,0x150E,0x1125,0x1D58,0x1973,0x24FA,0x20D1,0x2CAC,0x2887,0x3456,0x307D,0x3C00,0x382B,
+        0x4712,0x4339,0x4F44,0x4B6F,0x57BE,0x5395,0x5FE8,0x5BC3,0x664A,0x6261,0x6E1C,0x6A37,0x76E6,0x72CD,0x7EB0,0x7A9B,
+        0x80C2,0x84E9,0x8894,0x8CBF,0x906E,0x9445,0x9838,0x9C13,0xA19A,0xA5B1,0xA9CC,0xADE7,0xB136,0xB51D,0xB960,0xBD4B,
+        0xC272,0xC659,0xCA24,0xCE0F,0xD2DE,0xD6F5,0xDA88,0xDEA3,0xE32A,0xE701,0xEB7C,0xEF57,0xF386,0xF7AD,0xFBD0,0xFFFB,
+        0x0773,0x0358,0x0F25,0x0B0E,0x17DF,0x13F4,0x1F89,0x1BA2,0x262B,0x2200,0x2E7D,0x2A56,0x3687,0x32AC,0x3ED1,0x3AFA,
+        0x45C3,0x41E8,0x4D95,0x49BE,0x556F,0x5144,0x5D39,0x5912,0x649B,0x60B0,0x6CCD,0x68E6,0x7437,0x701C,0x7C61,0x784A,
+        0x8213,0x8638,0x8A45,0x8E6E,0x92BF,0x9694,0x9AE9,0x9EC2,0xA34B,0xA760,0xAB1D,0xAF36,0xB3E7,0xB7CC,0xBBB1,0xBF9A,
+        0xC0A3,0xC488,0xC8F5,0xCCDE,0xD00F,0xD424,0xD859,0xDC72,0xE1FB,0xE5D0,0xE9AD,0xED86,0xF157,0xF57C,0xF901,0xFD2A
+    },
+    {
+        0x0000,0x9FD5,0x37BB,0xA86E,0x6F76,0xF0A3,0x58CD,0xC718,0xDEEC,0x4139,0xE957,0x7682,0xB19A,0x2E4F,0x8621,0x19F4,
+        0xB5C9,0x2A1C,0x8272,0x1DA7,0xDABF,0x456A,0xED04,0x72D1,0x6B25,0xF4F0,0x5C9E,0xC34B,0x0453,0x9B86,0x33E8,0xAC3D,
+        0x6383,0xFC56,0x5438,0xCBED,0x0CF5,0x9320,0x3B4E,0xA49B,0xBD6F,0x22BA,0x8AD4,0x1501,0xD219,0x4DCC,0xE5A2,0x7A77,
+        0xD64A,0x499F,0xE1F1,0x7E24,0xB93C,0x26E9,0x8E87,0x1152,0x08A6,0x9773,0x3F1D,0xA0C8,0x67D0,0xF805,0x506B,0xCFBE,
+        0xC706,0x58D3,0xF0BD,0x6F68,0xA870,0x37A5,0x9FCB,0x001E,0x19EA,0x863F,0x2E51,0xB184,0x769C,0xE949,0x4127,0xDEF2,
+        0x72CF,0xED1A,0x4574,0xDAA1,0x1DB9,0x826C,0x2A02,0xB5D7,0xAC23,0x33F6,0x9B98,0x044D,0xC355,0x5C80,0xF4EE,0x6B3B,
+        0xA485,0x3B50,0x933E,0x0CEB,0xCBF3,0x5426,0xFC48,0x639D,0x7A69,0xE5BC,0x4DD2,0xD207,0x151F,0x8ACA,0x22A4,0xBD71,
+        0x114C,0x8E99,0x26F7,0xB922,0x7E3A,0xE1EF,0x4981,0xD654,0xCFA0,0x5075,0xF81B,0x67CE,0xA0D6,0x3F03,0x976D,0x08B8,
+        0x861D,0x19C8,0xB1A6,0x2E73,0xE96B,0x76BE,0xDED0,0x4105,0x58F1,0xC724,0x6F4A,0xF09F,0x3787,0xA852,0x003C,0x9FE9,
+        0x33D4,0xAC01,0x046F,0x9BBA,0x5CA2,0xC377,0x6B19,0xF4CC,0xED38,0x72ED,0xDA83,0x4556,0x824E,0x1D9B,0xB5F5,0x2A20,
+        0xE59E,0x7A4B,0xD225,0x4DF0,0x8AE8,0x153D,0xBD53,0x2286,0x3B72,0xA4A7,0x0CC9,0x931C,0x5404,0xCBD1,0x63BF,0xFC6A,
+        0x5057,0xCF82,0x67EC,0xF839,0x3F21,0xA0F4,0x089A,0x974F,0x8EBB,0x116E,0xB900,0x26D5,0xE1CD,0x7E18,0xD676,0x49A3,
+        0x411B,0xDECE,0x76A0,0xE975,0x2E6D,0xB1B8,0x19D6,0x8603,0x9FF7,0x0022,0xA84C,0x3799,0xF081,0x6F54,0xC73A,0x58EF,
+        0xF4D2,0x6B07,0xC369,0x5CBC,0x9BA4,0x0471,0xAC1F,0x33CA,0x2A3E,0xB5EB,0x1D85,0x8250,0x4548,0xDA9D,0x72F3,0xED26,
+        0x2298,0xBD4D,0x1523,0x8AF6,0x4DEE,0xD23B,0x7A55,0xE580,0xFC74,0x63A1,0xCBCF,0x541A,0x9302,0x0CD7,0xA4B9,0x3B6C,
+        0x9751,0x0884,0xA0EA,0x3F3F,0xF827,0x67F2,0xCF9C,0x5049,0x49BD,0xD668,0x7E06,0xE1D3,0x26CB,0xB91E,0x1170,0x8EA5
+    },
+    {
+        0x0000,0x81BF,0x0B6F,0x8AD0,0x16DE,0x9761,0x1DB1,0x9C0E,0x2DBC,0xAC03,0x26D3,0xA76C,0x3B62,0xBADD,0x300D,0xB1B2,
+        0x5B78,0xDAC7,0x5017,0xD1A8,0x4DA6,0xCC19,0x46C9,0xC776,0x76C4,0xF77B,0x7DAB,0xFC14,0x601A,0xE1A5,0x6B75,0xEACA,
+        0xB6F0,0x374F,0xBD9F,0x3C20,0xA02E,0x2191,0xAB41,0x2AFE,0x9B4C,0x1AF3,0x9023,0x119C,0x8D92,0x0C2D,0x86FD,0x0742,
+        0xED88,0x6C37,0xE6E7,0x6758,0xFB56,0x7AE9,0xF039,0x7186,0xC034,0x418B,0xCB5B,0x4AE4,0xD6EA,0x5755,0xDD85,0x5C3A,
+        0x65F1,0xE44E,0x6E9E,0xEF21,0x732F,0xF290,0x7840,0xF9FF,0x484D,0xC9F2,0x4322,0xC29D,0x5E93,0xDF2C,0x55FC,0xD443,
+        0x3E89,0xBF36,0x35E6,0xB459,0x2857,0xA9E8,0x2338,0xA287,0x1335,0x928A,0x185A,0x99E5,0x05EB,0x8454,0x0E84,0x8F3B,
+        0xD301,0x52BE,0xD86E,0x59D1,0xC5DF,0x4460,0xCEB0,0x4F0F,0xFEBD,0x7F02,0xF5D2,0x746D,0xE863,0x69DC,0xE30C,0x62B3,
+        0x8879,0x09C6,0x8316,0x02A9,0x9EA7,0x1F18,0x95C8,0x1477,0xA5C5,0x247A,0xAEAA,0x2F15,0xB31B,0x32A4,0xB874,0x39CB,
+        0xCBE2,0x4A5D,0xC08D,0x4132,0xDD3C,0x5C83,0xD653,0x57EC,0xE65E,0x67E1,0xED31,0x6C8E,0xF080,0x713F,0xFBEF,0x7A50,
+        0x909A,0x1125,0x9BF5,0x1A4A,0x8644,0x07FB,0x8D2B,0x0C94,0xBD26,0x3C99,0xB649,0x37F6,0xABF8,0x2A47,0xA097,0x2128,
+        0x7D12,0xFCAD,0x767D,0xF7C2,0x6BCC,0xEA73,0x60A3,0xE11C,0x50AE,0xD111,0x5BC1,0xDA7E,0x4670,0xC7CF,0x4D1F,0xCCA0,
+        0x266A,0xA7D5,0x2D05,0xACBA,0x30B4,0xB10B,0x3BDB,0xBA64,0x0BD6,0x8A69,0x00B9,0x8106,0x1D08,0x9CB7,0x1667,0x97D8,
+        0xAE13,0x2FAC,0xA57C,0x24C3,0xB8CD,0x3972,0xB3A2,0x321D,0x83AF,0x0210,0x88C0,0x097F,0x9571,0x14CE,0x9E1E,0x1FA1,
+        0xF56B,0x74D4,0xFE04,0x7FBB,0xE3B5,0x620A,0xE8DA,0x6965,0xD8D7,0x5968,0xD3B8,0x5207,0xCE09,0x4FB6,0xC566,0x44D9,
+        0x18E3,0x995C,0x138C,0x9233,0x0E3D,0x8F82,0x0552,0x84ED,0x355F,0xB4E0,0x3E30,0xBF8F,0x2381,0xA23E,0x28EE,0xA951,
+        0x439B,0xC224,0x48F4,0xC94B,0x5545,0xD4FA,0x5E2A,0xDF95,0x6E27,0xEF98,0x6548,0xE4F7,0x78F9,0xF946,0x7396,0xF229
+    }
+};
+
+/*!< CRC tables used to compute an Ethernet 32 bit CRC using the normal polynom 0x04C11DB7, the first table is the standard byte-wise one and the others are used to process 8 bytes per iteration. */
+static const uint32_t crc32EthernetTable[8][256] =
+{
+    {
+        0x00000000, 0x04c11db7, 0x09823b6e, 0x0d4326d9, 0x130476dc, 0x17c56b6b, 0x1a864db2, 0x1e475005,
+        0x2608edb8, 0x22c9f00f, 0x2f8ad6d6, 0x2b4bcb61, 0x350c9b64, 0x31cd86d3, 0x3c8ea00a, 0x384fbdbd,
+        0x4c11db70, 0x48d0c6c7, 0x4593e01e, 0x4152fda9, 0x5f15adac, 0x5bd4b01b, 0x569796c2, 0x52568b75,
+        0x6a1936c8, 0x6ed82b7f, 0x639b0da6, 0x675a1011, 0x791d4014, 0x7ddc5da3, 0x709f7b7a, 0x745e66cd,
+        0x9823b6e0, 0x9ce2ab57, 0x91a18d8e, 0x95609039, 0x8b27c03c, 0x8fe6dd8b, 0x82a5fb52, 0x8664e6e5,
+        0xbe2b5b58, 0xbaea46ef, 0xb7a96036, 0xb3687d81, 0xad2f2d84, 0xa9ee3033, 0xa4ad16ea, 0xa06c0b5d,
+        0xd4326d90, 0xd0f37027, 0xddb056fe, 0xd9714b49, 0xc7361b4c, 0xc3f706fb, 0xceb42022, 0xca753d95,
+        0xf23a8028, 0xf6fb9d9f, 0xfbb8bb46, 0xff79a6f1, 0xe13ef6f4, 0xe5ffeb43, 0xe8bccd9a, 0xec7dd02d,
+        0x34867077, 0x30476dc0, 0x3d044b19, 0x39c556ae, 0x278206ab, 0x23431b1c, 0x2e003dc5, 0x2ac12072,
+        0x128e9dcf, 0x164f8078, 0x1b0ca6a1, 0x1fcdbb16, 0x018aeb13, 0x054bf6a4, 0x0808d07d, 0x0cc9cdca,
+        0x7897ab07, 0x7c56b6b0, 0x71159069, 0x75d48dde, 0x6b93dddb, 0x6f52c06c, 0x6211e6b5, 0x66d0fb02,
+        0x5e9f46bf, 0x5a5e5b08, 0x571d7dd1, 0x53dc6066, 0x4d9b3063, 0x495a2dd4, 0x44190b0d, 0x40d816ba,
+        0xaca5c697, 0xa864db20, 0xa527fdf9, 0xa1e6e04e, 0xbfa1b04b, 0xbb60adfc, 0xb6238b25, 0xb2e29692,
+        0x8aad2b2f, 0x8e6c3698, 0x832f1041, 0x87ee0df6, 0x99a95df3, 0x9d684044, 0x902b669d, 0x94ea7b2a,
+        0xe0b41de7, 0xe4750050, 0xe9362689, 0xedf73b3e, 0xf3b06b3b, 0xf771768c, 0xfa325055, 0xfef34de2,
+        0xc6bcf05f, 0xc27dede8, 0xcf3ecb31, 0xcbffd686, 0xd5b88683, 0xd1799b34, 0xdc3abded, 0xd8fba05a,
+        0x690ce0ee, 0x6dcdfd59, 0x608edb80, 0x644fc637, 0x7a089632, 0x7ec98b85, 0x738aad5c, 0x774bb0eb,
+        0x4f040d56, 0x4bc510e1, 0x46863638, 0x42472b8f, 0x5c007b8a, 0x58c1663d, 0x558240e4, 0x51435d53,
+        0x251d3b9e, 0x21dc2629, 0x2c9f00f0, 0x285e1d47, 0x36194d42, 0x32d850f5, 0x3f9b762c, 0x3b5a6b9b,
+        0x0315d626, 0x07d4cb91, 0x0a97ed48, 0x0e56f0ff, 0x1011a0fa, 0x14d0bd4d, 0x19939b94, 0x1d528623,
+        0xf12f560e, 0xf5ee4bb9, 0xf8ad6d60, 0xfc6c70d7, 0xe22b20d2, 0xe6ea3d65, 0xeba91bbc, 0xef68060b,
+        0xd727bbb6, 0xd3e6a601, 0xdea580d8, 0xda649d6f, 0xc423cd6a, 0xc0e2d0dd, 0xcda1f604, 0xc960ebb3,
+        0xbd3e8d7e, 0xb9ff90c9, 0xb4bcb610, 0xb07daba7, 0xae3afba2, 0xaafbe615, 0xa7b8c0cc, 0xa379dd7b,
+        0x9b3660c6, 0x9ff77d71, 0x92b45ba8, 0x9675461f, 0x8832161a, 0x8cf30bad, 0x81b02d74, 0x857130c3,
+        0x5d8a9099, 0x594b8d2e, 0x5408abf7, 0x50c9b640, 0x4e8ee645, 0x4a4ffbf2, 0x470cdd2b, 0x43cdc09c,
+        0x7b827d21, 0x7f436096, 0x7200464f, 0x76c15bf8, 0x68860bfd, 0x6c47164a, 0x61043093, 0x65c52d24,
+        0x119b4be9, 0x155a565e, 0x18197087, 0x1cd86d30, 0x029f3d35, 0x065e2082, 0x0b1d065b, 0x0fdc1bec,
+        0x3793a651, 0x3352bbe6, 0x3e119d3f, 0x3ad08088, 0x2497d08d, 0x2056cd3a, 0x2d15ebe3, 0x29d4f654,
+        0xc5a92679, 0xc1683bce, 0xcc2b1d17, 0xc8ea00a0, 0xd6ad50a5, 0xd26c4d12, 0xdf2f6bcb, 0xdbee767c,
+        0xe3a1cbc1, 0xe760d676, 0xea23f0af, 0xeee2ed18, 0xf0a5bd1d, 0xf464a0aa, 0xf9278673, 0xfde69bc4,
+        0x89b8fd09, 0x8d79e0be, 0x803ac667, 0x84fbdbd0, 0x9abc8bd5, 0x9e7d9662, 0x933eb0bb, 0x97ffad0c,
+        0xafb010b1, 0xab710d06, 0xa6322bdf, 0xa2f33668, 0xbcb4666d, 0xb8757bda, 0xb5365d03, 0xb1f740b4
+    },
+    {
+        0x00000000, 0xd219c1dc, 0xa0f29e0f, 0x72eb5fd3, 0x452421a9, 0x973de075, 0xe5d6bfa6, 0x37cf7e7a,
+        0x8a484352, 0x5851828e, 0x2abadd5d, 0xf8a31c81, 0xcf6c62fb, 0x1d75a327, 0x6f9efcf4, 0xbd873d28,
+        0x10519b13, 0xc2485acf, 0xb0a3051c, 0x62bac4c0, 0x5575baba, 0x876c7b66, 0xf58724b5, 0x279ee569,
+        0x9a19d841, 0x4800199d, 0x3aeb464e, 0xe8f28792, 0xdf3df9e8, 0x0d243834, 0x7fcf67e7, 0xadd6a63b,
+        0x20a33626, 0xf2baf7fa, 0x8051a829, 0x524869f5, 0x6587178f, 0xb79ed653, 0xc5758980, 0x176c485c,
+        0xaaeb7574, 0x78f2b4a8, 0x0a19eb7b, 0xd8002aa7, 0xefcf54dd, 0x3dd69501, 0x4f3dcad2, 0x9d240b0e,
+        0x30f2ad35, 0xe2eb6ce9, 0x9000333a, 0x4219f2e6, 0x75d68c9c, 0xa7cf4d40, 0xd5241293, 0x073dd34f,
+        0xbabaee67, 0x68a32fbb, 0x1a487068, 0xc851b1b4, 0xff9ecfce, 0x2d870e12, 0x5f6c51c1, 0x8d75901d,
+        0x41466c4c, 0x935fad90, 0xe1b4f243, 0x33ad339f, 0x04624de5, 0xd67b8c39, 0xa490d3ea, 0x76891236,
+        0xcb0e2f1e, 0x1917eec2, 0x6bfcb111, 0xb9e570cd, 0x8e2a0eb7, 0x5c33cf6b, 0x2ed890b8, 0xfcc15164,
+        0x5117f75f, 0x830e3683, 0xf1e56950, 0x23fca88c, 0x1433d6f6, 0xc62a172a, 0xb4c148f9, 0x66d88925,
+        0xdb5fb40d, 0x094675d1, 0x7bad2a02, 0xa9b4ebde, 0x9e7b95a4, 0x4c625478, 0x3e890bab, 0xec90ca77,
+        0x61e55a6a, 0xb3fc9bb6, 0xc117c465, 0x130e05b9, 0x24c17bc3, 0xf6d8ba1f, 0x8433e5cc, 0x562a2410,
+        0xebad1938, 0x39b4d8e4, 0x4b5f8737, 0x994646eb, 0xae893891, 0x7c90f94d, 0x0e7ba69e, 0xdc626742,
+        0x71b4c179, 0xa3ad00a5, 0xd1465f76, 0x035f9eaa, 0x3490e0d0, 0xe689210c, 0x94627edf, 0x467bbf03,
+        0xfbfc822b, 0x29e543f7, 0x5b0e1c24, 0x8917ddf8, 0xbed8a382, 0x6cc1625e, 0x1e2a3d8d, 0xcc33fc51,
+        0x828cd898, 0x50951944, 0x227e4697, 0xf067874b, 0xc7a8f931, 0x15b138ed, 0x675a673e, 0xb543a6e2,
+        0x08c49bca, 0xdadd5a16, 0xa83605c5, 0x7a2fc419, 0x4de0ba63, 0x9ff97bbf, 0xed12246c, 0x3f0be5b0,
+        0x92dd438b, 0x40c48257, 0x322fdd84, 0xe0361c58, 0xd7f96222, 0x05e0a3fe, 0x770bfc2d, 0xa5123df1,
+        0x189500d9, 0xca8cc105, 0xb8679ed6, 0x6a7e5f0a, 0x5db12170, 0x8fa8e0ac, 0xfd43bf7f, 0x2f5a7ea3,
+        0xa22feebe, 0x70362f62, 0x02dd70b1, 0xd0c4b16d, 0xe70bcf17, 0x35120ecb, 0x47f95118, 0x95e090c4,
+        0x2867adec, 0xfa7e6c30, 0x889533e3, 0x5a8cf23f, 0x6d438c45, 0xbf5a4d99, 0xcdb1124a, 0x1fa8d396,
+        0xb27e75ad, 0x6067b471, 0x128ceba2, 0xc0952a7e, 0xf75a5404, 0x254395d8, 0x57a8ca0b, 0x85b10bd7,
+        0x383636ff, 0xea2ff723, 0x98c4a8f0, 0x4add692c, 0x7d121756, 0xaf0bd68a, 0xdde08959, 0x0ff94885,
+        0xc3cab4d4, 0x11d37508, 0x63382adb, 0xb121eb07, 0x86ee957d, 0x54f754a1, 0x261c0b72, 0xf405caae,
+        0x4982f786, 0x9b9b365a, 0xe9706989, 0x3b69a855, 0x0ca6d62f, 0xdebf17f3, 0xac544820, 0x7e4d89fc,
+        0xd39b2fc7, 0x0182ee1b, 0x7369b1c8, 0xa1707014, 0x96bf0e6e, 0x44a6cfb2, 0x364d9061, 0xe45451bd,
+        0x59d36c95, 0x8bcaad49, 0xf921f29a, 0x2b383346, 0x1cf74d3c, 0xceee8ce0, 0xbc05d333, 0x6e1c12ef,
+        0xe36982f2, 0x3170432e, 0x439b1cfd, 0x9182dd21, 0xa64da35b, 0x74546287, 0x06bf3d54, 0xd4a6fc88,
+        0x6921c1a0, 0xbb38007c, 0xc9d35faf, 0x1bca9e73, 0x2c05e009, 0xfe1c21d5, 0x8cf77e06, 0x5eeebfda,
+        0xf33819e1, 0x2121d83d, 0x53ca87ee, 0x81d34632, 0xb61c3848, 0x6405f994, 0x16eea647, 0xc4f7679b,
+        0x79705ab3, 0xab699b6f, 0xd982c4bc, 0x0b9b0560, 0x3c547b1a, 0xee4dbac6, 0x9ca6e515, 0x4ebf24c9
+    },
+    {
+        0x00000000, 0x01d8ac87, 0x03b1590e, 0x0269f589, 0x0762b21c, 0x06ba1e9b, 0x04d3eb12, 0x050b4795,
+        0x0ec56438, 0x0f1dc8bf, 0x0d743d36, 0x0cac91b1, 0x09a7d624, 0x087f7aa3, 0x0a168f2a, 0x0bce23ad,
+        0x1d8ac870, 0x1c5264f7, 0x1e3b917e, 0x1fe33df9, 0x1ae87a6c, 0x1b30d6eb, 0x19592362, 0x18818fe5,
+        0x134fac48, 0x129700cf, 0x10fef546, 0x112659c1, 0x142d1e54, 0x15f5b2d3, 0x179c475a, 0x1644ebdd,
+        0x3b1590e0, 0x3acd3c67, 0x38a4c9ee, 0x397c6569, 0x3c7722fc, 0x3daf8e7b, 0x3fc67bf2, 0x3e1ed775,
+        0x35d0f4d8, 0x3408585f, 0x3661add6, 0x37b90151, 0x32b246c4, 0x336aea43, 0x31031fca, 0x30dbb34d,
+        0x269f5890, 0x2747f417, 0x252e019e, 0x24f6ad19, 0x21fdea8c, 0x2025460b, 0x224cb382, 0x23941f05,
+        0x285a3ca8, 0x2982902f, 0x2beb65a6, 0x2a33c921, 0x2f388eb4, 0x2ee02233, 0x2c89d7ba, 0x2d517b3d,
+        0x762b21c0, 0x77f38d47, 0x759a78ce, 0x7442d449, 0x714993dc, 0x70913f5b, 0x72f8cad2, 0x73206655,
+        0x78ee45f8, 0x7936e97f, 0x7b5f1cf6, 0x7a87b071, 0x7f8cf7e4, 0x7e545b63, 0x7c3daeea, 0x7de5026d,
+        0x6ba1e9b0, 0x6a794537, 0x6810b0be, 0x69c81c39, 0x6cc35bac, 0x6d1bf72b, 0x6f7202a2, 0x6eaaae25,
+        0x65648d88, 0x64bc210f, 0x66d5d486, 0x670d7801, 0x62063f94, 0x63de9313, 0x61b7669a, 0x606fca1d,
+        0x4d3eb120, 0x4ce61da7, 0x4e8fe82e, 0x4f5744a9, 0x4a5c033c, 0x4b84afbb, 0x49ed5a32, 0x4835f6b5,
+        0x43fbd518, 0x4223799f, 0x404a8c16, 0x41922091, 0x44996704, 0x4541cb83, 0x47283e0a, 0x46f0928d,
+        0x50b47950, 0x516cd5d7, 0x5305205e, 0x52dd8cd9, 0x57d6cb4c, 0x560e67cb, 0x54679242, 0x55bf3ec5,
+        0x5e711d68, 0x5fa9b1ef, 0x5dc04466, 0x5c18e8e1, 0x5913af74, 0x58cb03f3, 0x5aa2f67a, 0x5b7a5afd,
+        0xec564380, 0xed8eef07, 0xefe71a8e, 0xee3fb609, 0xeb34f19c, 0xeaec5d1b, 0xe885a892, 0xe95d0415,
+        0xe29327b8, 0xe34b8b3f, 0xe1227eb6, 0xe0fad231, 0xe5f195a4, 0xe4293923, 0xe640ccaa, 0xe798602d,
+        0xf1dc8bf0, 0xf0042777, 0xf26dd2fe, 0xf3b57e79, 0xf6be39ec, 0xf766956b, 0xf50f60e2, 0xf4d7cc65,
+        0xff19efc8, 0xfec1434f, 0xfca8b6c6, 0xfd701a41, 0xf87b5dd4, 0xf9a3f153, 0xfbca04da, 0xfa12a85d,
+        0xd743d360, 0xd69b7fe7, 0xd4f28a6e, 0xd52a26e9, 0xd021617c, 0xd1f9cdfb, 0xd3903872, 0xd24894f5,
+        0xd986b758, 0xd85e1bdf, 0xda37ee56, 0xdbef42d1, 0xdee40544, 0xdf3ca9c3, 0xdd555c4a, 0xdc8df0cd,
+        0xcac91b10, 0xcb11b797, 0xc978421e, 0xc8a0ee99, 0xcdaba90c, 0xcc73058b, 0xce1af002, 0xcfc25c85,
+        0xc40c7f28, 0xc5d4d3af, 0xc7bd2626, 0xc6658aa1, 0xc36ecd34, 0xc2b661b3, 0xc0df943a, 0xc10738bd,
+        0x9a7d6240, 0x9ba5cec7, 0x99cc3b4e, 0x981497c9, 0x9d1fd05c, 0x9cc77cdb, 0x9eae8952, 0x9f7625d5,
+        0x94b80678, 0x9560aaff, 0x97095f76, 0x96d1f3f1, 0x93dab464, 0x920218e3, 0x906bed6a, 0x91b341ed,
+        0x87f7aa30, 0x862f06b7, 0x8446f33e, 0x859e5fb9, 0x8095182c, 0x814db4ab, 0x83244122, 0x82fceda5,
+        0x8932ce08, 0x88ea628f, 0x8a839706, 0x8b5b3b81, 0x8e507c14, 0x8f88d093, 0x8de1251a, 0x8c39899d,
+        0xa168f2a0, 0xa0b05e27, 0xa2d9abae, 0xa3010729, 0xa60a40bc, 0xa7d2ec3b, 0xa5bb19b2, 0xa463b535,
+        0xafad9698, 0xae753a1f, 0xac1ccf96, 0xadc46311, 0xa8cf2484, 0xa9178803, 0xab7e7d8a, 0xaaa6d10d,
+        0xbce23ad0, 0xbd3a9657, 0xbf5363de, 0xbe8bcf59, 0xbb8088cc, 0xba58244b, 0xb831d1c2, 0xb9e97d45,
+        0xb2275ee8, 0xb3fff26f, 0xb19607e6, 0xb04eab61, 0xb545ecf4, 0xb49d4073, 0xb6f4b5fa, 0xb72c197d
+    },
+    {
+        0x00000000, 0xdc6d9ab7, 0xbc1a28d9, 0x6077b26e, 0x7cf54c05, 0xa098d6b2, 0xc0ef64dc, 0x1c82fe6b,
+        0xf9ea980a, 0x258702bd, 0x45f0b0d3, 0x999d2a64, 0x851fd40f, 0x59724eb8, 0x3905fcd6, 0xe5686661,
+        0xf7142da3, 0x2b79b714, 0x4b0e057a, 0x97639fcd, 0x8be161a6, 0x578cfb11, 0x37fb497f, 0xeb96d3c8,
+        0x0efeb5a9, 0xd2932f1e, 0xb2e49d70, 0x6e8907c7, 0x720bf9ac, 0xae66631b, 0xce11d175, 0x127c4bc2,
+        0xeae946f1, 0x3684dc46, 0x56f36e28, 0x8a9ef49f, 0x961c0af4, 0x4a719043, 0x2a06222d, 0xf66bb89a,
+        0x1303defb, 0xcf6e444c, 0xaf19f622, 0x73746c95, 0x6ff692fe, 0xb39b0849, 0xd3ecba27, 0x0f812090,
+        0x1dfd6b52, 0xc190f1e5, 0xa1e7438b, 0x7d8ad93c, 0x61082757, 0xbd65bde0, 0xdd120f8e, 0x017f9539,
+        0xe417f358, 0x387a69ef, 0x580ddb81, 0x84604136, 0x98e2bf5d, 0x448f25ea, 0x24f89784, 0xf8950d33,
+        0xd1139055, 0x0d7e0ae2, 0x6d09b88c, 0xb164223b, 0xade6dc50, 0x718b46e7, 0x11fcf489, 0xcd916e3e,
+        0x28f9085f, 0xf49492e8, 0x94e32086, 0x488eba31, 0x540c445a, 0x8861deed, 0xe8166c83, 0x347bf634,
+        0x2607bdf6, 0xfa6a2741, 0x9a1d952f, 0x46700f98, 0x5af2f1f3, 0x869f6b44, 0xe6e8d92a, 0x3a85439d,
+        0xdfed25fc, 0x0380bf4b, 0x63f70d25, 0xbf9a9792, 0xa31869f9, 0x7f75f34e, 0x1f024120, 0xc36fdb97,
+        0x3bfad6a4, 0xe7974c13, 0x87e0fe7d, 0x5b8d64ca, 0x470f9aa1, 0x9b620016, 0xfb15b278, 0x277828cf,
+        0xc2104eae, 0x1e7dd419, 0x7e0a6677, 0xa267fcc0, 0xbee502ab, 0x6288981c, 0x02ff2a72, 0xde92b0c5,
+        0xcceefb07, 0x108361b0, 0x70f4d3de, 0xac994969, 0xb01bb702, 0x6c762db5, 0x0c019fdb, 0xd06c056c,
+        0x3504630d, 0xe969f9ba, 0x891e4bd4, 0x5573d163, 0x49f12f08, 0x959cb5bf, 0xf5eb07d1, 0x29869d66,
+        0xa6e63d1d, 0x7a8ba7aa, 0x1afc15c4, 0xc6918f73, 0xda137118, 0x067eebaf, 0x660959c1, 0xba64c376,
+        0x5f0ca517, 0x83613fa0, 0xe3168dce, 0x3f7b1779, 0x23f9e912, 0xff9473a5, 0x9fe3c1cb, 0x438e5b7c,
+        0x51f210be, 0x8d9f8a09, 0xede83867, 0x3185a2d0, 0x2d075cbb, 0xf16ac60c, 0x911d7462, 0x4d70eed5,
+        0xa81888b4, 0x74751203, 0x1402a06d, 0xc86f3ada, 0xd4edc4b1, 0x08805e06, 0x68f7ec68, 0xb49a76df,
+        0x4c0f7bec, 0x9062e15b, 0xf0155335, 0x2c78c982, 0x30fa37e9, 0xec97ad5e, 0x8ce01f30, 0x508d8587,
+        0xb5e5e3e6, 0x69887951, 0x09ffcb3f, 0xd5925188, 0xc910afe3, 0x157d3554, 0x750a873a, 0xa9671d8d,
+        0xbb1b564f, 0x6776ccf8, 0x07017e96, 0xdb6ce421, 0xc7ee1a4a, 0x1b8380fd, 0x7bf43293, 0xa799a824,
+        0x42f1ce45, 0x9e9c54f2, 0xfeebe69c, 0x22867c2b, 0x3e048240, 0xe26918f7, 0x821eaa99, 0x5e73302e,
+        0x77f5ad48, 0xab9837ff, 0xcbef8591, 0x17821f26, 0x0b00e14d, 0xd76d7bfa, 0xb71ac994, 0x6b775323,
+        0x8e1f3542, 0x5272aff5, 0x32051d9b, 0xee68872c, 0xf2ea7947, 0x2e87e3f0, 0x4ef0519e, 0x929dcb29,
+        0x80e180eb, 0x5c8c1a5c, 0x3cfba832, 0xe0963285, 0xfc14ccee, 0x20795659, 0x400ee437, 0x9c637e80,
+        0x790b18e1, 0xa5668256, 0xc5113038, 0x197caa8f, 0x05fe54e4, 0xd993ce53, 0xb9e47c3d, 0x6589e68a,
+        0x9d1cebb9, 0x4171710e, 0x2106c360, 0xfd6b59d7, 0xe1e9a7bc, 0x3d843d0b, 0x5df38f65, 0x819e15d2,
+        0x64f673b3, 0xb89be904, 0xd8ec5b6a, 0x0481c1dd, 0x18033fb6, 0xc46ea501, 0xa419176f, 0x78748dd8,
+        0x6a08c61a, 0xb6655cad, 0xd612eec3, 0x0a7f7474, 0x16fd8a1f, 0xca9010a8, 0xaae7a2c6, 0x768a3871,
+        0x93e25e10, 0x4f8fc4a7, 0x2ff876c9, 0xf395ec7e, 0xef171215, 0x337a88a2, 0x530d3acc, 0x8f60a07b
+    },
+    {
+        0x00000000, 0x490d678d, 0x921acf1a, 0xdb17a897, 0x20f48383, 0x69f9e40e, 0xb2ee4c99, 0xfbe32b14,
+        0x41e90706, 0x08e4608b, 0xd3f3c81c, 0x9afeaf91, 0x611d8485, 0x2810e308, 0xf3074b9f, 0xba0a2c12,
+        0x83d20e0c, 0xcadf6981, 0x11c8c116, 0x58c5a69b, 0xa3268d8f, 0xea2bea02, 0x313c4295, 0x78312518,
+        0xc23b090a, 0x8b366e87, 0x5021c610, 0x192ca19d, 0xe2cf8a89, 0xabc2ed04, 0x70d54593, 0x39d8221e,
+        0x036501af, 0x4a686622, 0x917fceb5, 0xd872a938, 0x2391822c, 0x6a9ce5a1, 0xb18b4d36, 0xf8862abb,
+        0x428c06a9, 0x0b816124, 0xd096c9b3, 0x999bae3e, 0x6278852a, 0x2b75e2a7, 0xf0624a30, 0xb96f2dbd,
+        0x80b70fa3, 0xc9ba682e, 0x12adc0b9, 0x5ba0a734, 0xa0438c20, 0xe94eebad, 0x3259433a, 0x7b5424b7,
+        0xc15e08a5, 0x88536f28, 0x5344c7bf, 0x1a49a032, 0xe1aa8b26, 0xa8a7ecab, 0x73b0443c, 0x3abd23b1,
+        0x06ca035e, 0x4fc764d3, 0x94d0cc44, 0xddddabc9, 0x263e80dd, 0x6f33e750, 0xb4244fc7, 0xfd29284a,
+        0x47230458, 0x0e2e63d5, 0xd539cb42, 0x9c34accf, 0x67d787db, 0x2edae056, 0xf5cd48c1, 0xbcc02f4c,
+        0x85180d52, 0xcc156adf, 0x1702c248, 0x5e0fa5c5, 0xa5ec8ed1, 0xece1e95c, 0x37f641cb, 0x7efb2646,
+        0xc4f10a54, 0x8dfc6dd9, 0x56ebc54e, 0x1fe6a2c3, 0xe40589d7, 0xad08ee5a, 0x761f46cd, 0x3f122140,
+        0x05af02f1, 0x4ca2657c, 0x97b5cdeb, 0xdeb8aa66, 0x255b8172, 0x6c56e6ff, 0xb7414e68, 0xfe4c29e5,
+        0x444605f7, 0x0d4b627a, 0xd65ccaed, 0x9f51ad60, 0x64b28674, 0x2dbfe1f9, 0xf6a8496e, 0xbfa52ee3,
+        0x867d0cfd, 0xcf706b70, 0x1467c3e7, 0x5d6aa46a, 0xa6898f7e, 0xef84e8f3, 0x34934064, 0x7d9e27e9,
+        0xc7940bfb, 0x8e996c76, 0x558ec4e1, 0x1c83a36c, 0xe7608878, 0xae6deff5, 0x757a4762, 0x3c7720ef,
+        0x0d9406bc, 0x44996131, 0x9f8ec9a6, 0xd683ae2b, 0x2d60853f, 0x646de2b2, 0xbf7a4a25, 0xf6772da8,
+        0x4c7d01ba, 0x05706637, 0xde67cea0, 0x976aa92d, 0x6c898239, 0x2584e5b4, 0xfe934d23, 0xb79e2aae,
+        0x8e4608b0, 0xc74b6f3d, 0x1c5cc7aa, 0x5551a027, 0xaeb28b33, 0xe7bfecbe, 0x3ca84429, 0x75a523a4,
+        0xcfaf0fb6, 0x86a2683b, 0x5db5c0ac, 0x14b8a721, 0xef5b8c35, 0xa656ebb8, 0x7d41432f, 0x344c24a2,
+        0x0ef10713, 0x47fc609e, 0x9cebc809, 0xd5e6af84, 0x2e058490, 0x6708e31d, 0xbc1f4b8a, 0xf5122c07,
+        0x4f180015, 0x06156798, 0xdd02cf0f, 0x940fa882, 0x6fec8396, 0x26e1e41b, 0xfdf64c8c, 0xb4fb2b01,
+        0x8d23091f, 0xc42e6e92, 0x1f39c605, 0x5634a188, 0xadd78a9c, 0xe4daed11, 0x3fcd4586, 0x76c0220b,
+        0xccca0e19, 0x85c76994, 0x5ed0c103, 0x17dda68e, 0xec3e8d9a, 0xa533ea17, 0x7e244280, 0x3729250d,
+        0x0b5e05e2, 0x4253626f, 0x9944caf8, 0xd049ad75, 0x2baa8661, 0x62a7e1ec, 0xb9b0497b, 0xf0bd2ef6,
+        0x4ab702e4, 0x03ba6569, 0xd8adcdfe, 0x91a0aa73, 0x6a438167, 0x234ee6ea, 0xf8594e7d, 0xb15429f0,
+        0x888c0bee, 0xc1816c63, 0x1a96c4f4, 0x539ba379, 0xa878886d, 0xe175efe0, 0x3a624777, 0x736f20fa,
+        0xc9650ce8, 0x80686b65, 0x5b7fc3f2, 0x1272a47f, 0xe9918f6b, 0xa09ce8e6, 0x7b8b4071, 0x328627fc,
+        0x083b044d, 0x413663c0, 0x9a21cb57, 0xd32cacda, 0x28cf87ce, 0x61c2e043, 0xbad548d4, 0xf3d82f59,
+        0x49d2034b, 0x00df64c6, 0xdbc8cc51, 0x92c5abdc, 0x692680c8, 0x202be745, 0xfb3c4fd2, 0xb231285f,
+        0x8be90a41, 0xc2e46dcc, 0x19f3c55b, 0x50fea2d6, 0xab1d89c2, 0xe210ee4f, 0x390746d8, 0x700a2155,
+        0xca000d47, 0x830d6aca, 0x581ac25d, 0x1117a5d0, 0xeaf48ec4, 0xa3f9e949, 0x78ee41de, 0x31e32653
+    },
+    {
+        0x00000000, 0x1b280d78, 0x36501af0, 0x2d781788, 0x6ca035e0, 0x77883898, 0x5af02f10, 0x41d82268,
+        0xd9406bc0, 0xc26866b8, 0xef107130, 0xf4387c48, 0xb5e05e20, 0xaec85358, 0x83b044d0, 0x989849a8,
+        0xb641ca37, 0xad69c74f, 0x8011d0c7, 0x9b39ddbf, 0xdae1ffd7, 0xc1c9f2af, 0xecb1e527, 0xf799e85f,
+        0x6f01a1f7, 0x7429ac8f, 0x5951bb07, 0x4279b67f, 0x03a19417, 0x1889996f, 0x35f18ee7, 0x2ed9839f,
+        0x684289d9, 0x736a84a1, 0x5e129329, 0x453a9e51, 0x04e2bc39, 0x1fcab141, 0x32b2a6c9, 0x299aabb1,
+        0xb102e219, 0xaa2aef61, 0x8752f8e9, 0x9c7af591, 0xdda2d7f9, 0xc68ada81, 0xebf2cd09, 0xf0dac071,
+        0xde0343ee, 0xc52b4e96, 0xe853591e, 0xf37b5466, 0xb2a3760e, 0xa98b7b76, 0x84f36cfe, 0x9fdb6186,
+        0x0743282e, 0x1c6b2556, 0x311332de, 0x2a3b3fa6, 0x6be31dce, 0x70cb10b6, 0x5db3073e, 0x469b0a46,
+        0xd08513b2, 0xcbad1eca, 0xe6d50942, 0xfdfd043a, 0xbc252652, 0xa70d2b2a, 0x8a753ca2, 0x915d31da,
+        0x09c57872, 0x12ed750a, 0x3f956282, 0x24bd6ffa, 0x65654d92, 0x7e4d40ea, 0x53355762, 0x481d5a1a,
+        0x66c4d985, 0x7decd4fd, 0x5094c375, 0x4bbcce0d, 0x0a64ec65, 0x114ce11d, 0x3c34f695, 0x271cfbed,
+        0xbf84b245, 0xa4acbf3d, 0x89d4a8b5, 0x92fca5cd, 0xd32487a5, 0xc80c8add, 0xe5749d55, 0xfe5c902d,
+        0xb8c79a6b, 0xa3ef9713, 0x8e97809b, 0x95bf8de3, 0xd467af8b, 0xcf4fa2f3, 0xe237b57b, 0xf91fb803,
+        0x6187f1ab, 0x7aaffcd3, 0x57d7eb5b, 0x4cffe623, 0x0d27c44b, 0x160fc933, 0x3b77debb, 0x205fd3c3,
+        0x0e86505c, 0x15ae5d24, 0x38d64aac, 0x23fe47d4, 0x622665bc, 0x790e68c4, 0x54767f4c, 0x4f5e7234,
+        0xd7c63b9c, 0xccee36e4, 0xe196216c, 0xfabe2c14, 0xbb660e7c, 0xa04e0304, 0x8d36148c, 0x961e19f4,
+        0xa5cb3ad3, 0xbee337ab, 0x939b2023, 0x88b32d5b, 0xc96b0f33, 0xd243024b, 0xff3b15c3, 0xe41318bb,
+        0x7c8b5113, 0x67a35c6b, 0x4adb4be3, 0x51f3469b, 0x102b64f3, 0x0b03698b, 0x267b7e03, 0x3d53737b,
+        0x138af0e4, 0x08a2fd9c, 0x25daea14, 0x3ef2e76c, 0x7f2ac504, 0x6402c87c, 0x497adff4, 0x5252d28c,
+        0xcaca9b24, 0xd1e2965c, 0xfc9a81d4, 0xe7b28cac, 0xa66aaec4, 0xbd42a3bc, 0x903ab434, 0x8b12b94c,
+        0xcd89b30a, 0xd6a1be72, 0xfbd9a9fa, 0xe0f1a482, 0xa12986ea, 0xba018b92, 0x97799c1a, 0x8c519162,
+        0x14c9d8ca, 0x0fe1d5b2, 0x2299c23a, 0x39b1cf42, 0x7869ed2a, 0x6341e052, 0x4e39f7da, 0x5511faa2,
+        0x7bc8793d, 0x60e07445, 0x4d9863cd, 0x56b06eb5, 0x17684cdd, 0x0c4041a5, 0x2138562d, 0x3a105b55,
+        0xa28812fd, 0xb9a01f85, 0x94d8080d, 0x8ff00575, 0xce28271d, 0xd5002a65, 0xf8783ded, 0xe3503095,
+        0x754e2961, 0x6e662419, 0x431e3391, 0x58363ee9, 0x19ee1c81, 0x02c611f9, 0x2fbe0671, 0x34960b09,
+        0xac0e42a1, 0xb7264fd9, 0x9a5e5851, 0x81765529, 0xc0ae7741, 0xdb867a39, 0xf6fe6db1, 0xedd660c9,
+        0xc30fe356, 0xd827ee2e, 0xf55ff9a6, 0xee77f4de, 0xafafd6b6, 0xb487dbce, 0x99ffcc46, 0x82d7c13e,
+        0x1a4f8896, 0x016785ee, 0x2c1f9266, 0x37379f1e, 0x76efbd76, 0x6dc7b00e, 0x40bfa786, 0x5b97aafe,
+        0x1d0ca0b8, 0x0624adc0, 0x2b5cba48, 0x3074b730, 0x71ac9558, 0x6a849820, 0x47fc8fa8, 0x5cd482d0,
+        0xc44ccb78, 0xdf64c600, 0xf21cd188, 0xe934dcf0, 0xa8ecfe98, 0xb3c4f3e0, 0x9ebce468, 0x8594e910,
+        0xab4d6a8f, 0xb06567f7, 0x9d1d707f, 0x86357d07, 0xc7ed5f6f, 0xdcc55217, 0xf1bd459f, 0xea9548e7,
+        0x720d014f, 0x69250c37, 0x445d1bbf, 0x5f7516c7, 0x1ead34af, 0x058539d7, 0x28fd2e5f, 0x33d52327
+    },
+    {
+        0x00000000, 0x4f576811, 0x9eaed022, 0xd1f9b833, 0x399cbdf3, 0x76cbd5e2, 0xa7326dd1, 0xe86505c0,
+        0x73397be6, 0x3c6e13f7, 0xed97abc4, 0xa2c0c3d5, 0x4aa5c615, 0x05f2ae04, 0xd40b1637, 0x9b5c7e26,
+        0xe672f7cc, 0xa9259fdd, 0x78dc27ee, 0x378b4fff, 0xdfee4a3f, 0x90b9222e, 0x41409a1d, 0x0e17f20c,
+        0x954b8c2a, 0xda1ce43b, 0x0be55c08, 0x44b23419, 0xacd731d9, 0xe38059c8, 0x3279e1fb, 0x7d2e89ea,
+        0xc824f22f, 0x87739a3e, 0x568a220d, 0x19dd4a1c, 0xf1b84fdc, 0xbeef27cd, 0x6f169ffe, 0x2041f7ef,
+        0xbb1d89c9, 0xf44ae1d8, 0x25b359eb, 0x6ae431fa, 0x8281343a, 0xcdd65c2b, 0x1c2fe418, 0x53788c09,
+        0x2e5605e3, 0x61016df2, 0xb0f8d5c1, 0xffafbdd0, 0x17cab810, 0x589dd001, 0x89646832, 0xc6330023,
+        0x5d6f7e05, 0x12381614, 0xc3c1ae27, 0x8c96c636, 0x64f3c3f6, 0x2ba4abe7, 0xfa5d13d4, 0xb50a7bc5,
+        0x9488f9e9, 0xdbdf91f8, 0x0a2629cb, 0x457141da, 0xad14441a, 0xe2432c0b, 0x33ba9438, 0x7cedfc29,
+        0xe7b1820f, 0xa8e6ea1e, 0x791f522d, 0x36483a3c, 0xde2d3ffc, 0x917a57ed, 0x4083efde, 0x0fd487cf,
+        0x72fa0e25, 0x3dad6634, 0xec54de07, 0xa303b616, 0x4b66b3d6, 0x0431dbc7, 0xd5c863f4, 0x9a9f0be5,
+        0x01c375c3, 0x4e941dd2, 0x9f6da5e1, 0xd03acdf0, 0x385fc830, 0x7708a021, 0xa6f11812, 0xe9a67003,
+        0x5cac0bc6, 0x13fb63d7, 0xc202dbe4, 0x8d55b3f5, 0x6530b635, 0x2a67de24, 0xfb9e6617, 0xb4c90e06,
+        0x2f957020, 0x60c21831, 0xb13ba002, 0xfe6cc813, 0x1609cdd3, 0x595ea5c2, 0x88a71df1, 0xc7f075e0,
+        0xbadefc0a, 0xf589941b, 0x24702c28, 0x6b274439, 0x834241f9, 0xcc1529e8, 0x1dec91db, 0x52bbf9ca,
+        0xc9e787ec, 0x86b0effd, 0x574957ce, 0x181e3fdf, 0xf07b3a1f, 0xbf2c520e, 0x6ed5ea3d, 0x2182822c,
+        0x2dd0ee65, 0x62878674, 0xb37e3e47, 0xfc295656, 0x144c5396, 0x5b1b3b87, 0x8ae283b4, 0xc5b5eba5,
+        0x5ee99583, 0x11befd92, 0xc04745a1, 0x8f102db0, 0x67752870, 0x28224061, 0xf9dbf852, 0xb68c9043,
+        0xcba219a9, 0x84f571b8, 0x550cc98b, 0x1a5ba19a, 0xf23ea45a, 0xbd69cc4b, 0x6c907478, 0x23c71c69,
+        0xb89b624f, 0xf7cc0a5e, 0x2635b26d, 0x6962da7c, 0x8107dfbc, 0xce50b7ad, 0x1fa90f9e, 0x50fe678f,
+        0xe5f41c4a, 0xaaa3745b, 0x7b5acc68, 0x340da479, 0xdc68a1b9, 0x933fc9a8, 0x42c6719b, 0x0d91198a,
+        0x96cd67ac, 0xd99a0fbd, 0x0863b78e, 0x4734df9f, 0xaf51da5f, 0xe006b24e, 0x31ff0a7d, 0x7ea8626c,
+        0x0386eb86, 0x4cd18397, 0x9d283ba4, 0xd27f53b5, 0x3a1a5675, 0x754d3e64, 0xa4b48657, 0xebe3ee46,
+        0x70bf9060, 0x3fe8f871, 0xee114042, 0xa1462853, 0x49232d93, 0x06744582, 0xd78dfdb1, 0x98da95a0,
+        0xb958178c, 0xf60f7f9d, 0x27f6c7ae, 0x68a1afbf, 0x80c4aa7f, 0xcf93c26e, 0x1e6a7a5d, 0x513d124c,
+        0xca616c6a, 0x8536047b, 0x54cfbc48, 0x1b98d459, 0xf3fdd199, 0xbcaab988, 0x6d5301bb, 0x220469aa,
+        0x5f2ae040, 0x107d8851, 0xc1843062, 0x8ed35873, 0x66b65db3, 0x29e135a2, 0xf8188d91, 0xb74fe580,
+        0x2c139ba6, 0x6344f3b7, 0xb2bd4b84, 0xfdea2395, 0x158f2655, 0x5ad84e44, 0x8b21f677, 0xc4769e66,
+        0x717ce5a3, 0x3e2b8db2, 0xefd23581, 0xa0855d90, 0x48e05850, 0x07b73041, 0xd64e8872, 0x9919e063,
+        0x02459e45, 0x4d12f654, 0x9ceb4e67, 0xd3bc2676, 0x3bd923b6, 0x748e4ba7, 0xa577f394, 0xea209b85,
+        0x970e126f, 0xd8597a7e, 0x09a0c24d, 0x46f7aa5c, 0xae92af9c, 0xe1c5c78d, 0x303c7fbe, 0x7f6b17af,
+        0xe4376989, 0xab600198, 0x7a99b9ab, 0x35ced1ba, 0xddabd47a, 0x92fcbc6b, 0x43050458, 0x0c526c49
+    },
+    {
+        0x00000000, 0x5ba1dcca, 0xb743b994, 0xece2655e, 0x6a466e9f, 0x31e7b255, 0xdd05d70b, 0x86a40bc1,
+        0xd48cdd3e, 0x8f2d01f4, 0x63cf64aa, 0x386eb860, 0xbecab3a1, 0xe56b6f6b, 0x09890a35, 0x5228d6ff,
+        0xadd8a7cb, 0xf6797b01, 0x1a9b1e5f, 0x413ac295, 0xc79ec954, 0x9c3f159e, 0x70dd70c0, 0x2b7cac0a,
+        0x79547af5, 0x22f5a63f, 0xce17c361, 0x95b61fab, 0x1312146a, 0x48b3c8a0, 0xa451adfe, 0xfff07134,
+        0x5f705221, 0x04d18eeb, 0xe833ebb5, 0xb392377f, 0x35363cbe, 0x6e97e074, 0x8275852a, 0xd9d459e0,
+        0x8bfc8f1f, 0xd05d53d5, 0x3cbf368b, 0x671eea41, 0xe1bae180, 0xba1b3d4a, 0x56f95814, 0x0d5884de,
+        0xf2a8f5ea, 0xa9092920, 0x45eb4c7e, 0x1e4a90b4, 0x98ee9b75, 0xc34f47bf, 0x2fad22e1, 0x740cfe2b,
+        0x262428d4, 0x7d85f41e, 0x91679140, 0xcac64d8a, 0x4c62464b, 0x17c39a81, 0xfb21ffdf, 0xa0802315,
+        0xbee0a442, 0xe5417888, 0x09a31dd6, 0x5202c11c, 0xd4a6cadd, 0x8f071617, 0x63e57349, 0x3844af83,
+        0x6a6c797c, 0x31cda5b6, 0xdd2fc0e8, 0x868e1c22, 0x002a17e3, 0x5b8bcb29, 0xb769ae77, 0xecc872bd,
+        0x13380389, 0x4899df43, 0xa47bba1d, 0xffda66d7, 0x797e6d16, 0x22dfb1dc, 0xce3dd482, 0x959c0848,
+        0xc7b4deb7, 0x9c15027d, 0x70f76723, 0x2b56bbe9, 0xadf2b028, 0xf6536ce2, 0x1ab109bc, 0x4110d576,
+        0xe190f663, 0xba312aa9, 0x56d34ff7, 0x0d72933d, 0x8bd698fc, 0xd0774436, 0x3c952168, 0x6734fda2,
+        0x351c2b5d, 0x6ebdf797, 0x825f92c9, 0xd9fe4e03, 0x5f5a45c2, 0x04fb9908, 0xe819fc56, 0xb3b8209c,
+        0x4c4851a8, 0x17e98d62, 0xfb0be83c, 0xa0aa34f6, 0x260e3f37, 0x7dafe3fd, 0x914d86a3, 0xcaec5a69,
+        0x98c48c96, 0xc365505c, 0x2f873502, 0x7426e9c8, 0xf282e209, 0xa9233ec3, 0x45c15b9d, 0x1e608757,
+        0x79005533, 0x22a189f9, 0xce43eca7, 0x95e2306d, 0x13463bac, 0x48e7e766, 0xa4058238, 0xffa45ef2,
+        0xad8c880d, 0xf62d54c7, 0x1acf3199, 0x416eed53, 0xc7cae692, 0x9c6b3a58, 0x70895f06, 0x2b2883cc,
+        0xd4d8f2f8, 0x8f792e32, 0x639b4b6c, 0x383a97a6, 0xbe9e9c67, 0xe53f40ad, 0x09dd25f3, 0x527cf939,
+        0x00542fc6, 0x5bf5f30c, 0xb7179652, 0xecb64a98, 0x6a124159, 0x31b39d93, 0xdd51f8cd, 0x86f02407,
+        0x26700712, 0x7dd1dbd8, 0x9133be86, 0xca92624c, 0x4c36698d, 0x1797b547, 0xfb75d019, 0xa0d40cd3,
+        0xf2fcda2c, 0xa95d06e6, 0x45bf63b8, 0x1e1ebf72, 0x98bab4b3, 0xc31b6879, 0x2ff90d27, 0x7458d1ed,
+        0x8ba8a0d9, 0xd0097c13, 0x3ceb194d, 0x674ac587, 0xe1eece46, 0xba4f128c, 0x56ad77d2, 0x0d0cab18,
+        0x5f247de7, 0x0485a12d, 0xe867c473, 0xb3c618b9, 0x35621378, 0x6ec3cfb2, 0x8221aaec, 0xd9807626,
+        0xc7e0f171, 0x9c412dbb, 0x70a348e5, 0x2b02942f, 0xada69fee, 0xf6074324, 0x1ae5267a, 0x4144fab0,
+        0x136c2c4f, 0x48cdf085, 0xa42f95db, 0xff8e4911, 0x792a42d0, 0x228b9e1a, 0xce69fb44, 0x95c8278e,
+        0x6a3856ba, 0x31998a70, 0xdd7bef2e, 0x86da33e4, 0x007e3825, 0x5bdfe4ef, 0xb73d81b1, 0xec9c5d7b,
+        0xbeb48b84, 0xe515574e, 0x09f73210, 0x5256eeda, 0xd4f2e51b, 0x8f5339d1, 0x63b15c8f, 0x38108045,
+        0x9890a350, 0xc3317f9a, 0x2fd31ac4, 0x7472c60e, 0xf2d6cdcf, 0xa9771105, 0x4595745b, 0x1e34a891,
+        0x4c1c7e6e, 0x17bda2a4, 0xfb5fc7fa, 0xa0fe1b30, 0x265a10f1, 0x7dfbcc3b, 0x9119a965, 0xcab875af,
+        0x3548049b, 0x6ee9d851, 0x820bbd0f, 0xd9aa61c5, 0x5f0e6a04, 0x04afb6ce, 0xe84dd390, 0xb3ec0f5a,
+        0xe1c4d9a5, 0xba65056f, 0x56876031, 0x0d26bcfb, 0x8b82b73a, 0xd0236bf0, 0x3cc10eae, 0x6760d264
+    }
 };
 
 //----------------------------------------------------------------------//
@@ -98,6 +448,7 @@ SBG_COMMON_LIB_API void sbgCrc32Initialize(SbgCrc32 *pInstance)
 SBG_COMMON_LIB_API void sbgCrc32Update(SbgCrc32 *pInstance, const void *pData, size_t dataSize)
 {
     const uint8_t       *pBuffer = (const uint8_t*)pData;
+    uint32_t             crc;
     uint32_t             byte;  
     size_t               dataSizeCorrected;
     size_t               numBytesLeft;
@@ -112,11 +463,33 @@ SBG_COMMON_LIB_API void sbgCrc32Update(SbgCrc32 *pInstance, const void *pData, s
     //
     dataSizeCorrected   = dataSize & (~0x00000003);
     numBytesLeft        = dataSize & 0x03;
-    
+
+    crc = *pInstance;
+
+    //
+    // Process 8 bytes per iteration using the slicing-by-8 tables.
+    // Bytes are processed in reversed order per 4 bytes, so each word is read in little endian
+    //
+    for (i = 0; (i + 8) <= dataSizeCorrected; i += 8)
+    {
+        uint32_t         word1;
+        uint32_t         word2;
+
+        word1   = (uint32_t)pBuffer[i]     | ((uint32_t)pBuffer[i + 1] << 8) | ((uint32_t)pBuffer[i + 2] << 16) | ((uint32_t)pBuffer[i + 3] << 24);
+        word2   = (uint32_t)pBuffer[i + 4] | ((uint32_t)pBuffer[i + 5] << 8) | ((uint32_t)pBuffer[i + 6] << 16) | ((uint32_t)pBuffer[i + 7] << 24);
+
+        word1   ^= crc;
+
+        crc     = crc32EthernetTable[7][(word1 >> 24) & 0xFF] ^ crc32EthernetTable[6][(word1 >> 16) & 0xFF] ^
+                  crc32EthernetTable[5][(word1 >>  8) & 0xFF] ^ crc32EthernetTable[4][word1 & 0xFF] ^
+                  crc32EthernetTable[3][(word2 >> 24) & 0xFF] ^ crc32EthernetTable[2][(word2 >> 16) & 0xFF] ^
+                  crc32EthernetTable[1][(word2 >>  8) & 0xFF] ^ crc32EthernetTable[0][word2 & 0xFF];
+    }
+
     //
-    // For each byte, update the CRC 
+    // For each remaining byte of complete uint32, update the CRC
     //
-    for (i = 0; i < dataSizeCorrected; i++)
+    for (; i < dataSizeCorrected; i++)
     {
         //
         // We have to get index in reversed order per 4 bytes
@@ -131,7 +504,7 @@ SBG_COMMON_LIB_API void sbgCrc32Update(SbgCrc32 *pInstance, const void *pData, s
         //
         // Update the CRC value
         //
-        *pInstance = (*pInstance << 8) ^ crc32EthernetTable[((*pInstance >> 24) ^ byte) & 0xFF];
+        crc = (crc << 8) ^ crc32EthernetTable[0][((crc >> 24) ^ byte) & 0xFF];
     }
 
     //
@@ -152,8 +525,10 @@ SBG_COMMON_LIB_API void sbgCrc32Update(SbgCrc32 *pInstance, const void *pData, s
         //
         // Update the CRC value
         //
-        *pInstance = (*pInstance << 8) ^ crc32EthernetTable[((*pInstance >> 24) ^ byte) & 0xFF];
+        crc = (crc << 8) ^ crc32EthernetTable[0][((crc >> 24) ^ byte) & 0xFF];
     }
+
+    *pInstance = crc;
 }
 
 SBG_COMMON_LIB_API uint32_t sbgCrc32Get(const SbgCrc32 *pInstance)
@@ -187,17 +562,34 @@ SBG_COMMON_LIB_API void sbgCrc16Initialize(SbgCrc16 *pInstance)
 SBG_COMMON_LIB_API void sbgCrc16Update(SbgCrc16 *pInstance, const void *pData, size_t dataSize)
 {
     const uint8_t   *pBuffer = (const uint8_t*)pData;
+    uint16_t         crc;
     uint8_t          index;
     size_t           i;
 
     assert(pInstance);
     assert(pData);
 
-    for (i = 0; i < dataSize; i++)
+    crc = *pInstance;
+
+    //
+    // Process 8 bytes per iteration using the slicing-by-8 tables.
+    // The CRC only spans over the first two bytes of each block
+    //
+    for (i = 0; (i + 8) <= dataSize; i += 8)
+    {
+        crc = crc16LookupTable[7][(pBuffer[i] ^ crc) & 0xFF] ^ crc16LookupTable[6][(pBuffer[i + 1] ^ (crc >> 8)) & 0xFF] ^
+              crc16LookupTable[5][pBuffer[i + 2]] ^ crc16LookupTable[4][pBuffer[i + 3]] ^
+              crc16LookupTable[3][pBuffer[i + 4]] ^ crc16LookupTable[2][pBuffer[i + 5]] ^
+              crc16LookupTable[1][pBuffer[i + 6]] ^ crc16LookupTable[0][pBuffer[i + 7]];
+    }
+
+    for (; i < dataSize; i++)
     {
-        index = (pBuffer[i] ^ *pInstance) & 0xFF;
-        *pInstance = crc16LookupTable[index] ^ (*pInstance >> 8);
+        index = (pBuffer[i] ^ crc) & 0xFF;
+        crc = crc16LookupTable[0][index] ^ (crc >> 8);
     }
+
+    *pInstance = crc;
 }
 
 SBG_COMMON_LIB_API uint16_t sbgCrc16Get(const SbgCrc16 *pInstance)
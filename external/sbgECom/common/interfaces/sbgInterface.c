@@ -4,6 +4,10 @@
 /* Local headers */
 #include "sbgInterface.h"
 
+#ifdef WIN32
+#include <windows.h>
+#endif // WIN32
+
 //----------------------------------------------------------------------//
 //- Private definitions                                                -//
 //----------------------------------------------------------------------//
@@ -42,6 +46,42 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceDestroy(SbgInterface *pInterface)
     return errorCode;
 }
 
+SBG_COMMON_LIB_API void sbgInterfaceTimestampNow(SbgInterfaceTimestamp *pTimestamp)
+{
+#ifdef WIN32
+    LARGE_INTEGER            counter;
+    LARGE_INTEGER            frequency;
+    FILETIME                 fileTime;
+    ULARGE_INTEGER           fileTimeValue;
+#else // WIN32
+    struct timespec          now;
+#endif // WIN32
+
+    assert(pTimestamp);
+
+#ifdef WIN32
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    GetSystemTimePreciseAsFileTime(&fileTime);
+
+    pTimestamp->monotonicNs = (int64_t)(counter.QuadPart / frequency.QuadPart) * 1000000000ll + (int64_t)(((counter.QuadPart % frequency.QuadPart) * 1000000000ll) / frequency.QuadPart);
+
+    //
+    // The file time is expressed in 100 ns units since January 1, 1601
+    //
+    fileTimeValue.LowPart   = fileTime.dwLowDateTime;
+    fileTimeValue.HighPart  = fileTime.dwHighDateTime;
+
+    pTimestamp->realTimeNs = ((int64_t)fileTimeValue.QuadPart - 116444736000000000ll) * 100;
+#else // WIN32
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    pTimestamp->monotonicNs = (int64_t)now.tv_sec * 1000000000ll + now.tv_nsec;
+
+    clock_gettime(CLOCK_REALTIME, &now);
+    pTimestamp->realTimeNs = (int64_t)now.tv_sec * 1000000000ll + now.tv_nsec;
+#endif // WIN32
+}
+
 const char *sbgInterfaceTypeGetAsString(const SbgInterface *pInterface)
 {
     assert(pInterface);
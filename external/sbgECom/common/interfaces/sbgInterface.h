@@ -83,6 +83,17 @@ typedef struct _SbgInterface SbgInterface;
  */
 typedef void* SbgInterfaceHandle;
 
+/*!
+ * Host time at which some data has been received on an interface.
+ *
+ * Both clocks are sampled as close as possible to the reception, a null value means the time is not available.
+ */
+typedef struct _SbgInterfaceTimestamp
+{
+    int64_t                      monotonicNs;                       /*!< Host monotonic clock, in ns. */
+    int64_t                      realTimeNs;                        /*!< Host real time clock, in ns since the Unix epoch. */
+} SbgInterfaceTimestamp;
+
 //----------------------------------------------------------------------//
 //- Callbacks definitions                                              -//
 //----------------------------------------------------------------------//
@@ -175,6 +186,49 @@ typedef uint32_t (*SbgInterfaceGetSpeed)(const SbgInterface *pInterface);
  */
 typedef uint32_t (*SbgInterfaceGetDelayFunc)(const SbgInterface *pInterface, size_t numBytes);
 
+/*!
+ * Method to implement to wait until some data can be read from an interface.
+ *
+ * \param[in]   pInterface                              Interface instance.
+ * \param[in]   timeOut                                 Maximum time to wait, in ms.
+ * \return                                              SBG_NO_ERROR if some data may be read,
+ *                                                      SBG_TIME_OUT if no data has been received before the time out,
+ *                                                      SBG_READ_ERROR if the interface can't be waited on.
+ */
+typedef SbgErrorCode (*SbgInterfaceWaitReadableFunc)(SbgInterface *pInterface, uint32_t timeOut);
+
+/*!
+ * Method to implement to get the file descriptor of an interface.
+ *
+ * The file descriptor may be used to wait for several interfaces at once, with poll() or epoll for example.
+ * It must only be used to wait for events, read and write operations have to be done through the interface.
+ *
+ * \param[in]   pInterface                              Interface instance.
+ * \return                                              The file descriptor, -1 if not applicable.
+ */
+typedef int (*SbgInterfaceGetDescriptorFunc)(const SbgInterface *pInterface);
+
+/*!
+ * Method to implement to get direct access to the data that can be read from an interface, without copy.
+ *
+ * The data is not consumed, and remains valid until it is skipped or the interface is destroyed.
+ *
+ * \param[in]   pInterface                              Interface instance.
+ * \param[out]  ppBuffer                                Pointer to the data that can be read.
+ * \param[out]  pSize                                   Size of the data that can be read, in bytes.
+ * \return                                              SBG_NO_ERROR if successful.
+ */
+typedef SbgErrorCode (*SbgInterfacePeekFunc)(SbgInterface *pInterface, const void **ppBuffer, size_t *pSize);
+
+/*!
+ * Method to implement to consume data accessed with the peek method.
+ *
+ * \param[in]   pInterface                              Interface instance.
+ * \param[in]   size                                    Number of bytes to consume, at most the size returned by the peek method.
+ * \return                                              SBG_NO_ERROR if successful.
+ */
+typedef SbgErrorCode (*SbgInterfaceSkipFunc)(SbgInterface *pInterface, size_t size);
+
 //----------------------------------------------------------------------//
 //- Structures definitions                                             -//
 //----------------------------------------------------------------------//
@@ -202,6 +256,12 @@ struct _SbgInterface
     SbgInterfaceSetSpeed         pSetSpeedFunc;                     /*!< Optional method used to set the interface speed in bps. */
     SbgInterfaceGetSpeed         pGetSpeedFunc;                     /*!< Optional method used to retrieve the interface speed in bps. */
     SbgInterfaceGetDelayFunc     pDelayFunc;                        /*!< Optional method used to compute an expected delay to transmit/receive X bytes */
+    SbgInterfaceWaitReadableFunc pWaitReadableFunc;                 /*!< Optional method used to wait until some data can be read. */
+    SbgInterfaceGetDescriptorFunc pGetDescriptorFunc;               /*!< Optional method used to get the interface file descriptor. */
+    SbgInterfacePeekFunc         pPeekFunc;                         /*!< Optional method used to access the data that can be read without copy. */
+    SbgInterfaceSkipFunc         pSkipFunc;                         /*!< Optional method used to consume data accessed without copy, required with the peek method. */
+
+    SbgInterfaceTimestamp        lastReadTimestamp;                 /*!< Reception time of the data returned by the last successful read, null if not supported. */
 };
 
 //----------------------------------------------------------------------//
@@ -273,6 +333,31 @@ SBG_INLINE const char *sbgInterfaceNameGet(const SbgInterface *pInterface)
  */
 SBG_COMMON_LIB_API void sbgInterfaceNameSet(SbgInterface *pInterface, const char *pName);
 
+/*!
+ * Sample the host monotonic and real time clocks.
+ *
+ * Interface implementations call this method right after data has been read to time stamp it.
+ *
+ * \param[out]  pTimestamp                              Current host time.
+ */
+SBG_COMMON_LIB_API void sbgInterfaceTimestampNow(SbgInterfaceTimestamp *pTimestamp);
+
+/*!
+ * Returns the reception time of the data returned by the last successful read.
+ *
+ * The time is only updated by reads that returned at least one byte. Interfaces that don't support
+ * time stamping, such as files, leave it null.
+ *
+ * \param[in]   pInterface                              Interface instance.
+ * \return                                              Reception time of the last read data.
+ */
+SBG_INLINE const SbgInterfaceTimestamp *sbgInterfaceGetLastReadTimestamp(const SbgInterface *pInterface)
+{
+    assert(pInterface);
+
+    return &pInterface->lastReadTimestamp;
+}
+
 /*!
  * Write some data to an interface.
  *
@@ -445,6 +530,129 @@ SBG_INLINE uint32_t sbgInterfaceGetDelay(const SbgInterface *pInterface, size_t
     }
 }
 
+/*!
+ * Wait until some data can be read from an interface.
+ *
+ * This method lets a reader block until data arrives instead of polling the interface at a fixed rate.
+ *
+ * \param[in]   pInterface                              Interface instance.
+ * \param[in]   timeOut                                 Maximum time to wait, in ms.
+ * \return                                              SBG_NO_ERROR if some data may be read,
+ *                                                      SBG_TIME_OUT if no data has been received before the time out,
+ *                                                      SBG_READ_ERROR if the interface can't be waited on,
+ *                                                      SBG_INVALID_PARAMETER if the interface doesn't support wait operations.
+ */
+SBG_INLINE SbgErrorCode sbgInterfaceWaitReadable(SbgInterface *pInterface, uint32_t timeOut)
+{
+    SbgErrorCode    errorCode;
+
+    assert(pInterface);
+
+    if (pInterface->pWaitReadableFunc)
+    {
+        errorCode = pInterface->pWaitReadableFunc(pInterface, timeOut);
+    }
+    else
+    {
+        errorCode = SBG_INVALID_PARAMETER;
+    }
+
+    return errorCode;
+}
+
+/*!
+ * Returns the file descriptor of an interface.
+ *
+ * WARNING: The method will returns -1 if not applicable for a type of interface.
+ *
+ * \param[in]   pInterface                              Interface instance.
+ * \return                                              The file descriptor or -1 if not applicable.
+ */
+SBG_INLINE int sbgInterfaceGetDescriptor(const SbgInterface *pInterface)
+{
+    assert(pInterface);
+
+    if (pInterface->pGetDescriptorFunc)
+    {
+        return pInterface->pGetDescriptorFunc(pInterface);
+    }
+    else
+    {
+        return -1;
+    }
+}
+
+/*!
+ * Check if the data of an interface can be accessed without copy.
+ *
+ * \param[in]   pInterface                              Interface instance.
+ * \return                                              True if the interface supports peek and skip operations.
+ */
+SBG_INLINE bool sbgInterfaceIsPeekable(const SbgInterface *pInterface)
+{
+    assert(pInterface);
+
+    return (pInterface->pPeekFunc != NULL) && (pInterface->pSkipFunc != NULL);
+}
+
+/*!
+ * Get direct access to the data that can be read from an interface, without copy.
+ *
+ * The data is not consumed, and remains valid until it is skipped or the interface is destroyed.
+ * Read and peek operations must not be mixed without skipping the data accessed with peek.
+ *
+ * \param[in]   pInterface                              Interface instance.
+ * \param[out]  ppBuffer                                Pointer to the data that can be read.
+ * \param[out]  pSize                                   Size of the data that can be read, in bytes.
+ * \return                                              SBG_NO_ERROR if successful,
+ *                                                      SBG_INVALID_PARAMETER if the interface doesn't support peek operations.
+ */
+SBG_INLINE SbgErrorCode sbgInterfacePeek(SbgInterface *pInterface, const void **ppBuffer, size_t *pSize)
+{
+    SbgErrorCode    errorCode;
+
+    assert(pInterface);
+    assert(ppBuffer);
+    assert(pSize);
+
+    if (pInterface->pPeekFunc)
+    {
+        errorCode = pInterface->pPeekFunc(pInterface, ppBuffer, pSize);
+    }
+    else
+    {
+        errorCode = SBG_INVALID_PARAMETER;
+    }
+
+    return errorCode;
+}
+
+/*!
+ * Consume data accessed with sbgInterfacePeek.
+ *
+ * \param[in]   pInterface                              Interface instance.
+ * \param[in]   size                                    Number of bytes to consume.
+ * \return                                              SBG_NO_ERROR if successful,
+ *                                                      SBG_INVALID_PARAMETER if the interface doesn't support skip operations.
+ */
+SBG_INLINE SbgErrorCode sbgInterfaceSkip(SbgInterface *pInterface, size_t size)
+{
+    SbgErrorCode    errorCode;
+
+    assert(pInterface);
+
+    if (pInterface->pSkipFunc)
+    {
+        errorCode = pInterface->pSkipFunc(pInterface, size);
+    }
+    else
+    {
+        errorCode = SBG_INVALID_PARAMETER;
+    }
+
+    return errorCode;
+}
+
 //----------------------------------------------------------------------//
 //- Footer (close extern C block)                                      -//
 //----------------------------------------------------------------------//
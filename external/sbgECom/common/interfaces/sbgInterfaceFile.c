@@ -1,3 +1,13 @@
+// Standard headers
+#ifndef WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif // WIN32
+
 // sbgCommnonLib headers
 #include <sbgCommon.h>
 
@@ -5,10 +15,42 @@
 #include "sbgInterface.h"
 #include "sbgInterfaceFile.h"
 
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * File interface internal data.
+ *
+ * A file is either accessed through a stream, or mapped in memory for read only operations.
+ */
+typedef struct _SbgInterfaceFile
+{
+    FILE                *pFile;                 /*!< File stream, NULL if the file is mapped. */
+    const uint8_t       *pMappedData;           /*!< Mapped file content, NULL if the file is not mapped or empty. */
+    size_t               mappedSize;            /*!< Size of the mapped file content, in bytes. */
+    size_t               cursor;                /*!< Offset of the next byte to read from the mapped file content. */
+} SbgInterfaceFile;
+
 //----------------------------------------------------------------------//
 //- Private methods                                                    -//
 //----------------------------------------------------------------------//
 
+/*!
+ * Returns the file interface internal data.
+ *
+ * \param[in]   pInterface                              Interface instance.
+ * \return                                              File interface internal data.
+ */
+static SbgInterfaceFile *sbgInterfaceFileGet(const SbgInterface *pInterface)
+{
+    assert(pInterface);
+    assert(pInterface->type == SBG_IF_TYPE_FILE);
+    assert(pInterface->handle);
+
+    return (SbgInterfaceFile*)pInterface->handle;
+}
+
 /*!
  * Returns the interface FILE descriptor.
  * 
@@ -17,11 +59,12 @@
  */
 static FILE *sbgInterfaceFileGetDesc(SbgInterface *pInterface)
 {
-    assert(pInterface);
-    assert(pInterface->type == SBG_IF_TYPE_FILE);
-    assert(pInterface->handle);
+    SbgInterfaceFile    *pFileHandle;
 
-    return (FILE*)pInterface->handle;
+    pFileHandle = sbgInterfaceFileGet(pInterface);
+    assert(pFileHandle->pFile);
+
+    return pFileHandle->pFile;
 }
 
 /*!
@@ -32,14 +75,25 @@ static FILE *sbgInterfaceFileGetDesc(SbgInterface *pInterface)
  */
 static SbgErrorCode sbgInterfaceFileDestroy(SbgInterface *pInterface)
 {
-    FILE    *pInputFile;
+    SbgInterfaceFile    *pFileHandle;
 
     assert(pInterface);
     assert(pInterface->type == SBG_IF_TYPE_FILE);
 
-    pInputFile = sbgInterfaceFileGetDesc(pInterface);
+    pFileHandle = sbgInterfaceFileGet(pInterface);
 
-    fclose(pInputFile);
+    if (pFileHandle->pFile)
+    {
+        fclose(pFileHandle->pFile);
+    }
+#ifndef WIN32
+    else if (pFileHandle->pMappedData)
+    {
+        munmap((void *)pFileHandle->pMappedData, pFileHandle->mappedSize);
+    }
+#endif // WIN32
+
+    SBG_FREE(pFileHandle);
     sbgInterfaceZeroInit(pInterface);   
 
     return SBG_NO_ERROR;
@@ -165,6 +219,164 @@ static SbgErrorCode sbgInterfaceFileFlush(SbgInterface *pInterface, uint32_t fla
     return errorCode;
 }
 
+#ifndef WIN32
+/*!
+ * Try to read some data from a mapped file.
+ *
+ * \param[in]   pInterface                              Valid handle on an initialized interface.
+ * \param[in]   pBuffer                                 Pointer on an allocated buffer that can hold at least bytesToRead bytes of data.
+ * \param[out]  pReadBytes                              Pointer on an uint32_t used to return the number of read bytes.
+ * \param[in]   bytesToRead                             Number of bytes we would like to read.
+ * \return                                              SBG_NO_ERROR if no error occurs, please check the number of received bytes.
+ */
+static SbgErrorCode sbgInterfaceFileMapRead(SbgInterface *pInterface, void *pBuffer, size_t *pReadBytes, size_t bytesToRead)
+{
+    SbgInterfaceFile    *pFileHandle;
+    size_t               size;
+
+    assert(pBuffer);
+    assert(pReadBytes);
+
+    pFileHandle = sbgInterfaceFileGet(pInterface);
+
+    size = sbgMin(bytesToRead, pFileHandle->mappedSize - pFileHandle->cursor);
+
+    if (size != 0)
+    {
+        memcpy(pBuffer, &pFileHandle->pMappedData[pFileHandle->cursor], size);
+        pFileHandle->cursor += size;
+    }
+
+    *pReadBytes = size;
+
+    return SBG_NO_ERROR;
+}
+
+/*!
+ * Get direct access to the remaining content of a mapped file.
+ *
+ * \param[in]   pInterface                              Valid handle on an initialized interface.
+ * \param[out]  ppBuffer                                Pointer to the remaining content.
+ * \param[out]  pSize                                   Size of the remaining content, in bytes.
+ * \return                                              SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgInterfaceFileMapPeek(SbgInterface *pInterface, const void **ppBuffer, size_t *pSize)
+{
+    SbgInterfaceFile    *pFileHandle;
+
+    assert(ppBuffer);
+    assert(pSize);
+
+    pFileHandle = sbgInterfaceFileGet(pInterface);
+
+    if (pFileHandle->pMappedData)
+    {
+        *ppBuffer   = &pFileHandle->pMappedData[pFileHandle->cursor];
+        *pSize      = pFileHandle->mappedSize - pFileHandle->cursor;
+    }
+    else
+    {
+        *ppBuffer   = NULL;
+        *pSize      = 0;
+    }
+
+    return SBG_NO_ERROR;
+}
+
+/*!
+ * Consume content of a mapped file.
+ *
+ * \param[in]   pInterface                              Valid handle on an initialized interface.
+ * \param[in]   size                                    Number of bytes to consume.
+ * \return                                              SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgInterfaceFileMapSkip(SbgInterface *pInterface, size_t size)
+{
+    SbgErrorCode         errorCode;
+    SbgInterfaceFile    *pFileHandle;
+
+    pFileHandle = sbgInterfaceFileGet(pInterface);
+
+    if (size <= (pFileHandle->mappedSize - pFileHandle->cursor))
+    {
+        pFileHandle->cursor += size;
+        errorCode = SBG_NO_ERROR;
+    }
+    else
+    {
+        errorCode = SBG_INVALID_PARAMETER;
+        SBG_LOG_ERROR(errorCode, "unable to skip %zu bytes, only %zu bytes left", size, pFileHandle->mappedSize - pFileHandle->cursor);
+    }
+
+    return errorCode;
+}
+
+/*!
+ * Flush a mapped file, there is nothing to flush.
+ *
+ * \param[in]   pInterface                              Valid handle on an initialized interface.
+ * \param[in]   flags                                   Combination of the SBG_IF_FLUSH_INPUT and SBG_IF_FLUSH_OUTPUT flags.
+ * \return                                              SBG_NO_ERROR.
+ */
+static SbgErrorCode sbgInterfaceFileMapFlush(SbgInterface *pInterface, uint32_t flags)
+{
+    SBG_UNUSED_PARAMETER(pInterface);
+    SBG_UNUSED_PARAMETER(flags);
+
+    return SBG_NO_ERROR;
+}
+#endif // WIN32
+
+/*!
+ * Create a file interface from an open file stream.
+ *
+ * \param[in]   pInterface                              Pointer on an allocated interface instance to initialize.
+ * \param[in]   pFile                                   File stream.
+ * \param[in]   filePath                                File path.
+ * \return                                              SBG_NO_ERROR if the interface has been created.
+ */
+static SbgErrorCode sbgInterfaceFileCreateFromStream(SbgInterface *pInterface, FILE *pFile, const char *filePath)
+{
+    SbgErrorCode         errorCode;
+    SbgInterfaceFile    *pFileHandle;
+
+    assert(pInterface);
+    assert(pFile);
+    assert(filePath);
+
+    pFileHandle = malloc(sizeof(*pFileHandle));
+
+    if (pFileHandle)
+    {
+        pFileHandle->pFile          = pFile;
+        pFileHandle->pMappedData    = NULL;
+        pFileHandle->mappedSize     = 0;
+        pFileHandle->cursor         = 0;
+
+        //
+        // Define base interface members
+        //
+        pInterface->handle      = pFileHandle;
+        pInterface->type        = SBG_IF_TYPE_FILE;
+
+        //
+        // Define the interface name
+        //
+        sbgInterfaceNameSet(pInterface, filePath);
+
+        errorCode = SBG_NO_ERROR;
+    }
+    else
+    {
+        fclose(pFile);
+
+        errorCode = SBG_MALLOC_FAILED;
+        SBG_LOG_ERROR(errorCode, "unable to allocate the file interface");
+    }
+
+    return errorCode;
+}
+
 //----------------------------------------------------------------------//
 //- Public methods                                                     -//
 //----------------------------------------------------------------------//
@@ -192,24 +404,18 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFileOpen(SbgInterface *pInterface, c
     //
     if (pInputFile)
     {
-        //
-        // Define base interface members
-        //
-        pInterface->handle      = pInputFile;
-        pInterface->type        = SBG_IF_TYPE_FILE;
+        errorCode = sbgInterfaceFileCreateFromStream(pInterface, pInputFile, filePath);
 
-        //
-        // Define the interface name
-        //
-        sbgInterfaceNameSet(pInterface, filePath);
-                
-        //
-        // Define all specialized members
-        //
-        pInterface->pDestroyFunc    = sbgInterfaceFileDestroy;
-        pInterface->pReadFunc       = sbgInterfaceFileRead;
-        pInterface->pWriteFunc      = NULL;
-        pInterface->pFlushFunc      = sbgInterfaceFileFlush;
+        if (errorCode == SBG_NO_ERROR)
+        {
+            //
+            // Define all specialized members
+            //
+            pInterface->pDestroyFunc    = sbgInterfaceFileDestroy;
+            pInterface->pReadFunc       = sbgInterfaceFileRead;
+            pInterface->pWriteFunc      = NULL;
+            pInterface->pFlushFunc      = sbgInterfaceFileFlush;
+        }
     }
     else
     {
@@ -240,24 +446,18 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFileWriteOpen(SbgInterface *pInterfa
     //
     if (pInputFile)
     {
-        //
-        // Define base interface members
-        //
-        pInterface->handle = pInputFile;
-        pInterface->type = SBG_IF_TYPE_FILE;
-
-        //
-        // Define the interface name
-        //
-        sbgInterfaceNameSet(pInterface, filePath);
+        errorCode = sbgInterfaceFileCreateFromStream(pInterface, pInputFile, filePath);
 
-        //
-        // Define all specialized members
-        //
-        pInterface->pDestroyFunc    = sbgInterfaceFileDestroy;
-        pInterface->pReadFunc       = NULL;
-        pInterface->pWriteFunc      = sbgInterfaceFileWrite;
-        pInterface->pFlushFunc      = sbgInterfaceFileFlush;
+        if (errorCode == SBG_NO_ERROR)
+        {
+            //
+            // Define all specialized members
+            //
+            pInterface->pDestroyFunc    = sbgInterfaceFileDestroy;
+            pInterface->pReadFunc       = NULL;
+            pInterface->pWriteFunc      = sbgInterfaceFileWrite;
+            pInterface->pFlushFunc      = sbgInterfaceFileFlush;
+        }
     }
     else
     {
@@ -279,6 +479,11 @@ SBG_COMMON_LIB_API size_t sbgInterfaceFileGetSize(SbgInterface *pInterface)
     assert(pInterface);
     assert(pInterface->type == SBG_IF_TYPE_FILE);
 
+    if (!sbgInterfaceFileGet(pInterface)->pFile)
+    {
+        return sbgInterfaceFileGet(pInterface)->mappedSize;
+    }
+
     pInputFile = sbgInterfaceFileGetDesc(pInterface);
 
     //
@@ -299,7 +504,121 @@ SBG_COMMON_LIB_API size_t sbgInterfaceFileGetCursor(const SbgInterface *pInterfa
     assert(pInterface);
     assert(pInterface->type == SBG_IF_TYPE_FILE);
 
+    if (!sbgInterfaceFileGet(pInterface)->pFile)
+    {
+        return sbgInterfaceFileGet(pInterface)->cursor;
+    }
+
     pInputFile = sbgInterfaceFileGetDesc((SbgInterface*)pInterface);
 
     return (size_t)ftell(pInputFile);
 }
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFileMapOpen(SbgInterface *pInterface, const char *filePath)
+{
+#ifdef WIN32
+    //
+    // Memory mapping isn't implemented on this platform, use a file stream
+    //
+    SBG_LOG_DEBUG("file mapping not supported, reading %s with a stream", filePath);
+
+    return sbgInterfaceFileOpen(pInterface, filePath);
+#else // WIN32
+    SbgErrorCode         errorCode;
+    int                  fd;
+    struct stat          fileStat;
+
+    assert(pInterface);
+    assert(filePath);
+
+    //
+    // Always call the underlying zero init method to make sure we can correctly handle SbgInterface evolutions
+    //
+    sbgInterfaceZeroInit(pInterface);
+
+    fd = open(filePath, O_RDONLY);
+
+    if (fd == -1)
+    {
+        return SBG_INVALID_PARAMETER;
+    }
+
+    if ((fstat(fd, &fileStat) == 0) && S_ISREG(fileStat.st_mode) && ((uintmax_t)fileStat.st_size <= SIZE_MAX))
+    {
+        SbgInterfaceFile    *pFileHandle;
+
+        pFileHandle = malloc(sizeof(*pFileHandle));
+
+        if (pFileHandle)
+        {
+            pFileHandle->pFile          = NULL;
+            pFileHandle->pMappedData    = NULL;
+            pFileHandle->mappedSize     = (size_t)fileStat.st_size;
+            pFileHandle->cursor         = 0;
+
+            errorCode = SBG_NO_ERROR;
+
+            if (pFileHandle->mappedSize != 0)
+            {
+                void                *pMappedData;
+
+                pMappedData = mmap(NULL, pFileHandle->mappedSize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+                if (pMappedData != MAP_FAILED)
+                {
+                    //
+                    // Let the kernel read ahead aggressively and drop pages once read
+                    //
+                    madvise(pMappedData, pFileHandle->mappedSize, MADV_SEQUENTIAL);
+                    pFileHandle->pMappedData = pMappedData;
+                }
+                else
+                {
+                    errorCode = SBG_ERROR;
+                    SBG_LOG_ERROR(errorCode, "unable to map %s: %s", filePath, strerror(errno));
+                }
+            }
+
+            if (errorCode == SBG_NO_ERROR)
+            {
+                pInterface->handle              = pFileHandle;
+                pInterface->type                = SBG_IF_TYPE_FILE;
+
+                sbgInterfaceNameSet(pInterface, filePath);
+
+                pInterface->pDestroyFunc        = sbgInterfaceFileDestroy;
+                pInterface->pReadFunc           = sbgInterfaceFileMapRead;
+                pInterface->pWriteFunc          = NULL;
+                pInterface->pFlushFunc          = sbgInterfaceFileMapFlush;
+                pInterface->pPeekFunc           = sbgInterfaceFileMapPeek;
+                pInterface->pSkipFunc           = sbgInterfaceFileMapSkip;
+            }
+            else
+            {
+                SBG_FREE(pFileHandle);
+            }
+        }
+        else
+        {
+            errorCode = SBG_MALLOC_FAILED;
+            SBG_LOG_ERROR(errorCode, "unable to allocate the file interface");
+        }
+
+        //
+        // The mapping remains valid once the file is closed
+        //
+        close(fd);
+    }
+    else
+    {
+        //
+        // Pipes and character devices can't be mapped, use a file stream
+        //
+        close(fd);
+
+        errorCode = sbgInterfaceFileOpen(pInterface, filePath);
+    }
+
+    return errorCode;
+#endif // WIN32
+}
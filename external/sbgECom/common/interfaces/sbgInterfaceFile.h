@@ -67,6 +67,22 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFileOpen(SbgInterface *pInterface, c
  */
 SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFileWriteOpen(SbgInterface *pInterface, const char *filePath);
 
+/*!
+ *  Map a file in memory as an interface for read only operations.
+ *
+ *  The file content can be accessed without copy with sbgInterfacePeek, which the sbgECom protocol
+ *  uses to parse frames directly from the mapped memory. The kernel is advised of sequential
+ *  accesses so that it reads ahead.
+ *
+ *  Files that can't be mapped, such as pipes, and platforms without memory mapping support fall
+ *  back to sbgInterfaceFileOpen.
+ *
+ *  \param[in]  pInterface                      Pointer on an allocated interface instance to initialize.
+ *  \param[in]  filePath                        File path to open.
+ *  \return                                     SBG_NO_ERROR if the interface has been created.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFileMapOpen(SbgInterface *pInterface, const char *filePath);
+
 /*!
  *  Returns the file size in bytes.
  *
@@ -44,6 +44,13 @@ extern "C" {
 #include <sbgCommon.h>
 #include <interfaces/sbgInterface.h>
 
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+#define SBG_IF_SERIAL_LOW_LATENCY               (0x00000001u)           /*!< Ask the driver to forward received data immediately (Linux only). */
+#define SBG_IF_SERIAL_EXCLUSIVE                 (0x00000002u)           /*!< Prevent other processes from opening the port (Unix only, always set on Windows). */
+
 //----------------------------------------------------------------------//
 //- Public methods                                                     -//
 //----------------------------------------------------------------------//
@@ -58,6 +65,22 @@ extern "C" {
  */
 SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceSerialCreate(SbgInterface *pInterface, const char *deviceName, uint32_t baudRate);
 
+/*!
+ *  Initialize a serial interface for read and write operations, with options.
+ *
+ *  Any baud rate supported by the serial driver may be used, including non standard ones.
+ *
+ *  The low latency option sets the ASYNC_LOW_LATENCY flag of the port, which USB serial adapters
+ *  use to reduce their latency timer, the flag is left set when the interface is destroyed.
+ *
+ *  \param[in]  pInterface                      Pointer on an allocated interface instance to initialize.
+ *  \param[in]  deviceName                      Serial interface location (COM21 , /dev/ttys0, depending on platform).
+ *  \param[in]  baudRate                        Serial interface baud rate in bps.
+ *  \param[in]  options                         Combination of SBG_IF_SERIAL_LOW_LATENCY and SBG_IF_SERIAL_EXCLUSIVE.
+ *  \return                                     SBG_NO_ERROR if the interface has been created.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceSerialCreateEx(SbgInterface *pInterface, const char *deviceName, uint32_t baudRate, uint32_t options);
+
 //----------------------------------------------------------------------//
 //- Footer (close extern C block)                                      -//
 //----------------------------------------------------------------------//
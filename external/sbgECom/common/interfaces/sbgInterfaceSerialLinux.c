@@ -0,0 +1,78 @@
+// Standard headers
+#include <string.h>
+#include <errno.h>
+#include <sys/ioctl.h>
+
+// Linux headers
+#include <asm/termbits.h>
+#include <linux/serial.h>
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <interfaces/sbgInterfaceSerialLinux.h>
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+SbgErrorCode sbgInterfaceSerialLinuxSetBaudRate(int fd, uint32_t baudRate)
+{
+    SbgErrorCode             errorCode;
+    struct termios2          options;
+
+    if (ioctl(fd, TCGETS2, &options) != -1)
+    {
+        options.c_cflag &= ~(CBAUD | (CBAUD << IBSHIFT));
+        options.c_cflag |= BOTHER | (BOTHER << IBSHIFT);
+        options.c_ispeed = baudRate;
+        options.c_ospeed = baudRate;
+
+        if (ioctl(fd, TCSETS2, &options) != -1)
+        {
+            errorCode = SBG_NO_ERROR;
+        }
+        else
+        {
+            errorCode = SBG_ERROR;
+            SBG_LOG_ERROR(errorCode, "unable to set baud rate %u: %s", baudRate, strerror(errno));
+        }
+    }
+    else
+    {
+        errorCode = SBG_ERROR;
+        SBG_LOG_ERROR(errorCode, "TCGETS2 has failed: %s", strerror(errno));
+    }
+
+    return errorCode;
+}
+
+SbgErrorCode sbgInterfaceSerialLinuxSetLowLatency(int fd)
+{
+    SbgErrorCode             errorCode;
+    struct serial_struct     serialInfo;
+
+    if (ioctl(fd, TIOCGSERIAL, &serialInfo) != -1)
+    {
+        serialInfo.flags |= ASYNC_LOW_LATENCY;
+
+        if (ioctl(fd, TIOCSSERIAL, &serialInfo) != -1)
+        {
+            errorCode = SBG_NO_ERROR;
+        }
+        else
+        {
+            errorCode = SBG_ERROR;
+            SBG_LOG_ERROR(errorCode, "unable to enable the low latency mode: %s", strerror(errno));
+        }
+    }
+    else
+    {
+        //
+        // Drivers that don't implement serial settings, such as CDC ACM, have no latency timer
+        //
+        errorCode = SBG_NO_ERROR;
+        SBG_LOG_DEBUG("serial settings not supported, low latency mode not applied: %s", strerror(errno));
+    }
+
+    return errorCode;
+}
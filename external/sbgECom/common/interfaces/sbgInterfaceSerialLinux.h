@@ -0,0 +1,68 @@
+/*!
+ * \file            sbgInterfaceSerialLinux.h
+ * \ingroup         common
+ * \author          SBG Systems
+ * \date            16 October 2026
+ *
+ * \brief           Linux specific serial port settings.
+ *
+ * These settings rely on kernel definitions that can't be included together with the
+ * C library termios header, hence a dedicated translation unit.
+ *
+ * \copyright       Copyright (C) 2007-2024, SBG Systems SAS. All rights reserved.
+ * \beginlicense    The MIT license
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * \endlicense
+ */
+
+#ifndef SBG_INTERFACE_SERIAL_LINUX_H
+#define SBG_INTERFACE_SERIAL_LINUX_H
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Set an arbitrary baud rate on a serial port.
+ *
+ * The baud rate is set using the termios2 interface, other port settings are left unchanged.
+ *
+ * \param[in]   fd                              Serial port file descriptor.
+ * \param[in]   baudRate                        Baud rate, in bps.
+ * \return                                      SBG_NO_ERROR if the baud rate has been set.
+ */
+SbgErrorCode sbgInterfaceSerialLinuxSetBaudRate(int fd, uint32_t baudRate);
+
+/*!
+ * Ask the serial driver to forward received data immediately.
+ *
+ * For USB serial adapters, this usually disables the latency timer that otherwise delays
+ * received data by up to 16 ms.
+ *
+ * \param[in]   fd                              Serial port file descriptor.
+ * \return                                      SBG_NO_ERROR if the low latency mode has been enabled.
+ */
+SbgErrorCode sbgInterfaceSerialLinuxSetLowLatency(int fd);
+
+#endif // SBG_INTERFACE_SERIAL_LINUX_H
@@ -4,6 +4,7 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include <errno.h>
+#include <poll.h>
 #include <termios.h>
 #include <sys/ioctl.h>
 
@@ -11,6 +12,10 @@
 #include <sbgCommon.h>
 #include <interfaces/sbgInterfaceSerial.h>
 
+#ifdef __linux__
+#include <interfaces/sbgInterfaceSerialLinux.h>
+#endif // __linux__
+
 //----------------------------------------------------------------------//
 //- Definitions                                                        -//
 //----------------------------------------------------------------------//
@@ -119,6 +124,75 @@ static uint32_t sbgInterfaceSerialGetBaudRateConst(uint32_t baudRate)
     return baudRateConst;
 }
 
+/*!
+ * Set the baud rate in serial port options.
+ *
+ * On Linux, baud rates without a predefined constant can't be set in the options,
+ * the port speed is left unchanged and must be set by sbgInterfaceSerialSetCustomBaudRate.
+ *
+ * \param[in]   pOptions                        Serial port options.
+ * \param[in]   baudRate                        The baud rate value (ie 115200).
+ * \return                                      SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgInterfaceSerialSetOptionsBaudRate(struct termios *pOptions, uint32_t baudRate)
+{
+    SbgErrorCode    errorCode;
+    uint32_t        baudRateConst;
+
+    assert(pOptions);
+
+    baudRateConst = sbgInterfaceSerialGetBaudRateConst(baudRate);
+
+#ifdef __linux__
+    if (baudRateConst == baudRate)
+    {
+        return SBG_NO_ERROR;
+    }
+#endif // __linux__
+
+    if ( (cfsetispeed(pOptions, baudRateConst) != -1)  && (cfsetospeed(pOptions, baudRateConst) != -1) )
+    {
+        errorCode = SBG_NO_ERROR;
+    }
+    else
+    {
+        errorCode = SBG_ERROR;
+        SBG_LOG_ERROR(errorCode, "unable to change interface speed");
+    }
+
+    return errorCode;
+}
+
+/*!
+ * Set a baud rate without predefined constant, once the serial port options are applied.
+ *
+ * \param[in]   hSerialHandle                   Serial port file descriptor.
+ * \param[in]   baudRate                        The baud rate value (ie 115200).
+ * \return                                      SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgInterfaceSerialSetCustomBaudRate(int hSerialHandle, uint32_t baudRate)
+{
+    SbgErrorCode    errorCode;
+
+#ifdef __linux__
+    if (sbgInterfaceSerialGetBaudRateConst(baudRate) == baudRate)
+    {
+        errorCode = sbgInterfaceSerialLinuxSetBaudRate(hSerialHandle, baudRate);
+    }
+    else
+    {
+        errorCode = SBG_NO_ERROR;
+    }
+#else // __linux__
+    SBG_UNUSED_PARAMETER(hSerialHandle);
+    SBG_UNUSED_PARAMETER(baudRate);
+
+    errorCode = SBG_NO_ERROR;
+#endif // __linux__
+
+    return errorCode;
+}
+
 /*!
  * Destroy an interface initialized using sbgInterfaceSerialCreate.
  * 
@@ -143,8 +217,9 @@ static SbgErrorCode sbgInterfaceSerialDestroy(SbgInterface *pInterface)
         pSerialHandle = (int *)pInterface->handle;
         
         //
-        // Close the port com
+        // Release the exclusive access, if any, and close the port com
         //
+        ioctl((*pSerialHandle), TIOCNXCL);
         close((*pSerialHandle));
         SBG_FREE(pSerialHandle);
         sbgInterfaceZeroInit(pInterface);
@@ -221,7 +296,6 @@ static SbgErrorCode sbgInterfaceSerialChangeBaudrate(SbgInterface *pInterface, u
 {
     int             hSerialHandle;
     struct termios  options;
-    uint32_t        baudRateConst;
 
     assert(pInterface);
     assert(pInterface->type == SBG_IF_TYPE_SERIAL);
@@ -231,11 +305,6 @@ static SbgErrorCode sbgInterfaceSerialChangeBaudrate(SbgInterface *pInterface, u
     //
     hSerialHandle = *((int*)pInterface->handle);
         
-    //
-    // Get the baud rate const for our Unix platform
-    //
-    baudRateConst = sbgInterfaceSerialGetBaudRateConst(baudRate);
-        
     //
     // Retrieve current options
     //
@@ -244,9 +313,8 @@ static SbgErrorCode sbgInterfaceSerialChangeBaudrate(SbgInterface *pInterface, u
         //
         // Set both input and output baud
         //
-        if ( (cfsetispeed(&options, baudRateConst) == -1)  || (cfsetospeed(&options, baudRateConst) == -1) )
+        if (sbgInterfaceSerialSetOptionsBaudRate(&options, baudRate) != SBG_NO_ERROR)
         {
-            SBG_LOG_ERROR(SBG_ERROR, "unable to change interface speed");
             return SBG_ERROR;
         }
             
@@ -255,7 +323,7 @@ static SbgErrorCode sbgInterfaceSerialChangeBaudrate(SbgInterface *pInterface, u
         //
         if (tcsetattr(hSerialHandle, TCSADRAIN, &options) != -1)
         {
-            return SBG_NO_ERROR;
+            return sbgInterfaceSerialSetCustomBaudRate(hSerialHandle, baudRate);
         }
         else
         {
@@ -371,6 +439,14 @@ static SbgErrorCode sbgInterfaceSerialRead(SbgInterface *pInterface, void *pBuff
     //
     if (numBytesRead >= 0)
     {
+        //
+        // Time stamp the data as close as possible to the read
+        //
+        if (numBytesRead > 0)
+        {
+            sbgInterfaceTimestampNow(&pInterface->lastReadTimestamp);
+        }
+
         errorCode = SBG_NO_ERROR;
     }
     else
@@ -395,15 +471,86 @@ static SbgErrorCode sbgInterfaceSerialRead(SbgInterface *pInterface, void *pBuff
     return errorCode;
 }
 
+/*!
+ * Wait until some data can be read from an interface.
+ *
+ * \param[in]   pInterface                              Valid handle on an initialized interface.
+ * \param[in]   timeOut                                 Maximum time to wait, in ms.
+ * \return                                              SBG_NO_ERROR if some data may be read,
+ *                                                      SBG_TIME_OUT if no data has been received before the time out.
+ */
+static SbgErrorCode sbgInterfaceSerialWaitReadable(SbgInterface *pInterface, uint32_t timeOut)
+{
+    SbgErrorCode    errorCode;
+    struct pollfd   pollFd;
+    int             ret;
+
+    assert(pInterface);
+    assert(pInterface->type == SBG_IF_TYPE_SERIAL);
+
+    pollFd.fd       = *((int*)pInterface->handle);
+    pollFd.events   = POLLIN;
+    pollFd.revents  = 0;
+
+    ret = poll(&pollFd, 1, (int)sbgMin(timeOut, INT32_MAX));
+
+    if (ret > 0)
+    {
+        if (pollFd.revents & (POLLERR | POLLHUP | POLLNVAL))
+        {
+            errorCode = SBG_READ_ERROR;
+        }
+        else
+        {
+            errorCode = SBG_NO_ERROR;
+        }
+    }
+    else if (ret == 0)
+    {
+        errorCode = SBG_TIME_OUT;
+    }
+    else if (errno == EINTR)
+    {
+        //
+        // Interrupted by a signal, let the caller try to read
+        //
+        errorCode = SBG_NO_ERROR;
+    }
+    else
+    {
+        errorCode = SBG_READ_ERROR;
+    }
+
+    return errorCode;
+}
+
+/*!
+ * Returns the file descriptor of an interface.
+ *
+ * \param[in]   pInterface                              Valid handle on an initialized interface.
+ * \return                                              The serial port file descriptor.
+ */
+static int sbgInterfaceSerialGetDescriptor(const SbgInterface *pInterface)
+{
+    assert(pInterface);
+    assert(pInterface->type == SBG_IF_TYPE_SERIAL);
+
+    return *((const int*)pInterface->handle);
+}
+
 //----------------------------------------------------------------------//
 //- Public methods                                                     -//
 //----------------------------------------------------------------------//
 
 SbgErrorCode sbgInterfaceSerialCreate(SbgInterface *pInterface, const char *deviceName, uint32_t baudRate)
+{
+    return sbgInterfaceSerialCreateEx(pInterface, deviceName, baudRate, 0);
+}
+
+SbgErrorCode sbgInterfaceSerialCreateEx(SbgInterface *pInterface, const char *deviceName, uint32_t baudRate, uint32_t options)
 {
     int             *pSerialHandle;
-    struct termios   options;
-    uint32_t         baudRateConst;
+    struct termios   portOptions;
 
     assert(pInterface);
     assert(deviceName);
@@ -413,11 +560,6 @@ SbgErrorCode sbgInterfaceSerialCreate(SbgInterface *pInterface, const char *devi
     //
     sbgInterfaceZeroInit(pInterface);
 
-    //
-    // Get our baud rate const for our Unix platform
-    //
-    baudRateConst = sbgInterfaceSerialGetBaudRateConst(baudRate);
-            
     //
     //  Allocate the serial handle
     //
@@ -433,50 +575,63 @@ SbgErrorCode sbgInterfaceSerialCreate(SbgInterface *pInterface, const char *devi
     //
     if ((*pSerialHandle) != -1)
     {
+        //
+        // Prevent other processes from opening the port, fails if already opened with exclusive access
+        //
+        if ((options & SBG_IF_SERIAL_EXCLUSIVE) && (ioctl((*pSerialHandle), TIOCEXCL) == -1))
+        {
+            SBG_LOG_ERROR(SBG_ERROR, "unable to get exclusive access to %s: %s", deviceName, strerror(errno));
+        }
+#ifdef __linux__
+        else if ((options & SBG_IF_SERIAL_LOW_LATENCY) && (sbgInterfaceSerialLinuxSetLowLatency((*pSerialHandle)) != SBG_NO_ERROR))
+        {
+            SBG_LOG_ERROR(SBG_ERROR, "unable to set the low latency mode");
+        }
+#endif // __linux__
         //
         // Don't block on read call if no data are available
         //
-        if (fcntl((*pSerialHandle), F_SETFL, O_NONBLOCK) != -1)
+        else if (fcntl((*pSerialHandle), F_SETFL, O_NONBLOCK) != -1)
         {
             //
             // Retrieve current options
             //
-            if (tcgetattr((*pSerialHandle), &options) != -1)
+            if (tcgetattr((*pSerialHandle), &portOptions) != -1)
             {
                 //
                 // Define com port options
                 //
-                options.c_cflag |=  (CLOCAL | CREAD);       // Enable the receiver and set local mode...
-                options.c_cflag &= ~(PARENB|CSTOPB|CSIZE);  // No parity, 1 stop bit, mask character size bits
-                options.c_cflag |= CS8;                     // Select 8 data bits
-                options.c_cflag &= ~CRTSCTS;                // Disable Hardware flow control
+                portOptions.c_cflag |=  (CLOCAL | CREAD);       // Enable the receiver and set local mode...
+                portOptions.c_cflag &= ~(PARENB|CSTOPB|CSIZE);  // No parity, 1 stop bit, mask character size bits
+                portOptions.c_cflag |= CS8;                     // Select 8 data bits
+                portOptions.c_cflag &= ~CRTSCTS;                // Disable Hardware flow control
 
                 //
                 // Disable software flow control
                 //
-                options.c_iflag &= ~(IGNBRK|BRKINT|PARMRK|ISTRIP|INLCR|IGNCR|ICRNL|IXON);
+                portOptions.c_iflag &= ~(IGNBRK|BRKINT|PARMRK|ISTRIP|INLCR|IGNCR|ICRNL|IXON);
 
                 //
                 // We would like raw input
                 //
-                options.c_lflag &= ~(ICANON | ECHO | ECHOE | ISIG /*| IEXTEN | ECHONL*/);
-                options.c_oflag &= ~OPOST;
+                portOptions.c_lflag &= ~(ICANON | ECHO | ECHOE | ISIG /*| IEXTEN | ECHONL*/);
+                portOptions.c_oflag &= ~OPOST;
 
                 //
-                // Set our timeout to 0
+                // Set our timeout to 0, the port is non blocking and waits rely on poll()
                 //
-                options.c_cc[VMIN]     = 0;
-                options.c_cc[VTIME]    = 1;
+                portOptions.c_cc[VMIN]     = 0;
+                portOptions.c_cc[VTIME]    = (options & SBG_IF_SERIAL_LOW_LATENCY) ? 0 : 1;
 
                 //
                 // Set both input and output baud
                 //
-                if ( (cfsetispeed(&options, baudRateConst) != -1)  && (cfsetospeed(&options, baudRateConst) != -1) )
+                if (sbgInterfaceSerialSetOptionsBaudRate(&portOptions, baudRate) == SBG_NO_ERROR)
                 {
                     //
                     // Define options
                     //
-                    if (tcsetattr((*pSerialHandle), TCSANOW, &options) != -1)
+                    if ((tcsetattr((*pSerialHandle), TCSANOW, &portOptions) != -1) && (sbgInterfaceSerialSetCustomBaudRate((*pSerialHandle), baudRate) == SBG_NO_ERROR))
                     {                               
                         //
                         // The serial port is ready so create a new serial interface
@@ -492,11 +647,13 @@ SbgErrorCode sbgInterfaceSerialCreate(SbgInterface *pInterface, const char *devi
                         //
                         // Define all overloaded members
                         //
-                        pInterface->pDestroyFunc    = sbgInterfaceSerialDestroy;
-                        pInterface->pReadFunc       = sbgInterfaceSerialRead;
-                        pInterface->pWriteFunc      = sbgInterfaceSerialWrite;
-                        pInterface->pFlushFunc      = sbgInterfaceSerialFlush;
-                        pInterface->pSetSpeedFunc   = sbgInterfaceSerialChangeBaudrate;
+                        pInterface->pDestroyFunc        = sbgInterfaceSerialDestroy;
+                        pInterface->pReadFunc           = sbgInterfaceSerialRead;
+                        pInterface->pWriteFunc          = sbgInterfaceSerialWrite;
+                        pInterface->pFlushFunc          = sbgInterfaceSerialFlush;
+                        pInterface->pSetSpeedFunc       = sbgInterfaceSerialChangeBaudrate;
+                        pInterface->pWaitReadableFunc   = sbgInterfaceSerialWaitReadable;
+                        pInterface->pGetDescriptorFunc  = sbgInterfaceSerialGetDescriptor;
 
                         //
                         // Purge the communication
@@ -505,13 +662,9 @@ SbgErrorCode sbgInterfaceSerialCreate(SbgInterface *pInterface, const char *devi
                     }
                     else
                     {
-                        SBG_LOG_ERROR(SBG_ERROR, "tcsetattr has failed");
+                        SBG_LOG_ERROR(SBG_ERROR, "unable to apply the port options");
                     }
                 }
-                else
-                {
-                    SBG_LOG_ERROR(SBG_ERROR, "unable to change interface speed");
-                }
             }
             else
             {
@@ -529,8 +682,13 @@ SbgErrorCode sbgInterfaceSerialCreate(SbgInterface *pInterface, const char *devi
     }
             
     //
-    //  Release the allocated serial handle
+    //  Close the port, so that the exclusive access is released, and release the allocated serial handle
     //
+    if ((*pSerialHandle) != -1)
+    {
+        close((*pSerialHandle));
+    }
+
     SBG_FREE(pSerialHandle);
 
     return SBG_ERROR;
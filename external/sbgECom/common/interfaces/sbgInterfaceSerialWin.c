@@ -179,6 +179,11 @@ static SbgErrorCode sbgInterfaceSerialRead(SbgInterface *pInterface, void *pBuff
     //
     if (ReadFile(pSerialDevice, pBuffer, (DWORD)bytesToRead, (LPDWORD)&bytesRead, NULL) == true)
     {
+        if (bytesRead > 0)
+        {
+            sbgInterfaceTimestampNow(&pInterface->lastReadTimestamp);
+        }
+
         //
         //  Update the number of bytes read
         //
@@ -358,6 +363,11 @@ static uint32_t sbgInterfaceSerialGetSpeed(const SbgInterface *pInterface)
 //----------------------------------------------------------------------//
 
 SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceSerialCreate(SbgInterface *pInterface, const char *deviceName, uint32_t baudRate)
+{
+    return sbgInterfaceSerialCreateEx(pInterface, deviceName, baudRate, 0);
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceSerialCreateEx(SbgInterface *pInterface, const char *deviceName, uint32_t baudRate, uint32_t options)
 {
     char            errorMsg[256];
     char            comPortPath[32];
@@ -374,6 +384,12 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceSerialCreate(SbgInterface *pInterfac
     //
     sbgInterfaceZeroInit(pInterface);
 
+    //
+    // Ports are always opened with exclusive access, arbitrary baud rates are natively supported
+    // and reads never wait, so the options have no effect
+    //
+    SBG_UNUSED_PARAMETER(options);
+
     //
     // Extract device number
     //
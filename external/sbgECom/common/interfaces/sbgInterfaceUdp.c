@@ -1,3 +1,7 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE                                                     /*!< Required for recvmmsg(). */
+#endif
+
 // sbgCommonLib headers
 #include <sbgCommon.h>
 #include <interfaces/sbgInterfaceUdp.h>
@@ -11,7 +15,9 @@
 
 #define SOCKLEN             int
 #else // WIN32
+#include <errno.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <unistd.h>
 #include <arpa/inet.h>
 #include <netinet/in.h>
@@ -36,9 +42,43 @@
 //----------------------------------------------------------------------//
 
 #define SBG_INTERFACE_UDP_PACKET_MAX_SIZE       (1400)
+#define SBG_INTERFACE_UDP_RX_SLOT_SIZE          (4096)                  /*!< Maximum size of a datagram received in batch, larger ones are truncated. */
+
+#if defined(__linux__) && defined(SO_TIMESTAMPNS)
+#define SBG_INTERFACE_UDP_HAS_RECVMMSG                                  /*!< Defined if datagrams can be received in batch with recvmmsg(). */
+#endif
+
+#ifdef SO_TIMESTAMPNS
+/*!
+ * Ancillary data of a received datagram.
+ */
+typedef union _SbgInterfaceUdpControl
+{
+    struct cmsghdr          header;                                                                             /*!< Ensure the buffer alignment. */
+    uint8_t                 buffer[CMSG_SPACE(sizeof(struct timespec)) + CMSG_SPACE(sizeof(uint32_t))];         /*!< Storage for the reception time and drop count. */
+} SbgInterfaceUdpControl;
+#endif // SO_TIMESTAMPNS
+
+#ifdef SBG_INTERFACE_UDP_HAS_RECVMMSG
+/*!
+ * Datagram received in batch.
+ */
+typedef struct _SbgInterfaceUdpSlot
+{
+    uint8_t                 buffer[SBG_INTERFACE_UDP_RX_SLOT_SIZE];     /*!< Datagram data. */
+    size_t                  size;                                       /*!< Datagram size, in bytes, 0 if rejected. */
+    SOCKADDR_IN             remoteAddr;                                 /*!< Address of the host that sent the datagram. */
+    struct iovec            iov;                                        /*!< Descriptor of the data buffer. */
+    SbgInterfaceUdpControl  control;                                    /*!< Ancillary data. */
+    SbgInterfaceTimestamp   timestamp;                                  /*!< Reception time of the datagram. */
+} SbgInterfaceUdpSlot;
+#endif // SBG_INTERFACE_UDP_HAS_RECVMMSG
 
 /*!
  * Structure that stores all internal data used by the UDP interface.
+ *
+ * If batched reception is enabled, datagrams are received by groups into slots with a single system call, and
+ * each read returns the data of a single datagram so that it keeps its own reception time.
  */
 typedef struct _SbgInterfaceUdp
 {
@@ -48,6 +88,17 @@ typedef struct _SbgInterfaceUdp
     sbgIpAddress    remoteAddr;                 /*!< IP address to send data to. */
     uint32_t        remotePort;                 /*!< Ethernet port to send data to. */
     uint32_t        localPort;                  /*!< Ethernet port on which the interface is listening. */
+
+    uint32_t        nrKernelDrops;              /*!< Number of datagrams dropped by the kernel because the receive buffer was full. */
+
+#ifdef SBG_INTERFACE_UDP_HAS_RECVMMSG
+    struct mmsghdr         *pBatchMsgs;         /*!< Message headers for batched reception, NULL if disabled. */
+    SbgInterfaceUdpSlot    *pBatchSlots;        /*!< Datagrams received by the last batched reception. */
+    size_t                  batchCapacity;      /*!< Maximum number of datagrams received per system call. */
+    size_t                  batchSize;          /*!< Number of datagrams received by the last system call. */
+    size_t                  batchIndex;         /*!< Index of the datagram to read next. */
+    size_t                  batchOffset;        /*!< Offset of the byte to read next in the current datagram. */
+#endif // SBG_INTERFACE_UDP_HAS_RECVMMSG
 } SbgInterfaceUdp;
 
 //----------------------------------------------------------------------//
@@ -192,6 +243,11 @@ static SbgErrorCode sbgInterfaceUdpDestroy(SbgInterface *pInterface)
     shutdown(pUdpHandle->udpSocket, SD_BOTH);
     closesocket(pUdpHandle->udpSocket);
 
+#ifdef SBG_INTERFACE_UDP_HAS_RECVMMSG
+    free(pUdpHandle->pBatchMsgs);
+    free(pUdpHandle->pBatchSlots);
+#endif // SBG_INTERFACE_UDP_HAS_RECVMMSG
+
     //
     // free the allocated sbgInterfaceUdp instance
     //
@@ -262,7 +318,95 @@ static SbgErrorCode sbgInterfaceUdpWrite(SbgInterface *pInterface, const void *p
 }
 
 /*!
- * Try to read some data from an interface.
+ * Check if a datagram has been sent by an accepted remote host.
+ *
+ * \param[in]   pUdpHandle                              UDP interface instance.
+ * \param[in]   pRemoteAddr                             Address of the host that sent the datagram.
+ * \return                                              true if the datagram is accepted.
+ */
+static bool sbgInterfaceUdpIsRemoteAccepted(const SbgInterfaceUdp *pUdpHandle, const SOCKADDR_IN *pRemoteAddr)
+{
+    bool                     accepted;
+
+    assert(pUdpHandle);
+    assert(pRemoteAddr);
+
+    if (pUdpHandle->useConnected && ((pUdpHandle->remoteAddr != pRemoteAddr->sin_addr.s_addr) || (pUdpHandle->remotePort != ntohs(pRemoteAddr->sin_port))))
+    {
+        char                 remoteAddrString[16];
+
+        sbgNetworkIpToString(pRemoteAddr->sin_addr.s_addr, remoteAddrString, sizeof(remoteAddrString));
+        SBG_LOG_DEBUG("received data from invalid remote host (%s:%u)", remoteAddrString, ntohs(pRemoteAddr->sin_port));
+        accepted = false;
+    }
+    else
+    {
+        accepted = true;
+    }
+
+    return accepted;
+}
+
+#ifdef SO_TIMESTAMPNS
+/*!
+ * Process the ancillary data of a received datagram.
+ *
+ * The kernel reception time is used if available. As the kernel only provides a real time clock
+ * value, the monotonic time is compensated for the delay elapsed since the reception.
+ *
+ * \param[in]   pUdpHandle                              UDP interface instance.
+ * \param[in]   pMsg                                    Message header filled by recvmsg() or recvmmsg().
+ * \param[in]   pNow                                    Host time sampled right after the reception.
+ * \param[out]  pTimestamp                              Reception time of the datagram.
+ */
+static void sbgInterfaceUdpProcessControl(SbgInterfaceUdp *pUdpHandle, struct msghdr *pMsg, const SbgInterfaceTimestamp *pNow, SbgInterfaceTimestamp *pTimestamp)
+{
+    struct cmsghdr          *pCmsg;
+
+    assert(pUdpHandle);
+    assert(pMsg);
+    assert(pNow);
+    assert(pTimestamp);
+
+    *pTimestamp = *pNow;
+
+    for (pCmsg = CMSG_FIRSTHDR(pMsg); pCmsg != NULL; pCmsg = CMSG_NXTHDR(pMsg, pCmsg))
+    {
+        if ((pCmsg->cmsg_level == SOL_SOCKET) && (pCmsg->cmsg_type == SCM_TIMESTAMPNS))
+        {
+            struct timespec      kernelTime;
+            int64_t              kernelTimeNs;
+            int64_t              delayNs;
+
+            memcpy(&kernelTime, CMSG_DATA(pCmsg), sizeof(kernelTime));
+
+            kernelTimeNs    = (int64_t)kernelTime.tv_sec * 1000000000ll + kernelTime.tv_nsec;
+            delayNs         = pNow->realTimeNs - kernelTimeNs;
+
+            //
+            // Ignore the kernel time if the real time clock has been stepped meanwhile
+            //
+            if (delayNs >= 0)
+            {
+                pTimestamp->realTimeNs      = kernelTimeNs;
+                pTimestamp->monotonicNs     = pNow->monotonicNs - delayNs;
+            }
+        }
+#ifdef SO_RXQ_OVFL
+        else if ((pCmsg->cmsg_level == SOL_SOCKET) && (pCmsg->cmsg_type == SO_RXQ_OVFL))
+        {
+            //
+            // Cumulative number of datagrams dropped on this socket
+            //
+            memcpy(&pUdpHandle->nrKernelDrops, CMSG_DATA(pCmsg), sizeof(pUdpHandle->nrKernelDrops));
+        }
+#endif // SO_RXQ_OVFL
+    }
+}
+#endif // SO_TIMESTAMPNS
+
+/*!
+ * Try to read a single datagram from an interface.
  *
  * \param[in]   pHandle                                 Valid handle on an initialized interface.
  * \param[in]   pBuffer                                 Pointer on an allocated buffer that can hold at least bytesToRead bytes of data.
@@ -270,13 +414,19 @@ static SbgErrorCode sbgInterfaceUdpWrite(SbgInterface *pInterface, const void *p
  * \param[in]   bytesToRead                             Number of bytes we would like to read.
  * \return                                              SBG_NO_ERROR if no error occurs, please check the number of received bytes.
  */
-static SbgErrorCode sbgInterfaceUdpRead(SbgInterface *pInterface, void *pBuffer, size_t *pReadBytes, size_t bytesToRead)
+static SbgErrorCode sbgInterfaceUdpReadSingle(SbgInterface *pInterface, void *pBuffer, size_t *pReadBytes, size_t bytesToRead)
 {
     SbgErrorCode             errorCode;
     SbgInterfaceUdp         *pUdpHandle;
     SOCKADDR_IN              remoteAddr;
-    SOCKLEN                  remoteAddrLen;
     int                      ret;
+#ifdef SO_TIMESTAMPNS
+    struct iovec             iov;
+    struct msghdr            msg;
+    SbgInterfaceUdpControl   control;
+#else // SO_TIMESTAMPNS
+    SOCKLEN                  remoteAddrLen;
+#endif // SO_TIMESTAMPNS
 
     assert(pInterface);
     assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
@@ -285,21 +435,41 @@ static SbgErrorCode sbgInterfaceUdpRead(SbgInterface *pInterface, void *pBuffer,
 
     pUdpHandle = sbgInterfaceUdpGet(pInterface);
 
+#ifdef SO_TIMESTAMPNS
+    iov.iov_base        = pBuffer;
+    iov.iov_len         = bytesToRead;
+
+    memset(&msg, 0x00, sizeof(msg));
+    msg.msg_name        = &remoteAddr;
+    msg.msg_namelen     = sizeof(remoteAddr);
+    msg.msg_iov         = &iov;
+    msg.msg_iovlen      = 1;
+    msg.msg_control     = control.buffer;
+    msg.msg_controllen  = sizeof(control.buffer);
+
+    ret = (int)recvmsg(pUdpHandle->udpSocket, &msg, 0);
+#else // SO_TIMESTAMPNS
     remoteAddrLen = sizeof(remoteAddr);
     ret = recvfrom(pUdpHandle->udpSocket, pBuffer, (int)bytesToRead, 0, (SOCKADDR *)&remoteAddr, &remoteAddrLen);
+#endif // SO_TIMESTAMPNS
 
     if (ret != -1)
     {
-        if (pUdpHandle->useConnected)
+        if (!sbgInterfaceUdpIsRemoteAccepted(pUdpHandle, &remoteAddr))
         {
-            if ( (pUdpHandle->remoteAddr != remoteAddr.sin_addr.s_addr) || (pUdpHandle->remotePort != ntohs(remoteAddr.sin_port)) )
-            {
-                char             remoteAddrString[16];
+            ret = 0;
+        }
 
-                sbgNetworkIpToString(remoteAddr.sin_addr.s_addr, remoteAddrString, sizeof(remoteAddrString));
-                SBG_LOG_DEBUG("received data from invalid remote host (%s:%u)", remoteAddrString, ntohs(remoteAddr.sin_port));
-                ret = 0;
-            }
+        if (ret > 0)
+        {
+#ifdef SO_TIMESTAMPNS
+            SbgInterfaceTimestamp    now;
+
+            sbgInterfaceTimestampNow(&now);
+            sbgInterfaceUdpProcessControl(pUdpHandle, &msg, &now, &pInterface->lastReadTimestamp);
+#else // SO_TIMESTAMPNS
+            sbgInterfaceTimestampNow(&pInterface->lastReadTimestamp);
+#endif // SO_TIMESTAMPNS
         }
 
         errorCode = SBG_NO_ERROR;
@@ -327,6 +497,315 @@ static SbgErrorCode sbgInterfaceUdpRead(SbgInterface *pInterface, void *pBuffer,
     return errorCode;
 }
 
+#ifdef SBG_INTERFACE_UDP_HAS_RECVMMSG
+/*!
+ * Returns the next datagram received in batch that hasn't been fully read.
+ *
+ * \param[in]   pUdpHandle                              UDP interface instance.
+ * \return                                              The pending datagram, NULL if none.
+ */
+static SbgInterfaceUdpSlot *sbgInterfaceUdpGetPendingSlot(SbgInterfaceUdp *pUdpHandle)
+{
+    SbgInterfaceUdpSlot     *pSlot;
+
+    assert(pUdpHandle);
+
+    pSlot = NULL;
+
+    while (pUdpHandle->batchIndex < pUdpHandle->batchSize)
+    {
+        if (pUdpHandle->pBatchSlots[pUdpHandle->batchIndex].size != 0)
+        {
+            pSlot = &pUdpHandle->pBatchSlots[pUdpHandle->batchIndex];
+            break;
+        }
+
+        pUdpHandle->batchIndex++;
+    }
+
+    return pSlot;
+}
+
+/*!
+ * Receive as many datagrams as available, up to the batch capacity, with a single system call.
+ *
+ * \param[in]   pUdpHandle                              UDP interface instance.
+ * \return                                              SBG_NO_ERROR if successful, even if no datagram has been received.
+ */
+static SbgErrorCode sbgInterfaceUdpReceiveBatch(SbgInterfaceUdp *pUdpHandle)
+{
+    SbgErrorCode             errorCode;
+    int                      ret;
+
+    assert(pUdpHandle);
+    assert(pUdpHandle->pBatchMsgs);
+
+    //
+    // Restore the buffer sizes updated by the previous reception
+    //
+    for (size_t i = 0; i < pUdpHandle->batchCapacity; i++)
+    {
+        pUdpHandle->pBatchMsgs[i].msg_hdr.msg_namelen       = sizeof(pUdpHandle->pBatchSlots[i].remoteAddr);
+        pUdpHandle->pBatchMsgs[i].msg_hdr.msg_controllen    = sizeof(pUdpHandle->pBatchSlots[i].control.buffer);
+        pUdpHandle->pBatchMsgs[i].msg_hdr.msg_flags         = 0;
+    }
+
+    ret = recvmmsg(pUdpHandle->udpSocket, pUdpHandle->pBatchMsgs, (unsigned int)pUdpHandle->batchCapacity, 0, NULL);
+
+    pUdpHandle->batchSize   = 0;
+    pUdpHandle->batchIndex  = 0;
+    pUdpHandle->batchOffset = 0;
+
+    if (ret > 0)
+    {
+        SbgInterfaceTimestamp    now;
+
+        sbgInterfaceTimestampNow(&now);
+
+        pUdpHandle->batchSize = (size_t)ret;
+
+        for (size_t i = 0; i < pUdpHandle->batchSize; i++)
+        {
+            SbgInterfaceUdpSlot     *pSlot;
+            struct mmsghdr          *pMsg;
+
+            pSlot   = &pUdpHandle->pBatchSlots[i];
+            pMsg    = &pUdpHandle->pBatchMsgs[i];
+
+            sbgInterfaceUdpProcessControl(pUdpHandle, &pMsg->msg_hdr, &now, &pSlot->timestamp);
+
+            pSlot->size = pMsg->msg_len;
+
+            if (pMsg->msg_hdr.msg_flags & MSG_TRUNC)
+            {
+                SBG_LOG_ERROR(SBG_BUFFER_OVERFLOW, "datagram truncated to %zu bytes", pSlot->size);
+            }
+
+            if (!sbgInterfaceUdpIsRemoteAccepted(pUdpHandle, &pSlot->remoteAddr))
+            {
+                pSlot->size = 0;
+            }
+        }
+
+        errorCode = SBG_NO_ERROR;
+    }
+    else if ((ret == 0) || (errno == EAGAIN) || (errno == EWOULDBLOCK))
+    {
+        errorCode = SBG_NO_ERROR;
+    }
+    else
+    {
+        errorCode = SBG_READ_ERROR;
+        SBG_LOG_ERROR(errorCode, "unable to receive data");
+    }
+
+    return errorCode;
+}
+
+/*!
+ * Try to read some data from an interface with batched reception.
+ *
+ * Only the data of a single datagram is returned, so that its reception time is reported.
+ *
+ * \param[in]   pHandle                                 Valid handle on an initialized interface.
+ * \param[in]   pBuffer                                 Pointer on an allocated buffer that can hold at least bytesToRead bytes of data.
+ * \param[out]  pReadBytes                              Pointer on an uint32_t used to return the number of read bytes.
+ * \param[in]   bytesToRead                             Number of bytes we would like to read.
+ * \return                                              SBG_NO_ERROR if no error occurs, please check the number of received bytes.
+ */
+static SbgErrorCode sbgInterfaceUdpReadBatch(SbgInterface *pInterface, void *pBuffer, size_t *pReadBytes, size_t bytesToRead)
+{
+    SbgErrorCode             errorCode;
+    SbgInterfaceUdp         *pUdpHandle;
+    SbgInterfaceUdpSlot     *pSlot;
+
+    assert(pInterface);
+    assert(pBuffer);
+    assert(pReadBytes);
+
+    pUdpHandle  = sbgInterfaceUdpGet(pInterface);
+    errorCode   = SBG_NO_ERROR;
+    pSlot       = sbgInterfaceUdpGetPendingSlot(pUdpHandle);
+
+    if (!pSlot)
+    {
+        errorCode = sbgInterfaceUdpReceiveBatch(pUdpHandle);
+
+        if (errorCode == SBG_NO_ERROR)
+        {
+            pSlot = sbgInterfaceUdpGetPendingSlot(pUdpHandle);
+        }
+    }
+
+    if (pSlot && (bytesToRead != 0))
+    {
+        size_t               size;
+
+        size = sbgMin(pSlot->size - pUdpHandle->batchOffset, bytesToRead);
+
+        memcpy(pBuffer, &pSlot->buffer[pUdpHandle->batchOffset], size);
+        pInterface->lastReadTimestamp = pSlot->timestamp;
+
+        pUdpHandle->batchOffset += size;
+
+        if (pUdpHandle->batchOffset == pSlot->size)
+        {
+            pUdpHandle->batchIndex++;
+            pUdpHandle->batchOffset = 0;
+        }
+
+        *pReadBytes = size;
+    }
+    else
+    {
+        *pReadBytes = 0;
+    }
+
+    return errorCode;
+}
+#endif // SBG_INTERFACE_UDP_HAS_RECVMMSG
+
+/*!
+ * Try to read some data from an interface.
+ *
+ * \param[in]   pHandle                                 Valid handle on an initialized interface.
+ * \param[in]   pBuffer                                 Pointer on an allocated buffer that can hold at least bytesToRead bytes of data.
+ * \param[out]  pReadBytes                              Pointer on an uint32_t used to return the number of read bytes.
+ * \param[in]   bytesToRead                             Number of bytes we would like to read.
+ * \return                                              SBG_NO_ERROR if no error occurs, please check the number of received bytes.
+ */
+static SbgErrorCode sbgInterfaceUdpRead(SbgInterface *pInterface, void *pBuffer, size_t *pReadBytes, size_t bytesToRead)
+{
+    SbgErrorCode             errorCode;
+
+    assert(pInterface);
+    assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+
+#ifdef SBG_INTERFACE_UDP_HAS_RECVMMSG
+    if (sbgInterfaceUdpGet(pInterface)->pBatchMsgs)
+    {
+        errorCode = sbgInterfaceUdpReadBatch(pInterface, pBuffer, pReadBytes, bytesToRead);
+    }
+    else
+    {
+        errorCode = sbgInterfaceUdpReadSingle(pInterface, pBuffer, pReadBytes, bytesToRead);
+    }
+#else // SBG_INTERFACE_UDP_HAS_RECVMMSG
+    errorCode = sbgInterfaceUdpReadSingle(pInterface, pBuffer, pReadBytes, bytesToRead);
+#endif // SBG_INTERFACE_UDP_HAS_RECVMMSG
+
+    return errorCode;
+}
+
+/*!
+ * Wait until some data can be read from an interface.
+ *
+ * \param[in]   pInterface                              Valid handle on an initialized interface.
+ * \param[in]   timeOut                                 Maximum time to wait, in ms.
+ * \return                                              SBG_NO_ERROR if some data may be read,
+ *                                                      SBG_TIME_OUT if no data has been received before the time out.
+ */
+static SbgErrorCode sbgInterfaceUdpWaitReadable(SbgInterface *pInterface, uint32_t timeOut)
+{
+    SbgErrorCode             errorCode;
+    SbgInterfaceUdp         *pUdpHandle;
+    int                      ret;
+#ifdef WIN32
+    fd_set                   readFds;
+    struct timeval           timeVal;
+#else // WIN32
+    struct pollfd            pollFd;
+#endif // WIN32
+
+    assert(pInterface);
+    assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+
+    pUdpHandle = sbgInterfaceUdpGet(pInterface);
+
+#ifdef WIN32
+    FD_ZERO(&readFds);
+    FD_SET(pUdpHandle->udpSocket, &readFds);
+
+    timeVal.tv_sec  = timeOut / 1000;
+    timeVal.tv_usec = (timeOut % 1000) * 1000;
+
+    ret = select(0, &readFds, NULL, NULL, &timeVal);
+
+    if (ret > 0)
+    {
+        errorCode = SBG_NO_ERROR;
+    }
+    else if (ret == 0)
+    {
+        errorCode = SBG_TIME_OUT;
+    }
+    else
+    {
+        errorCode = SBG_READ_ERROR;
+        SBG_LOG_ERROR(errorCode, "unable to wait for data");
+    }
+#else // WIN32
+    pollFd.fd       = pUdpHandle->udpSocket;
+    pollFd.events   = POLLIN;
+    pollFd.revents  = 0;
+
+#ifdef SBG_INTERFACE_UDP_HAS_RECVMMSG
+    if (sbgInterfaceUdpGetPendingSlot(pUdpHandle))
+    {
+        //
+        // Datagrams received by the last batch haven't been read yet
+        //
+        ret = 1;
+    }
+    else
+    {
+        ret = poll(&pollFd, 1, (int)sbgMin(timeOut, INT32_MAX));
+    }
+#else // SBG_INTERFACE_UDP_HAS_RECVMMSG
+    ret = poll(&pollFd, 1, (int)sbgMin(timeOut, INT32_MAX));
+#endif // SBG_INTERFACE_UDP_HAS_RECVMMSG
+
+    if (ret > 0)
+    {
+        errorCode = SBG_NO_ERROR;
+    }
+    else if (ret == 0)
+    {
+        errorCode = SBG_TIME_OUT;
+    }
+    else if (errno == EINTR)
+    {
+        //
+        // Interrupted by a signal, let the caller try to read
+        //
+        errorCode = SBG_NO_ERROR;
+    }
+    else
+    {
+        errorCode = SBG_READ_ERROR;
+        SBG_LOG_ERROR(errorCode, "unable to wait for data");
+    }
+#endif // WIN32
+
+    return errorCode;
+}
+
+#ifndef WIN32
+/*!
+ * Returns the file descriptor of an interface.
+ *
+ * \param[in]   pInterface                              Valid handle on an initialized interface.
+ * \return                                              The socket file descriptor.
+ */
+static int sbgInterfaceUdpGetDescriptor(const SbgInterface *pInterface)
+{
+    assert(pInterface);
+    assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+
+    return sbgInterfaceUdpGetConst(pInterface)->udpSocket;
+}
+#endif // WIN32
+
 //----------------------------------------------------------------------//
 //- Public functions                                                   -//
 //----------------------------------------------------------------------//
@@ -352,10 +831,20 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpCreate(SbgInterface *pInterface,
 
         if (pNewUdpHandle)
         {
-            pNewUdpHandle->useConnected = false;
-            pNewUdpHandle->remoteAddr   = remoteAddr;
-            pNewUdpHandle->remotePort   = remotePort;
-            pNewUdpHandle->localPort    = localPort;
+            pNewUdpHandle->useConnected     = false;
+            pNewUdpHandle->remoteAddr       = remoteAddr;
+            pNewUdpHandle->remotePort       = remotePort;
+            pNewUdpHandle->localPort        = localPort;
+            pNewUdpHandle->nrKernelDrops    = 0;
+
+#ifdef SBG_INTERFACE_UDP_HAS_RECVMMSG
+            pNewUdpHandle->pBatchMsgs       = NULL;
+            pNewUdpHandle->pBatchSlots      = NULL;
+            pNewUdpHandle->batchCapacity    = 0;
+            pNewUdpHandle->batchSize        = 0;
+            pNewUdpHandle->batchIndex       = 0;
+            pNewUdpHandle->batchOffset      = 0;
+#endif // SBG_INTERFACE_UDP_HAS_RECVMMSG
 
             pNewUdpHandle->udpSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
 
@@ -367,6 +856,23 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpCreate(SbgInterface *pInterface,
                 {
                     SOCKADDR_IN  bindAddress;
                     int          socketError;
+#ifdef SO_TIMESTAMPNS
+                    int          enable = 1;
+
+                    //
+                    // Let the kernel time stamp received datagrams, reads fall back to user space time stamps otherwise
+                    //
+                    if (setsockopt(pNewUdpHandle->udpSocket, SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable)) != 0)
+                    {
+                        SBG_LOG_WARNING(SBG_ERROR, "unable to enable kernel time stamps");
+                    }
+#endif // SO_TIMESTAMPNS
+#ifdef SO_RXQ_OVFL
+                    if (setsockopt(pNewUdpHandle->udpSocket, SOL_SOCKET, SO_RXQ_OVFL, &enable, sizeof(enable)) != 0)
+                    {
+                        SBG_LOG_WARNING(SBG_ERROR, "unable to enable drop reporting");
+                    }
+#endif // SO_RXQ_OVFL
 
                     //
                     // Accept incoming data from any IP address but on localPort only
@@ -398,9 +904,13 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpCreate(SbgInterface *pInterface,
                         //
                         // Define all overloaded members
                         //
-                        pInterface->pDestroyFunc    = sbgInterfaceUdpDestroy;
-                        pInterface->pReadFunc       = sbgInterfaceUdpRead;
-                        pInterface->pWriteFunc      = sbgInterfaceUdpWrite;
+                        pInterface->pDestroyFunc        = sbgInterfaceUdpDestroy;
+                        pInterface->pReadFunc           = sbgInterfaceUdpRead;
+                        pInterface->pWriteFunc          = sbgInterfaceUdpWrite;
+                        pInterface->pWaitReadableFunc   = sbgInterfaceUdpWaitReadable;
+#ifndef WIN32
+                        pInterface->pGetDescriptorFunc  = sbgInterfaceUdpGetDescriptor;
+#endif // WIN32
 
                         return SBG_NO_ERROR;
                     }
@@ -493,3 +1003,172 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpAllowBroadcast(SbgInterface *pInt
 
     return errorCode;
 }
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetReceiveBufferSize(SbgInterface *pInterface, size_t size)
+{
+    SbgErrorCode             errorCode;
+    SbgInterfaceUdp         *pUdpHandle;
+    int                      socketError;
+    int                      optValue;
+
+    assert(pInterface);
+    assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+    assert(size <= INT32_MAX);
+
+    pUdpHandle = sbgInterfaceUdpGet(pInterface);
+
+    optValue = (int)size;
+    socketError = setsockopt(pUdpHandle->udpSocket, SOL_SOCKET, SO_RCVBUF, (const char *)&optValue, sizeof(optValue));
+
+    if (socketError == NO_ERROR)
+    {
+#ifdef SO_RCVBUFFORCE
+        SOCKLEN              optLength;
+
+        //
+        // The size is capped by the system maximum, which privileged processes may exceed.
+        // The size reported by the kernel is doubled to account for its bookkeeping overhead.
+        //
+        optLength = sizeof(optValue);
+        socketError = getsockopt(pUdpHandle->udpSocket, SOL_SOCKET, SO_RCVBUF, &optValue, &optLength);
+
+        if ((socketError == NO_ERROR) && (((size_t)optValue / 2) < size))
+        {
+            optValue = (int)size;
+            setsockopt(pUdpHandle->udpSocket, SOL_SOCKET, SO_RCVBUFFORCE, &optValue, sizeof(optValue));
+
+            optLength = sizeof(optValue);
+            socketError = getsockopt(pUdpHandle->udpSocket, SOL_SOCKET, SO_RCVBUF, &optValue, &optLength);
+
+            if ((socketError == NO_ERROR) && (((size_t)optValue / 2) < size))
+            {
+                SBG_LOG_WARNING(SBG_ERROR, "receive buffer size limited to %d bytes by the system", optValue / 2);
+            }
+        }
+#endif // SO_RCVBUFFORCE
+
+        errorCode = SBG_NO_ERROR;
+    }
+    else
+    {
+        errorCode = SBG_ERROR;
+        SBG_LOG_ERROR(errorCode, "unable to set the receive buffer size");
+    }
+
+    return errorCode;
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetBusyPoll(SbgInterface *pInterface, uint32_t timeOut)
+{
+    SbgErrorCode             errorCode;
+
+    assert(pInterface);
+    assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+    assert(timeOut <= INT32_MAX);
+
+#ifdef SO_BUSY_POLL
+    SbgInterfaceUdp         *pUdpHandle;
+    int                      optValue;
+
+    pUdpHandle = sbgInterfaceUdpGet(pInterface);
+
+    optValue = (int)timeOut;
+
+    if (setsockopt(pUdpHandle->udpSocket, SOL_SOCKET, SO_BUSY_POLL, &optValue, sizeof(optValue)) == NO_ERROR)
+    {
+        errorCode = SBG_NO_ERROR;
+    }
+    else
+    {
+        errorCode = SBG_ERROR;
+        SBG_LOG_ERROR(errorCode, "unable to set the busy polling time");
+    }
+#else // SO_BUSY_POLL
+    SBG_UNUSED_PARAMETER(timeOut);
+
+    errorCode = SBG_INVALID_PARAMETER;
+    SBG_LOG_ERROR(errorCode, "busy polling not supported");
+#endif // SO_BUSY_POLL
+
+    return errorCode;
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetBatchSize(SbgInterface *pInterface, size_t nrDatagrams)
+{
+    SbgErrorCode             errorCode;
+
+    assert(pInterface);
+    assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+
+#ifdef SBG_INTERFACE_UDP_HAS_RECVMMSG
+    SbgInterfaceUdp         *pUdpHandle;
+
+    pUdpHandle = sbgInterfaceUdpGet(pInterface);
+
+    SBG_FREE(pUdpHandle->pBatchMsgs);
+    SBG_FREE(pUdpHandle->pBatchSlots);
+
+    pUdpHandle->batchCapacity   = 0;
+    pUdpHandle->batchSize       = 0;
+    pUdpHandle->batchIndex      = 0;
+    pUdpHandle->batchOffset     = 0;
+
+    errorCode = SBG_NO_ERROR;
+
+    if (nrDatagrams > 1)
+    {
+        pUdpHandle->pBatchMsgs  = calloc(nrDatagrams, sizeof(*pUdpHandle->pBatchMsgs));
+        pUdpHandle->pBatchSlots = calloc(nrDatagrams, sizeof(*pUdpHandle->pBatchSlots));
+
+        if (pUdpHandle->pBatchMsgs && pUdpHandle->pBatchSlots)
+        {
+            for (size_t i = 0; i < nrDatagrams; i++)
+            {
+                SbgInterfaceUdpSlot     *pSlot;
+                struct msghdr           *pMsgHdr;
+
+                pSlot   = &pUdpHandle->pBatchSlots[i];
+                pMsgHdr = &pUdpHandle->pBatchMsgs[i].msg_hdr;
+
+                pSlot->iov.iov_base     = pSlot->buffer;
+                pSlot->iov.iov_len      = sizeof(pSlot->buffer);
+
+                pMsgHdr->msg_name       = &pSlot->remoteAddr;
+                pMsgHdr->msg_iov        = &pSlot->iov;
+                pMsgHdr->msg_iovlen     = 1;
+                pMsgHdr->msg_control    = pSlot->control.buffer;
+            }
+
+            pUdpHandle->batchCapacity = nrDatagrams;
+        }
+        else
+        {
+            SBG_FREE(pUdpHandle->pBatchMsgs);
+            SBG_FREE(pUdpHandle->pBatchSlots);
+
+            errorCode = SBG_MALLOC_FAILED;
+            SBG_LOG_ERROR(errorCode, "unable to allocate the batch of %zu datagrams", nrDatagrams);
+        }
+    }
+#else // SBG_INTERFACE_UDP_HAS_RECVMMSG
+    if (nrDatagrams > 1)
+    {
+        errorCode = SBG_INVALID_PARAMETER;
+        SBG_LOG_ERROR(errorCode, "batched reception not supported");
+    }
+    else
+    {
+        errorCode = SBG_NO_ERROR;
+    }
+#endif // SBG_INTERFACE_UDP_HAS_RECVMMSG
+
+    return errorCode;
+}
+
+SBG_COMMON_LIB_API uint32_t sbgInterfaceUdpGetNrDrops(const SbgInterface *pInterface)
+{
+    assert(pInterface);
+    assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+
+    return sbgInterfaceUdpGetConst(pInterface)->nrKernelDrops;
+}
@@ -96,6 +96,52 @@ SBG_COMMON_LIB_API bool sbgInterfaceUdpGetConnectedMode(const SbgInterface *pInt
  */
 SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpAllowBroadcast(SbgInterface *pInterface, bool allowBroadcast);
 
+/*!
+ * Set the size of the socket receive buffer.
+ *
+ * A large buffer absorbs bursts of datagrams while the application is not reading, for example when
+ * the process is descheduled. The size may be limited by the system, in which case a warning is logged.
+ *
+ * \param[in]   pInterface                      Pointer on a valid UDP interface created using sbgInterfaceUdpCreate.
+ * \param[in]   size                            Receive buffer size, in bytes.
+ * \return                                      SBG_NO_ERROR if the receive buffer size has been changed.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetReceiveBufferSize(SbgInterface *pInterface, size_t size);
+
+/*!
+ * Set the time the kernel busy polls the network device for incoming datagrams on blocking reads and waits.
+ *
+ * Busy polling lowers the reception latency at the cost of CPU usage, it is only available on Linux.
+ *
+ * \param[in]   pInterface                      Pointer on a valid UDP interface created using sbgInterfaceUdpCreate.
+ * \param[in]   timeOut                         Busy polling time, in us, 0 to disable.
+ * \return                                      SBG_NO_ERROR if the busy polling time has been changed.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetBusyPoll(SbgInterface *pInterface, uint32_t timeOut);
+
+/*!
+ * Set the maximum number of datagrams received with a single system call.
+ *
+ * Batched reception is only available on Linux. Each read still returns the data of a single datagram,
+ * copied from the batch, and datagrams larger than 4096 bytes are truncated. Datagrams received by a
+ * previous batch and not read yet are discarded.
+ *
+ * \param[in]   pInterface                      Pointer on a valid UDP interface created using sbgInterfaceUdpCreate.
+ * \param[in]   nrDatagrams                     Maximum number of datagrams per batch, 0 or 1 to disable batched reception.
+ * \return                                      SBG_NO_ERROR if the batch size has been changed.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetBatchSize(SbgInterface *pInterface, size_t nrDatagrams);
+
+/*!
+ * Returns the number of datagrams dropped by the kernel because the socket receive buffer was full.
+ *
+ * The count is only available on Linux and is updated as datagrams are received.
+ *
+ * \param[in]   pInterface                      Pointer on a valid UDP interface created using sbgInterfaceUdpCreate.
+ * \return                                      Number of dropped datagrams, 0 if not supported.
+ */
+SBG_COMMON_LIB_API uint32_t sbgInterfaceUdpGetNrDrops(const SbgInterface *pInterface);
+
 #ifdef __cplusplus
 }
 #endif
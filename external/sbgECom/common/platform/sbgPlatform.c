@@ -42,7 +42,7 @@ SBG_COMMON_LIB_API uint32_t sbgGetTime(void)
     return (mach_absolute_time() * timeInfo.numer / timeInfo.denom) / 1000000.0;
 #else
     struct timespec now;
-    clock_gettime(CLOCK_REALTIME, &now);
+    clock_gettime(CLOCK_MONOTONIC, &now);
 
     //
     // Return the current time in ms
@@ -51,6 +51,38 @@ SBG_COMMON_LIB_API uint32_t sbgGetTime(void)
 #endif
 }
 
+SBG_COMMON_LIB_API uint64_t sbgGetTimeUs(void)
+{
+#ifdef WIN32
+    LARGE_INTEGER               counter;
+    LARGE_INTEGER               frequency;
+
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+
+    //
+    // Split the conversion to avoid overflowing the counter multiplied by 10^6
+    //
+    return (uint64_t)(counter.QuadPart / frequency.QuadPart) * 1000000 + (uint64_t)(counter.QuadPart % frequency.QuadPart) * 1000000 / frequency.QuadPart;
+#elif defined(__APPLE__)
+    mach_timebase_info_data_t   timeInfo;
+    mach_timebase_info(&timeInfo);
+
+    //
+    // Return the current time in us
+    //
+    return (mach_absolute_time() * timeInfo.numer / timeInfo.denom) / 1000;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    //
+    // Return the current time in us
+    //
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+#endif
+}
+
 SBG_COMMON_LIB_API void sbgSleep(uint32_t ms)
 {
 #ifdef WIN32
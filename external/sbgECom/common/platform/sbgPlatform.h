@@ -74,10 +74,22 @@ typedef void (*SbgCommonLibOnLogFunc)(const char *pFileName, const char *pFuncti
 /*!
  * Get the current time.
  *
+ * The time is read from a monotonic clock when the platform provides one, it is thus only meaningful
+ * to measure elapsed times.
+ *
  * \return                                  The current time, in ms.
  */
 SBG_COMMON_LIB_API uint32_t sbgGetTime(void);
 
+/*!
+ * Get the current time with a microsecond resolution.
+ *
+ * The time is read from a monotonic clock, it never jumps when the system time is adjusted.
+ *
+ * \return                                  The current time, in us.
+ */
+SBG_COMMON_LIB_API uint64_t sbgGetTimeUs(void);
+
 /*!
  * Sleep.
  *
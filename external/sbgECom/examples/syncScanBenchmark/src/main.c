@@ -0,0 +1,442 @@
+/*!
+ * \file            main.c
+ * \author          SBG Systems
+ * \date            16/10/2026
+ *
+ * \brief           Benchmark of the sbgECom SYNC bytes scanner.
+ *
+ * The protocol searches the first SYNC byte with memchr(), which the C library implements with
+ * word or SIMD operations, instead of testing each byte. This benchmark compares both scanners
+ * on a stream of frames separated by noise, then measures the whole reception path of the
+ * protocol on the same stream.
+ *
+ * \copyright       Copyright (C) 2007-2024, SBG Systems SAS. All rights reserved.
+ * \beginlicense    The MIT license
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * \endlicense
+ */
+
+// Standard headers
+#include <stdlib.h>
+#include <string.h>
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <crc/sbgCrc.h>
+
+// sbgECom headers
+#include <sbgEComLib.h>
+
+//----------------------------------------------------------------------//
+//- Definitions                                                        -//
+//----------------------------------------------------------------------//
+
+#define SYNC_SCAN_BENCHMARK_STREAM_SIZE         (32 * 1024 * 1024)      /*!< Default size of the stream, in bytes. */
+#define SYNC_SCAN_BENCHMARK_NOISE_SIZE          (1024)                  /*!< Maximum size of the noise between two frames, in bytes. */
+#define SYNC_SCAN_BENCHMARK_PAYLOAD_SIZE        (64)                    /*!< Size of the frame payloads, in bytes. */
+#define SYNC_SCAN_BENCHMARK_SYNC_1_RATIO        (64)                    /*!< One noise byte out of this ratio is a first SYNC byte. */
+#define SYNC_SCAN_BENCHMARK_READ_SIZE           (512)                   /*!< Maximum number of bytes returned by each read. */
+
+/*!
+ * Stream read by the memory interface.
+ */
+typedef struct _SyncScanStream
+{
+    const uint8_t                       *pBuffer;                       /*!< Stream buffer. */
+    size_t                               size;                          /*!< Stream size, in bytes. */
+    size_t                               offset;                        /*!< Read offset, in bytes. */
+} SyncScanStream;
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Get the next value of a xorshift pseudo random generator.
+ *
+ * \param[in/out]   pState              Generator state, not zero.
+ * \return                              Pseudo random value.
+ */
+static uint32_t syncScanRandom(uint32_t *pState)
+{
+    uint32_t                             value;
+
+    assert(pState);
+
+    value    = *pState;
+    value   ^= value << 13;
+    value   ^= value >> 17;
+    value   ^= value << 5;
+    *pState  = value;
+
+    return value;
+}
+
+/*!
+ * Fill a stream with frames separated by noise.
+ *
+ * The noise holds more first SYNC bytes than random data would, as they are the worst case
+ * for the scanners. It holds no second SYNC byte, so that the protocol receives every frame.
+ *
+ * \param[out]  pBuffer                 Stream buffer.
+ * \param[in]   size                    Stream size, in bytes.
+ * \return                              Number of frames in the stream.
+ */
+static size_t syncScanFillStream(uint8_t *pBuffer, size_t size)
+{
+    const size_t                         frameSize = 6 + SYNC_SCAN_BENCHMARK_PAYLOAD_SIZE + 3;
+    uint32_t                             state;
+    size_t                               offset;
+    size_t                               nrFrames;
+
+    assert(pBuffer);
+
+    state       = 0x12345678;
+    offset      = 0;
+    nrFrames    = 0;
+
+    for (;;)
+    {
+        size_t                           noiseSize;
+        uint8_t                         *pFrame;
+        uint16_t                         crc;
+
+        noiseSize = syncScanRandom(&state) % SYNC_SCAN_BENCHMARK_NOISE_SIZE;
+
+        if ((offset + noiseSize + frameSize) > size)
+        {
+            break;
+        }
+
+        for (size_t i = 0; i < noiseSize; i++)
+        {
+            uint32_t                     value;
+
+            value = syncScanRandom(&state);
+
+            if ((value % SYNC_SCAN_BENCHMARK_SYNC_1_RATIO) == 0)
+            {
+                pBuffer[offset + i] = SBG_ECOM_SYNC_1;
+            }
+            else if ((uint8_t)(value >> 8) == SBG_ECOM_SYNC_2)
+            {
+                pBuffer[offset + i] = 0;
+            }
+            else
+            {
+                pBuffer[offset + i] = (uint8_t)(value >> 8);
+            }
+        }
+
+        offset += noiseSize;
+
+        pFrame      = &pBuffer[offset];
+        pFrame[0]   = SBG_ECOM_SYNC_1;
+        pFrame[1]   = SBG_ECOM_SYNC_2;
+        pFrame[2]   = SBG_ECOM_LOG_EKF_QUAT;
+        pFrame[3]   = SBG_ECOM_CLASS_LOG_ECOM_0;
+        pFrame[4]   = (uint8_t)SYNC_SCAN_BENCHMARK_PAYLOAD_SIZE;
+        pFrame[5]   = (uint8_t)(SYNC_SCAN_BENCHMARK_PAYLOAD_SIZE >> 8);
+
+        for (size_t i = 0; i < SYNC_SCAN_BENCHMARK_PAYLOAD_SIZE; i++)
+        {
+            pFrame[6 + i] = (uint8_t)syncScanRandom(&state);
+        }
+
+        crc = sbgCrc16Compute(&pFrame[2], 4 + SYNC_SCAN_BENCHMARK_PAYLOAD_SIZE);
+
+        pFrame[frameSize - 3]   = (uint8_t)crc;
+        pFrame[frameSize - 2]   = (uint8_t)(crc >> 8);
+        pFrame[frameSize - 1]   = SBG_ECOM_ETX;
+
+        offset += frameSize;
+        nrFrames++;
+    }
+
+    //
+    // Pad the end of the stream with bytes that aren't SYNC bytes.
+    //
+    memset(&pBuffer[offset], 0, size - offset);
+
+    return nrFrames;
+}
+
+/*!
+ * Find SYNC bytes by testing each byte, as the scalar fallback does.
+ *
+ * \param[in]   pBuffer                 Buffer.
+ * \param[in]   size                    Buffer size, in bytes.
+ * \param[in]   startOffset             Start offset, in bytes.
+ * \return                              Offset of the SYNC bytes, size if not found.
+ */
+static size_t syncScanFindScalar(const uint8_t *pBuffer, size_t size, size_t startOffset)
+{
+    assert(pBuffer);
+
+    for (size_t i = startOffset; (i + 1) < size; i++)
+    {
+        if ((pBuffer[i] == SBG_ECOM_SYNC_1) && (pBuffer[i + 1] == SBG_ECOM_SYNC_2))
+        {
+            return i;
+        }
+    }
+
+    return size;
+}
+
+/*!
+ * Find SYNC bytes by searching the first one with memchr(), as the protocol does.
+ *
+ * \param[in]   pBuffer                 Buffer.
+ * \param[in]   size                    Buffer size, in bytes.
+ * \param[in]   startOffset             Start offset, in bytes.
+ * \return                              Offset of the SYNC bytes, size if not found.
+ */
+static size_t syncScanFindMemchr(const uint8_t *pBuffer, size_t size, size_t startOffset)
+{
+    size_t                               offset;
+
+    assert(pBuffer);
+
+    offset = startOffset;
+
+    while ((offset + 1) < size)
+    {
+        const uint8_t                   *pCandidate;
+
+        pCandidate = memchr(&pBuffer[offset], SBG_ECOM_SYNC_1, size - 1 - offset);
+
+        if (!pCandidate)
+        {
+            break;
+        }
+
+        offset = (size_t)(pCandidate - pBuffer);
+
+        if (pBuffer[offset + 1] == SBG_ECOM_SYNC_2)
+        {
+            return offset;
+        }
+
+        offset++;
+    }
+
+    return size;
+}
+
+/*!
+ * Measure a scanner over a stream.
+ *
+ * \param[in]   pName                   Scanner name.
+ * \param[in]   pFindFunc               Scanner.
+ * \param[in]   pBuffer                 Stream buffer.
+ * \param[in]   size                    Stream size, in bytes.
+ * \param[out]  pNrSyncs                Number of SYNC bytes pairs found.
+ * \return                              Duration, in us.
+ */
+static uint64_t syncScanMeasure(const char *pName, size_t (*pFindFunc)(const uint8_t *, size_t, size_t), const uint8_t *pBuffer, size_t size, size_t *pNrSyncs)
+{
+    uint64_t                             startTime;
+    uint64_t                             duration;
+    size_t                               offset;
+    size_t                               nrSyncs;
+
+    assert(pName);
+    assert(pFindFunc);
+    assert(pNrSyncs);
+
+    nrSyncs     = 0;
+    startTime   = sbgGetTimeUs();
+
+    for (offset = pFindFunc(pBuffer, size, 0); offset < size; offset = pFindFunc(pBuffer, size, offset + 2))
+    {
+        nrSyncs++;
+    }
+
+    duration = sbgGetTimeUs() - startTime;
+
+    printf("%-24s %10zu SYNC pairs %10.1f MB/s\n", pName, nrSyncs, (double)size / (double)sbgMax(duration, 1));
+
+    *pNrSyncs = nrSyncs;
+
+    return duration;
+}
+
+/*!
+ * Read data from the stream of a memory interface.
+ *
+ * \param[in]   pInterface              Interface.
+ * \param[out]  pBuffer                 Buffer.
+ * \param[out]  pReadBytes              Number of bytes read.
+ * \param[in]   bytesToRead             Maximum number of bytes to read.
+ * \return                              SBG_NO_ERROR.
+ */
+static SbgErrorCode syncScanStreamRead(SbgInterface *pInterface, void *pBuffer, size_t *pReadBytes, size_t bytesToRead)
+{
+    SyncScanStream                      *pStream;
+    size_t                               size;
+
+    assert(pInterface);
+    assert(pReadBytes);
+
+    pStream = pInterface->handle;
+    size    = sbgMin(sbgMin(bytesToRead, (size_t)SYNC_SCAN_BENCHMARK_READ_SIZE), pStream->size - pStream->offset);
+
+    memcpy(pBuffer, &pStream->pBuffer[pStream->offset], size);
+    pStream->offset += size;
+
+    *pReadBytes = size;
+
+    return SBG_NO_ERROR;
+}
+
+/*!
+ * Measure the reception of all the frames of a stream by the protocol.
+ *
+ * \param[in]   pBuffer                 Stream buffer.
+ * \param[in]   size                    Stream size, in bytes.
+ * \param[out]  pNrFrames               Number of frames received.
+ * \return                              SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode syncScanMeasureProtocol(const uint8_t *pBuffer, size_t size, size_t *pNrFrames)
+{
+    SbgErrorCode                         errorCode;
+    SyncScanStream                       stream;
+    SbgInterface                         interface;
+    SbgEComProtocol                      protocol;
+    SbgEComProtocolPayload               payload;
+    uint64_t                             startTime;
+    uint64_t                             duration;
+    size_t                               nrFrames;
+
+    assert(pNrFrames);
+
+    stream.pBuffer  = pBuffer;
+    stream.size     = size;
+    stream.offset   = 0;
+
+    sbgInterfaceZeroInit(&interface);
+
+    interface.handle    = &stream;
+    interface.pReadFunc = syncScanStreamRead;
+
+    errorCode = sbgEComProtocolInit(&protocol, &interface);
+
+    if (errorCode == SBG_NO_ERROR)
+    {
+        sbgEComProtocolPayloadConstruct(&payload);
+
+        nrFrames    = 0;
+        startTime   = sbgGetTimeUs();
+
+        //
+        // The whole stream has been read once no frame is left in the work buffer.
+        //
+        for (;;)
+        {
+            if (sbgEComProtocolReceive2(&protocol, NULL, NULL, &payload) == SBG_NO_ERROR)
+            {
+                nrFrames++;
+            }
+            else if (stream.offset == stream.size)
+            {
+                break;
+            }
+        }
+
+        duration = sbgGetTimeUs() - startTime;
+
+        printf("%-24s %10zu frames     %10.1f MB/s\n", "protocol reception", nrFrames, (double)size / (double)sbgMax(duration, 1));
+
+        sbgEComProtocolPayloadDestroy(&payload);
+        sbgEComProtocolClose(&protocol);
+
+        *pNrFrames = nrFrames;
+    }
+
+    return errorCode;
+}
+
+//----------------------------------------------------------------------//
+//  Main program                                                        //
+//----------------------------------------------------------------------//
+
+/*!
+ * Program entry point usage: syncScanBenchmark [STREAM_SIZE_MB]
+ *
+ * \param[in]   argc                    Number of input arguments.
+ * \param[in]   argv                    Input arguments as an array of strings.
+ * \return                              EXIT_SUCCESS if successful.
+ */
+int main(int argc, char** argv)
+{
+    uint8_t                             *pBuffer;
+    size_t                               size;
+    size_t                               nrFrames;
+    size_t                               nrScalarSyncs;
+    size_t                               nrMemchrSyncs;
+    size_t                               nrReceivedFrames;
+    uint64_t                             scalarDuration;
+    uint64_t                             memchrDuration;
+    int                                  exitCode;
+
+    if (argc == 2)
+    {
+        size = (size_t)strtoul(argv[1], NULL, 10) * 1024 * 1024;
+    }
+    else
+    {
+        size = SYNC_SCAN_BENCHMARK_STREAM_SIZE;
+    }
+
+    pBuffer = malloc(size);
+
+    if ((size != 0) && pBuffer)
+    {
+        nrFrames = syncScanFillStream(pBuffer, size);
+
+        printf("%zu bytes, %zu frames, one noise byte out of %u is a SYNC byte\n\n", size, nrFrames, SYNC_SCAN_BENCHMARK_SYNC_1_RATIO);
+
+        scalarDuration = syncScanMeasure("scalar scanner", syncScanFindScalar, pBuffer, size, &nrScalarSyncs);
+        memchrDuration = syncScanMeasure("memchr() scanner", syncScanFindMemchr, pBuffer, size, &nrMemchrSyncs);
+
+        printf("%-24s %10.2fx\n\n", "speedup", (double)scalarDuration / (double)sbgMax(memchrDuration, 1));
+
+        if ((syncScanMeasureProtocol(pBuffer, size, &nrReceivedFrames) == SBG_NO_ERROR) && (nrScalarSyncs == nrMemchrSyncs) && (nrReceivedFrames == nrFrames))
+        {
+            exitCode = EXIT_SUCCESS;
+        }
+        else
+        {
+            printf("Scanners or protocol reception disagree\n");
+            exitCode = EXIT_FAILURE;
+        }
+
+        free(pBuffer);
+    }
+    else
+    {
+        printf("Invalid input arguments, usage: syncScanBenchmark [STREAM_SIZE_MB]\n");
+        exitCode = EXIT_FAILURE;
+    }
+
+    return exitCode;
+}
@@ -56,6 +56,7 @@
 #include "sbgEComCmdMag.h"
 #include "sbgEComCmdOdo.h"
 #include "sbgEComCmdOutput.h"
+#include "sbgEComCmdPipeline.h"
 #include "sbgEComCmdSensor.h"
 #include "sbgEComCmdSettings.h"
 
@@ -8,6 +8,64 @@
 // Local headers
 #include "sbgEComCmdCommon.h"
 
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Wait until a frame may be received, or until a time out expires.
+ *
+ * The wait blocks on the interface so that the caller wakes up as soon as data is received. Interfaces that
+ * can't be waited on are polled every millisecond.
+ *
+ * \param[in]   pHandle                         A valid sbgECom handle.
+ * \param[in]   start                           Time at which the time out started, in us.
+ * \param[in]   timeOut                         Time out, in ms.
+ * \return                                      SBG_NO_ERROR if a frame may be received,
+ *                                              SBG_TIME_OUT if the time out has expired.
+ */
+static SbgErrorCode sbgEComCmdCommonWaitReadable(SbgEComHandle *pHandle, uint64_t start, uint32_t timeOut)
+{
+    SbgErrorCode                         errorCode;
+    uint64_t                             elapsed;
+
+    assert(pHandle);
+
+    elapsed = sbgGetTimeUs() - start;
+
+    if (elapsed < ((uint64_t)timeOut * 1000))
+    {
+        uint32_t                         remaining;
+
+        //
+        // Round the remaining time up so that the wait never ends before the time out
+        //
+        remaining = (uint32_t)((((uint64_t)timeOut * 1000) - elapsed + 999) / 1000);
+
+        errorCode = sbgEComProtocolWaitReadable(&pHandle->protocolHandle, remaining);
+
+        if ((errorCode != SBG_NO_ERROR) && (errorCode != SBG_TIME_OUT))
+        {
+            sbgSleep(1);
+        }
+
+        if ((sbgGetTimeUs() - start) >= ((uint64_t)timeOut * 1000))
+        {
+            errorCode = SBG_TIME_OUT;
+        }
+        else
+        {
+            errorCode = SBG_NO_ERROR;
+        }
+    }
+    else
+    {
+        errorCode = SBG_TIME_OUT;
+    }
+
+    return errorCode;
+}
+
 //----------------------------------------------------------------------//
 //- Common command reception operations                                -//
 //----------------------------------------------------------------------//
@@ -61,13 +119,13 @@ SbgErrorCode sbgEComReceiveAnyCmd(SbgEComHandle *pHandle, uint8_t *pMsgClass, ui
 SbgErrorCode sbgEComReceiveAnyCmd2(SbgEComHandle *pHandle, uint8_t *pMsgClass, uint8_t *pMsgId, SbgEComProtocolPayload *pPayload, uint32_t timeOut)
 {
     SbgErrorCode                         errorCode;
-    uint32_t                             start;
+    uint64_t                             start;
 
     assert(pHandle);
 
     if (timeOut > 0)
     {
-        start = sbgGetTime();
+        start = sbgGetTimeUs();
     }
     else
     {
@@ -81,7 +139,6 @@ SbgErrorCode sbgEComReceiveAnyCmd2(SbgEComHandle *pHandle, uint8_t *pMsgClass, u
     {
         uint8_t                          receivedMsgClass;
         uint8_t                          receivedMsgId;
-        uint32_t                         now;
 
         errorCode = sbgEComProtocolReceive2(&pHandle->protocolHandle, &receivedMsgClass, &receivedMsgId, pPayload);
 
@@ -89,7 +146,7 @@ SbgErrorCode sbgEComReceiveAnyCmd2(SbgEComHandle *pHandle, uint8_t *pMsgClass, u
         {
             if (sbgEComMsgClassIsALog((SbgEComClass)receivedMsgClass))
             {
-                if (pHandle->pReceiveLogCallback)
+                if (pHandle->pReceiveLogCallback || pHandle->pReceiveLogCallback2)
                 {
                     SbgEComLogUnion          logData;
 
@@ -97,7 +154,14 @@ SbgErrorCode sbgEComReceiveAnyCmd2(SbgEComHandle *pHandle, uint8_t *pMsgClass, u
 
                     if (errorCode == SBG_NO_ERROR)
                     {
-                        pHandle->pReceiveLogCallback(pHandle, (SbgEComClass)receivedMsgClass, receivedMsgId, &logData, pHandle->pUserArg);                      
+                        if (pHandle->pReceiveLogCallback2)
+                        {
+                            pHandle->pReceiveLogCallback2(pHandle, (SbgEComClass)receivedMsgClass, receivedMsgId, &logData, sbgEComProtocolGetReceiveTimestamp(&pHandle->protocolHandle), pHandle->pUserArg);
+                        }
+                        else
+                        {
+                            pHandle->pReceiveLogCallback(pHandle, (SbgEComClass)receivedMsgClass, receivedMsgId, &logData, pHandle->pUserArg);
+                        }
 
                         sbgEComLogCleanup(&logData, (SbgEComClass)receivedMsgClass, (SbgEComMsgId)receivedMsgId);
                     }
@@ -122,18 +186,19 @@ SbgErrorCode sbgEComReceiveAnyCmd2(SbgEComHandle *pHandle, uint8_t *pMsgClass, u
         if (timeOut > 0)
         {
             //
-            // Only sleep if the Rx buffer is empty, otherwise we should retry ASAP to drain it
+            // Only wait if the Rx buffer is empty, otherwise we should retry ASAP to drain it
             //
             if (errorCode == SBG_NOT_READY)
             {
-                sbgSleep(1);
+                errorCode = sbgEComCmdCommonWaitReadable(pHandle, start, timeOut);
             }
-
-            now = sbgGetTime();
-
-            if ((now - start) >= timeOut)
+            else if ((sbgGetTimeUs() - start) >= ((uint64_t)timeOut * 1000))
             {
                 errorCode = SBG_TIME_OUT;
+            }
+
+            if (errorCode == SBG_TIME_OUT)
+            {
                 break;
             }
         }
@@ -200,17 +265,16 @@ SbgErrorCode sbgEComReceiveCmd(SbgEComHandle *pHandle, uint8_t msgClass, uint8_t
 SbgErrorCode sbgEComReceiveCmd2(SbgEComHandle *pHandle, uint8_t msgClass, uint8_t msgId, SbgEComProtocolPayload *pPayload, uint32_t timeOut)
 {
     SbgErrorCode                         errorCode;
-    uint32_t                             start;
+    uint64_t                             start;
 
     assert(pHandle);
 
-    start = sbgGetTime();
+    start = sbgGetTimeUs();
 
     for (;;)
     {
         uint8_t                          receivedMsgClass;
         uint8_t                          receivedMsgId;
-        uint32_t                         now;
 
         errorCode = sbgEComReceiveAnyCmd2(pHandle, &receivedMsgClass, &receivedMsgId, pPayload, 0);
 
@@ -256,12 +320,20 @@ SbgErrorCode sbgEComReceiveCmd2(SbgEComHandle *pHandle, uint8_t msgClass, uint8_
         }
         else if (errorCode == SBG_NOT_READY)
         {
-            sbgSleep(1);
+            //
+            // Block until the answer may have been received instead of polling
+            //
+            if (sbgEComCmdCommonWaitReadable(pHandle, start, timeOut) == SBG_TIME_OUT)
+            {
+                errorCode = SBG_TIME_OUT;
+                break;
+            }
         }
-        
-        now = sbgGetTime();
 
-        if ((now - start) >= timeOut)
+        //
+        // Logs are reported as SBG_TIME_OUT by sbgEComReceiveAnyCmd2(), only the elapsed time ends the wait
+        //
+        if ((sbgGetTimeUs() - start) >= ((uint64_t)timeOut * 1000))
         {
             errorCode = SBG_TIME_OUT;
             break;
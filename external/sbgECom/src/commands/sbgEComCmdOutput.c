@@ -8,6 +8,116 @@
 // Local headers
 #include "sbgEComCmdCommon.h"
 #include "sbgEComCmdOutput.h"
+#include "sbgEComCmdPipeline.h"
+
+//----------------------------------------------------------------------//
+//- Private definitions                                                -//
+//----------------------------------------------------------------------//
+
+#define SBG_ECOM_CMD_OUTPUT_CONF_SIZE       (5)         /*!< Size of an output configuration payload, in bytes. */
+
+/*!
+ * Buffers of a pipelined output configuration command.
+ */
+typedef struct _SbgEComCmdOutputConfBuffers
+{
+    uint8_t                 request[SBG_ECOM_CMD_OUTPUT_CONF_SIZE];     /*!< Request payload. */
+    uint8_t                 answer[SBG_ECOM_CMD_OUTPUT_CONF_SIZE];      /*!< Answer payload. */
+} SbgEComCmdOutputConfBuffers;
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Get or set the configuration of several messages with pipelined commands.
+ *
+ * \param[in]   pHandle                     A valid sbgECom handle.
+ * \param[in]   outputPort                  The output port of the device for the logs concerned.
+ * \param[in]   pEntries                    Messages, output modes and results.
+ * \param[in]   nrEntries                   Number of messages.
+ * \param[in]   set                         True to set the output modes, false to retrieve them.
+ * \return                                  SBG_NO_ERROR if all the commands have been executed successfully.
+ */
+static SbgErrorCode sbgEComCmdOutputExecuteConfs(SbgEComHandle *pHandle, SbgEComOutputPort outputPort, SbgEComOutputConfEntry *pEntries, size_t nrEntries, bool set)
+{
+    SbgErrorCode                     errorCode = SBG_NO_ERROR;
+    SbgEComCmdPipelineRequest       *pRequests;
+    SbgEComCmdOutputConfBuffers     *pBuffers;
+
+    assert(pHandle);
+    assert(pEntries || (nrEntries == 0));
+
+    if (nrEntries != 0)
+    {
+        pRequests   = malloc(nrEntries * sizeof(*pRequests));
+        pBuffers    = malloc(nrEntries * sizeof(*pBuffers));
+
+        if (pRequests && pBuffers)
+        {
+            for (size_t i = 0; i < nrEntries; i++)
+            {
+                SbgStreamBuffer          outputStream;
+
+                sbgStreamBufferInitForWrite(&outputStream, pBuffers[i].request, sizeof(pBuffers[i].request));
+
+                sbgStreamBufferWriteUint8LE(&outputStream, (uint8_t)outputPort);
+                sbgStreamBufferWriteUint8LE(&outputStream, (uint8_t)pEntries[i].msgId);
+                sbgStreamBufferWriteUint8LE(&outputStream, (uint8_t)pEntries[i].classId);
+
+                if (set)
+                {
+                    sbgStreamBufferWriteUint16LE(&outputStream, (uint16_t)pEntries[i].mode);
+                }
+
+                sbgEComCmdPipelineRequestInit(&pRequests[i], SBG_ECOM_CLASS_LOG_CMD_0, SBG_ECOM_CMD_OUTPUT_CONF, pBuffers[i].request, sbgStreamBufferGetLength(&outputStream), set);
+
+                //
+                // The answer repeats the output port and message, so that each answer is matched to its request
+                //
+                if (!set)
+                {
+                    pRequests[i].matchSize      = 3;
+                    pRequests[i].pAnswer        = pBuffers[i].answer;
+                    pRequests[i].answerMaxSize  = sizeof(pBuffers[i].answer);
+                }
+            }
+
+            errorCode = sbgEComCmdPipelineExecute(pHandle, pRequests, nrEntries, SBG_ECOM_CMD_PIPELINE_DEFAULT_WINDOW);
+
+            for (size_t i = 0; i < nrEntries; i++)
+            {
+                pEntries[i].errorCode = pRequests[i].errorCode;
+
+                if (!set && (pEntries[i].errorCode == SBG_NO_ERROR))
+                {
+                    SbgStreamBuffer      inputStream;
+
+                    sbgStreamBufferInitForRead(&inputStream, pBuffers[i].answer, pRequests[i].answerSize);
+                    sbgStreamBufferSeek(&inputStream, 3, SB_SEEK_SET);
+
+                    pEntries[i].mode        = (SbgEComOutputMode)sbgStreamBufferReadUint16LE(&inputStream);
+                    pEntries[i].errorCode   = sbgStreamBufferGetLastError(&inputStream);
+
+                    if ((errorCode == SBG_NO_ERROR) && (pEntries[i].errorCode != SBG_NO_ERROR))
+                    {
+                        errorCode = pEntries[i].errorCode;
+                    }
+                }
+            }
+        }
+        else
+        {
+            errorCode = SBG_MALLOC_FAILED;
+            SBG_LOG_ERROR(errorCode, "unable to allocate %zu output configuration commands", nrEntries);
+        }
+
+        free(pRequests);
+        free(pBuffers);
+    }
+
+    return errorCode;
+}
 
 //----------------------------------------------------------------------//
 //- Public methods                                                     -//
@@ -157,6 +267,16 @@ SbgErrorCode sbgEComCmdOutputSetConf(SbgEComHandle *pHandle, SbgEComOutputPort o
     return errorCode;
 }
 
+SbgErrorCode sbgEComCmdOutputGetConfs(SbgEComHandle *pHandle, SbgEComOutputPort outputPort, SbgEComOutputConfEntry *pEntries, size_t nrEntries)
+{
+    return sbgEComCmdOutputExecuteConfs(pHandle, outputPort, pEntries, nrEntries, false);
+}
+
+SbgErrorCode sbgEComCmdOutputSetConfs(SbgEComHandle *pHandle, SbgEComOutputPort outputPort, SbgEComOutputConfEntry *pEntries, size_t nrEntries)
+{
+    return sbgEComCmdOutputExecuteConfs(pHandle, outputPort, pEntries, nrEntries, true);
+}
+
 SbgErrorCode sbgEComCmdOutputClassGetEnable(SbgEComHandle *pHandle, SbgEComOutputPort outputPort, SbgEComClass classId, bool *pEnable)
 {
     SbgErrorCode            errorCode = SBG_NO_ERROR;
@@ -104,6 +104,17 @@ typedef enum _SbgEComOutputMonitoringPoint
     SBG_ECOM_OUTPUT_MONITORING_NUM                      /*!< Number of output monitoring points. */
 } SbgEComOutputMonitoringPoint;
 
+/*!
+ * Output configuration of one message, used to get or set the configuration of several messages at once.
+ */
+typedef struct _SbgEComOutputConfEntry
+{
+    SbgEComClass            classId;                /*!< The class of the concerned log. */
+    SbgEComMsgId            msgId;                  /*!< The id of the concerned log. */
+    SbgEComOutputMode       mode;                   /*!< Output mode of the message. */
+    SbgErrorCode            errorCode;              /*!< Result of the command for this message. */
+} SbgEComOutputConfEntry;
+
 //----------------------------------------------------------------------//
 //- Public methods                                                     -//
 //----------------------------------------------------------------------//
@@ -132,6 +143,34 @@ SbgErrorCode sbgEComCmdOutputGetConf(SbgEComHandle *pHandle, SbgEComOutputPort o
  */
 SbgErrorCode sbgEComCmdOutputSetConf(SbgEComHandle *pHandle, SbgEComOutputPort outputPort, SbgEComClass classId, SbgEComMsgId msgId, SbgEComOutputMode mode);
 
+/*!
+ * Retrieve the configuration of several messages for an output interface.
+ *
+ * The commands are pipelined, so that all the configurations are retrieved in about one link round trip.
+ *
+ * \param[in]   pHandle                     A valid sbgECom handle.
+ * \param[in]   outputPort                  The output port of the device for the logs concerned.
+ * \param[in]   pEntries                    Messages, the output mode and the result of each command are set on return.
+ * \param[in]   nrEntries                   Number of messages.
+ * \return                                  SBG_NO_ERROR if all the commands have been executed successfully,
+ *                                          the error of the first failed command otherwise.
+ */
+SbgErrorCode sbgEComCmdOutputGetConfs(SbgEComHandle *pHandle, SbgEComOutputPort outputPort, SbgEComOutputConfEntry *pEntries, size_t nrEntries);
+
+/*!
+ * Set the configuration of several messages for an output interface.
+ *
+ * The commands are pipelined, so that all the configurations are set in about one link round trip.
+ *
+ * \param[in]   pHandle                     A valid sbgECom handle.
+ * \param[in]   outputPort                  The output port of the device for the logs concerned.
+ * \param[in]   pEntries                    Messages and output modes to set, the result of each command is set on return.
+ * \param[in]   nrEntries                   Number of messages.
+ * \return                                  SBG_NO_ERROR if all the commands have been executed successfully,
+ *                                          the error of the first failed command otherwise.
+ */
+SbgErrorCode sbgEComCmdOutputSetConfs(SbgEComHandle *pHandle, SbgEComOutputPort outputPort, SbgEComOutputConfEntry *pEntries, size_t nrEntries);
+
 /*!
  * Retrieve if a whole message class is enabled or not for an output interface.
  *
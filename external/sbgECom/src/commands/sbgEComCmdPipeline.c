@@ -0,0 +1,507 @@
+﻿// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <streamBuffer/sbgStreamBuffer.h>
+
+// Project headers
+#include <sbgECom.h>
+
+// Local headers
+#include "sbgEComCmdCommon.h"
+#include "sbgEComCmdPipeline.h"
+
+//----------------------------------------------------------------------//
+//- Private definitions                                                -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Pipeline request states.
+ */
+typedef enum _SbgEComCmdPipelineState
+{
+    SBG_ECOM_CMD_PIPELINE_STATE_PENDING     = 0,    /*!< The command has to be sent. */
+    SBG_ECOM_CMD_PIPELINE_STATE_SENT        = 1,    /*!< The command has been sent, its answer is expected. */
+    SBG_ECOM_CMD_PIPELINE_STATE_DONE        = 2,    /*!< The command has been executed, or has timed out. */
+    SBG_ECOM_CMD_PIPELINE_STATE_SEND_FAILED = 3     /*!< The command couldn't be sent, it has failed. */
+} SbgEComCmdPipelineState;
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Check if another request with the same class and ID is outstanding.
+ *
+ * \param[in]   pRequests                   Requests.
+ * \param[in]   nrRequests                  Number of requests.
+ * \param[in]   pRequest                    Request.
+ * \return                                  True if another request with the same class and ID is outstanding.
+ */
+static bool sbgEComCmdPipelineHasOutstandingSibling(const SbgEComCmdPipelineRequest *pRequests, size_t nrRequests, const SbgEComCmdPipelineRequest *pRequest)
+{
+    bool                                outstanding = false;
+
+    assert(pRequests);
+    assert(pRequest);
+
+    for (size_t i = 0; i < nrRequests; i++)
+    {
+        if ((&pRequests[i] != pRequest) && (pRequests[i].state == SBG_ECOM_CMD_PIPELINE_STATE_SENT) && (pRequests[i].msgClass == pRequest->msgClass) && (pRequests[i].msgId == pRequest->msgId))
+        {
+            outstanding = true;
+            break;
+        }
+    }
+
+    return outstanding;
+}
+
+/*!
+ * Get the time until which late answers to the requests with the same class and ID may be received.
+ *
+ * Answers matched in order, including the NACKs of commands answered by a frame, don't tell which send they
+ * answer. When more commands with a class and ID have been sent than answers received, apart from the commands
+ * still outstanding, the missing answers may still be received late, and would be matched to the next request sent. Such requests are thus not sent until one time
+ * out has elapsed since the last send, answers received meanwhile don't match any request and are dropped.
+ *
+ * \param[in]   pHandle                     A valid sbgECom handle.
+ * \param[in]   pRequests                   Requests.
+ * \param[in]   nrRequests                  Number of requests.
+ * \param[in]   pRequest                    Request.
+ * \return                                  Time until which late answers may be received, in us, 0 if none.
+ */
+static uint64_t sbgEComCmdPipelineGetLateAnswersEnd(const SbgEComHandle *pHandle, const SbgEComCmdPipelineRequest *pRequests, size_t nrRequests, const SbgEComCmdPipelineRequest *pRequest)
+{
+    uint64_t                            lateAnswersEnd = 0;
+    uint32_t                            nrMissingAnswers = 0;
+
+    assert(pHandle);
+    assert(pRequests);
+    assert(pRequest);
+
+    for (size_t i = 0; i < nrRequests; i++)
+    {
+        if ((pRequests[i].msgClass == pRequest->msgClass) && (pRequests[i].msgId == pRequest->msgId) && (pRequests[i].nrSent != 0))
+        {
+            nrMissingAnswers += pRequests[i].nrSent - pRequests[i].nrAnswers;
+
+            if (pRequests[i].state == SBG_ECOM_CMD_PIPELINE_STATE_SENT)
+            {
+                nrMissingAnswers--;
+            }
+            else
+            {
+                lateAnswersEnd = sbgMax(lateAnswersEnd, pRequests[i].sendTime + (uint64_t)pHandle->cmdDefaultTimeOut * 1000);
+            }
+        }
+    }
+
+    if (nrMissingAnswers == 0)
+    {
+        lateAnswersEnd = 0;
+    }
+
+    return lateAnswersEnd;
+}
+
+/*!
+ * Find the oldest outstanding request matching an answer.
+ *
+ * \param[in]   pRequests                   Requests.
+ * \param[in]   nrRequests                  Number of requests.
+ * \param[in]   msgClass                    Message class of the command answered.
+ * \param[in]   msgId                       Message ID of the command answered.
+ * \param[in]   pAnswer                     Answer payload, NULL if the answer is an ACK.
+ * \param[in]   answerSize                  Answer payload size, in bytes.
+ * \return                                  Matching request, NULL if none.
+ */
+static SbgEComCmdPipelineRequest *sbgEComCmdPipelineFindRequest(SbgEComCmdPipelineRequest *pRequests, size_t nrRequests, uint8_t msgClass, uint8_t msgId, const uint8_t *pAnswer, size_t answerSize)
+{
+    SbgEComCmdPipelineRequest          *pMatchingRequest = NULL;
+
+    assert(pRequests);
+
+    //
+    // The device executes commands in order, so the oldest request sent is the one answered
+    //
+    for (size_t i = 0; i < nrRequests; i++)
+    {
+        SbgEComCmdPipelineRequest      *pRequest = &pRequests[i];
+
+        if ((pRequest->state == SBG_ECOM_CMD_PIPELINE_STATE_SENT) && (pRequest->msgClass == msgClass) && (pRequest->msgId == msgId))
+        {
+            if (!pAnswer)
+            {
+                pMatchingRequest = pRequest;
+            }
+            else if (!pRequest->ackExpected)
+            {
+                if ((pRequest->matchSize == 0) || ((answerSize >= pRequest->matchSize) && (memcmp(pAnswer, pRequest->pPayload, pRequest->matchSize) == 0)))
+                {
+                    pMatchingRequest = pRequest;
+                }
+            }
+        }
+
+        if (pMatchingRequest)
+        {
+            break;
+        }
+    }
+
+    return pMatchingRequest;
+}
+
+/*!
+ * Process a command frame received while executing a pipeline.
+ *
+ * \param[in]   pRequests                   Requests.
+ * \param[in]   nrRequests                  Number of requests.
+ * \param[in]   msgClass                    Received message class.
+ * \param[in]   msgId                       Received message ID.
+ * \param[in]   pPayload                    Received payload.
+ * \return                                  Request completed by the frame, NULL if none.
+ */
+static SbgEComCmdPipelineRequest *sbgEComCmdPipelineProcessFrame(SbgEComCmdPipelineRequest *pRequests, size_t nrRequests, uint8_t msgClass, uint8_t msgId, const SbgEComProtocolPayload *pPayload)
+{
+    SbgEComCmdPipelineRequest          *pRequest;
+    const uint8_t                      *pBuffer;
+    size_t                              size;
+
+    assert(pPayload);
+
+    pBuffer = sbgEComProtocolPayloadGetBuffer(pPayload);
+    size    = sbgEComProtocolPayloadGetSize(pPayload);
+
+    if ((msgClass == SBG_ECOM_CLASS_LOG_CMD_0) && (msgId == SBG_ECOM_CMD_ACK))
+    {
+        SbgStreamBuffer                 inputStream;
+        uint8_t                         ackMsgClass;
+        uint8_t                         ackMsgId;
+        SbgErrorCode                    ackErrorCode;
+
+        sbgStreamBufferInitForRead(&inputStream, pBuffer, size);
+
+        ackMsgId        = sbgStreamBufferReadUint8LE(&inputStream);
+        ackMsgClass     = sbgStreamBufferReadUint8LE(&inputStream);
+        ackErrorCode    = (SbgErrorCode)sbgStreamBufferReadUint16LE(&inputStream);
+
+        if (sbgStreamBufferGetLastError(&inputStream) == SBG_NO_ERROR)
+        {
+            pRequest = sbgEComCmdPipelineFindRequest(pRequests, nrRequests, ackMsgClass, ackMsgId, NULL, 0);
+
+            if (pRequest)
+            {
+                pRequest->payloadMatched = false;
+
+                if (pRequest->ackExpected)
+                {
+                    pRequest->errorCode = ackErrorCode;
+                }
+                else
+                {
+                    //
+                    // A successful ACK is never expected for a command answered by a frame
+                    //
+                    pRequest->errorCode = (ackErrorCode != SBG_NO_ERROR) ? ackErrorCode : SBG_ERROR;
+                }
+            }
+        }
+        else
+        {
+            SBG_LOG_WARNING(SBG_INVALID_FRAME, "payload size is invalid for an ACK.");
+            pRequest = NULL;
+        }
+    }
+    else
+    {
+        pRequest = sbgEComCmdPipelineFindRequest(pRequests, nrRequests, msgClass, msgId, pBuffer, size);
+
+        if (pRequest)
+        {
+            pRequest->payloadMatched    = (pRequest->matchSize != 0);
+            pRequest->answerSize        = size;
+
+            if (!pRequest->pAnswer)
+            {
+                pRequest->errorCode = SBG_NO_ERROR;
+            }
+            else if (size <= pRequest->answerMaxSize)
+            {
+                memcpy(pRequest->pAnswer, pBuffer, size);
+                pRequest->errorCode = SBG_NO_ERROR;
+            }
+            else
+            {
+                pRequest->errorCode = SBG_BUFFER_OVERFLOW;
+            }
+        }
+    }
+
+    return pRequest;
+}
+
+/*!
+ * Send again the requests with the same class and ID as a request that has timed out.
+ *
+ * ACKs, and answers that aren't matched on the payload, are assigned to the oldest request sent. NACKs don't carry
+ * the payload either, so a NACK may be assigned to another request whose answer is matched on the payload. When a
+ * command or its answer is lost, the following answers are thus assigned to the wrong requests and the last one
+ * times out instead of the lost one. As the lost request can't be identified, all the completed requests that may
+ * have been assigned a wrong answer, that is all those not matched on the payload, are sent again. The outstanding requests are sent again too, as they could be assigned
+ * the late answer of the request that has timed out. These requests may not have failed, so this doesn't count as
+ * a trial.
+ *
+ * Requests sent once the commands are serialized are matched to their own answer, and aren't sent again.
+ * Requests that couldn't be sent have no answer to reassign, and aren't sent again either.
+ *
+ * \param[in]   pRequests                   Requests.
+ * \param[in]   nrRequests                  Number of requests.
+ * \param[in]   pTimedOutRequest            Request that has timed out.
+ * \param[in]   serializedTime              Time at which the commands have been serialized, in us.
+ * \param[in]   pNrOutstanding              Number of outstanding requests, updated.
+ * \param[in]   pNrDone                     Number of completed requests, updated.
+ */
+static void sbgEComCmdPipelineResendSiblings(SbgEComCmdPipelineRequest *pRequests, size_t nrRequests, const SbgEComCmdPipelineRequest *pTimedOutRequest, uint64_t serializedTime, size_t *pNrOutstanding, size_t *pNrDone)
+{
+    assert(pRequests);
+    assert(pTimedOutRequest);
+    assert(pNrOutstanding);
+    assert(pNrDone);
+
+    for (size_t i = 0; i < nrRequests; i++)
+    {
+        SbgEComCmdPipelineRequest      *pRequest = &pRequests[i];
+
+        if ((pRequest != pTimedOutRequest) && (pRequest->nrSent != 0) &&
+            (pRequest->msgClass == pTimedOutRequest->msgClass) && (pRequest->msgId == pTimedOutRequest->msgId))
+        {
+            if (pRequest->state == SBG_ECOM_CMD_PIPELINE_STATE_SENT)
+            {
+                pRequest->state     = SBG_ECOM_CMD_PIPELINE_STATE_PENDING;
+                pRequest->trial--;
+                (*pNrOutstanding)--;
+            }
+            else if ((pRequest->state == SBG_ECOM_CMD_PIPELINE_STATE_DONE) && !pRequest->payloadMatched && (pRequest->sendTime < serializedTime))
+            {
+                pRequest->state     = SBG_ECOM_CMD_PIPELINE_STATE_PENDING;
+                pRequest->errorCode = SBG_NOT_READY;
+                pRequest->trial--;
+                (*pNrDone)--;
+            }
+        }
+    }
+}
+
+/*!
+ * Wait until a frame may be received, until the next outstanding command times out, or until late answers
+ * can no longer be received.
+ *
+ * \param[in]   pHandle                     A valid sbgECom handle.
+ * \param[in]   pRequests                   Requests.
+ * \param[in]   nrRequests                  Number of requests.
+ */
+static void sbgEComCmdPipelineWait(SbgEComHandle *pHandle, const SbgEComCmdPipelineRequest *pRequests, size_t nrRequests)
+{
+    SbgErrorCode                        errorCode;
+    uint64_t                            deadline;
+    uint64_t                            now;
+
+    assert(pHandle);
+    assert(pRequests);
+
+    deadline    = UINT64_MAX;
+    now         = sbgGetTimeUs();
+
+    for (size_t i = 0; i < nrRequests; i++)
+    {
+        uint64_t                        timeOutTime;
+
+        timeOutTime = pRequests[i].sendTime + (uint64_t)pHandle->cmdDefaultTimeOut * 1000;
+
+        if ((pRequests[i].state == SBG_ECOM_CMD_PIPELINE_STATE_SENT) ||
+            ((pRequests[i].nrSent != 0) && (timeOutTime > now)))
+        {
+            deadline = sbgMin(deadline, timeOutTime);
+        }
+    }
+
+    if ((deadline != UINT64_MAX) && (deadline > now))
+    {
+        //
+        // Round the remaining time up so that the wait never ends before the time out
+        //
+        errorCode = sbgEComProtocolWaitReadable(&pHandle->protocolHandle, (uint32_t)sbgMin((deadline - now + 999) / 1000, UINT32_MAX));
+
+        if ((errorCode != SBG_NO_ERROR) && (errorCode != SBG_TIME_OUT))
+        {
+            sbgSleep(1);
+        }
+    }
+}
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+void sbgEComCmdPipelineRequestInit(SbgEComCmdPipelineRequest *pRequest, uint8_t msgClass, uint8_t msgId, const void *pPayload, size_t payloadSize, bool ackExpected)
+{
+    assert(pRequest);
+    assert(pPayload || (payloadSize == 0));
+
+    memset(pRequest, 0, sizeof(*pRequest));
+
+    pRequest->msgClass      = msgClass;
+    pRequest->msgId         = msgId;
+    pRequest->pPayload      = pPayload;
+    pRequest->payloadSize   = payloadSize;
+    pRequest->ackExpected   = ackExpected;
+    pRequest->errorCode     = SBG_NOT_READY;
+}
+
+SbgErrorCode sbgEComCmdPipelineExecute(SbgEComHandle *pHandle, SbgEComCmdPipelineRequest *pRequests, size_t nrRequests, size_t windowSize)
+{
+    SbgErrorCode                        errorCode = SBG_NO_ERROR;
+    SbgEComProtocolPayload              receivedPayload;
+    size_t                              nrOutstanding;
+    size_t                              nrDone;
+    bool                                serialized;
+    uint64_t                            serializedTime;
+
+    assert(pHandle);
+    assert(pRequests || (nrRequests == 0));
+    assert(windowSize > 0);
+
+    sbgEComProtocolPayloadConstruct(&receivedPayload);
+
+    for (size_t i = 0; i < nrRequests; i++)
+    {
+        pRequests[i].state          = SBG_ECOM_CMD_PIPELINE_STATE_PENDING;
+        pRequests[i].trial          = 0;
+        pRequests[i].nrSent         = 0;
+        pRequests[i].nrAnswers      = 0;
+        pRequests[i].sendTime       = 0;
+        pRequests[i].payloadMatched = false;
+        pRequests[i].answerSize     = 0;
+        pRequests[i].errorCode      = SBG_NOT_READY;
+    }
+
+    nrOutstanding   = 0;
+    nrDone          = 0;
+    serialized      = false;
+    serializedTime  = 0;
+
+    while (nrDone < nrRequests)
+    {
+        SbgErrorCode                    receiveErrorCode;
+        uint8_t                         receivedMsgClass;
+        uint8_t                         receivedMsgId;
+        uint64_t                        now;
+
+        //
+        // Send the pending commands in order, as long as the window isn't full
+        // Once an answer has been lost, commands are no longer sent while another one with the same class
+        // and ID is outstanding, or may still be answered late, so that each answer, or NACK, is matched
+        // to its request
+        //
+        now = sbgGetTimeUs();
+
+        for (size_t i = 0; (i < nrRequests) && (nrOutstanding < windowSize); i++)
+        {
+            SbgEComCmdPipelineRequest  *pRequest = &pRequests[i];
+
+            if ((pRequest->state == SBG_ECOM_CMD_PIPELINE_STATE_PENDING) &&
+                (!serialized ||
+                 (!sbgEComCmdPipelineHasOutstandingSibling(pRequests, nrRequests, pRequest) && (sbgEComCmdPipelineGetLateAnswersEnd(pHandle, pRequests, nrRequests, pRequest) <= now))))
+            {
+                pRequest->trial++;
+
+                pRequest->errorCode = sbgEComProtocolSend(&pHandle->protocolHandle, pRequest->msgClass, pRequest->msgId, pRequest->pPayload, pRequest->payloadSize);
+
+                if (pRequest->errorCode == SBG_NO_ERROR)
+                {
+                    pRequest->state     = SBG_ECOM_CMD_PIPELINE_STATE_SENT;
+                    pRequest->sendTime  = sbgGetTimeUs();
+                    pRequest->errorCode = SBG_NOT_READY;
+                    pRequest->nrSent++;
+                    nrOutstanding++;
+                }
+                else
+                {
+                    pRequest->state = SBG_ECOM_CMD_PIPELINE_STATE_SEND_FAILED;
+                    nrDone++;
+                }
+            }
+        }
+
+        //
+        // Match the received answers, logs are reported to the receive log callback
+        //
+        receiveErrorCode = sbgEComReceiveAnyCmd2(pHandle, &receivedMsgClass, &receivedMsgId, &receivedPayload, 0);
+
+        if (receiveErrorCode == SBG_NO_ERROR)
+        {
+            SbgEComCmdPipelineRequest  *pRequest;
+
+            pRequest = sbgEComCmdPipelineProcessFrame(pRequests, nrRequests, receivedMsgClass, receivedMsgId, &receivedPayload);
+
+            if (pRequest)
+            {
+                pRequest->state = SBG_ECOM_CMD_PIPELINE_STATE_DONE;
+                pRequest->nrAnswers++;
+                nrOutstanding--;
+                nrDone++;
+            }
+        }
+        else if ((receiveErrorCode == SBG_NOT_READY) && (nrDone < nrRequests))
+        {
+            sbgEComCmdPipelineWait(pHandle, pRequests, nrRequests);
+        }
+
+        //
+        // Resend the commands that timed out, or report them as failed once all trials are exhausted
+        //
+        now = sbgGetTimeUs();
+
+        for (size_t i = 0; i < nrRequests; i++)
+        {
+            SbgEComCmdPipelineRequest  *pRequest = &pRequests[i];
+
+            if ((pRequest->state == SBG_ECOM_CMD_PIPELINE_STATE_SENT) && ((now - pRequest->sendTime) >= ((uint64_t)pHandle->cmdDefaultTimeOut * 1000)))
+            {
+                nrOutstanding--;
+
+                if (pRequest->trial < pHandle->numTrials)
+                {
+                    pRequest->state = SBG_ECOM_CMD_PIPELINE_STATE_PENDING;
+                }
+                else
+                {
+                    pRequest->state     = SBG_ECOM_CMD_PIPELINE_STATE_DONE;
+                    pRequest->errorCode = SBG_TIME_OUT;
+                    nrDone++;
+                }
+
+                if (!serialized)
+                {
+                    serialized      = true;
+                    serializedTime  = now;
+                }
+
+                sbgEComCmdPipelineResendSiblings(pRequests, nrRequests, pRequest, serializedTime, &nrOutstanding, &nrDone);
+            }
+        }
+    }
+
+    sbgEComProtocolPayloadDestroy(&receivedPayload);
+
+    for (size_t i = 0; i < nrRequests; i++)
+    {
+        if (pRequests[i].errorCode != SBG_NO_ERROR)
+        {
+            errorCode = pRequests[i].errorCode;
+            break;
+        }
+    }
+
+    return errorCode;
+}
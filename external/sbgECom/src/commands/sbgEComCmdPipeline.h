@@ -0,0 +1,125 @@
+/*!
+ * \file            sbgEComCmdPipeline.h
+ * \ingroup         commands
+ * \author          SBG Systems
+ * \date            16 October 2026
+ *
+ * \brief           Execute several commands with multiple outstanding requests.
+ *
+ * Commands are sent back to back within a window, and answers are matched
+ * as they are received. A list of commands thus only costs about one link
+ * round trip instead of one round trip per command.
+ *
+ * The device processes commands in order, answers with the same class and ID,
+ * or ACKs for the same command, are thus matched in the order the commands
+ * have been sent. Answers can also be matched on the leading bytes of the
+ * request payload, to remain correct when a frame is lost. A NACK only
+ * carries the class and ID of the command, so it's always matched in order,
+ * even for a command whose answer is matched on the payload.
+ *
+ * \copyright       Copyright (C) 2007-2024, SBG Systems SAS. All rights reserved.
+ * \beginlicense    The MIT license
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * \endlicense
+ */
+
+#ifndef SBG_ECOM_CMD_PIPELINE_H
+#define SBG_ECOM_CMD_PIPELINE_H
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// Project headers
+#include <sbgECom.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------//
+//- Public definitions                                                 -//
+//----------------------------------------------------------------------//
+
+#define SBG_ECOM_CMD_PIPELINE_DEFAULT_WINDOW    (8)     /*!< Default number of outstanding commands, small enough for the device input buffer. */
+
+/*!
+ * Command request executed by a pipeline.
+ *
+ * The request and answer buffers are owned by the caller and must remain valid until the pipeline has been executed.
+ */
+typedef struct _SbgEComCmdPipelineRequest
+{
+    uint8_t                  msgClass;              /*!< Command message class. */
+    uint8_t                  msgId;                 /*!< Command message ID. */
+    const void              *pPayload;              /*!< Command payload, NULL if empty. */
+    size_t                   payloadSize;           /*!< Command payload size, in bytes. */
+    size_t                   matchSize;             /*!< Number of leading payload bytes repeated by the answer, 0 to only match the class and ID. */
+    bool                     ackExpected;           /*!< True if the command is answered by an ACK, false if answered by a frame with the same class and ID. */
+
+    void                    *pAnswer;               /*!< Buffer receiving the answer payload, NULL to discard it. */
+    size_t                   answerMaxSize;         /*!< Answer buffer size, in bytes. */
+    size_t                   answerSize;            /*!< Answer payload size, in bytes. */
+    SbgErrorCode             errorCode;             /*!< Command result. */
+
+    uint32_t                 state;                 /*!< Internal state, set by the pipeline. */
+    uint32_t                 trial;                 /*!< Number of times the command has been sent, set by the pipeline. */
+    uint32_t                 nrSent;                /*!< Number of times the command has actually been sent, send failures excluded, set by the pipeline. */
+    uint32_t                 nrAnswers;             /*!< Number of answers matched to the command, set by the pipeline. */
+    bool                     payloadMatched;        /*!< True if the last answer has been matched on the payload, set by the pipeline. */
+    uint64_t                 sendTime;              /*!< Time at which the command has been sent for the last time, in us, set by the pipeline. */
+} SbgEComCmdPipelineRequest;
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Initialize a pipeline request.
+ *
+ * \param[out]  pRequest                    Request.
+ * \param[in]   msgClass                    Command message class.
+ * \param[in]   msgId                       Command message ID.
+ * \param[in]   pPayload                    Command payload, NULL if empty.
+ * \param[in]   payloadSize                 Command payload size, in bytes.
+ * \param[in]   ackExpected                 True if the command is answered by an ACK, false if answered by a frame with the same class and ID.
+ */
+void sbgEComCmdPipelineRequestInit(SbgEComCmdPipelineRequest *pRequest, uint8_t msgClass, uint8_t msgId, const void *pPayload, size_t payloadSize, bool ackExpected);
+
+/*!
+ * Execute a list of commands, keeping up to windowSize commands outstanding.
+ *
+ * Each command is retried pHandle->numTrials times, with a time out of pHandle->cmdDefaultTimeOut.
+ * Logs received meanwhile are reported to the receive log callback.
+ *
+ * \param[in]   pHandle                     A valid sbgECom handle.
+ * \param[in]   pRequests                   Requests, in sending order, results are set in each request.
+ * \param[in]   nrRequests                  Number of requests.
+ * \param[in]   windowSize                  Maximum number of outstanding commands, 1 to execute the commands one after another.
+ * \return                                  SBG_NO_ERROR if all the commands have been executed successfully,
+ *                                          the error of the first failed command otherwise.
+ */
+SbgErrorCode sbgEComCmdPipelineExecute(SbgEComHandle *pHandle, SbgEComCmdPipelineRequest *pRequests, size_t nrRequests, size_t windowSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_ECOM_CMD_PIPELINE_H
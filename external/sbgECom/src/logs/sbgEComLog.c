@@ -32,6 +32,142 @@
 #include "sbgEComLogVelocity.h"
 #include "sbgEComLogVibMon.h"
 
+//----------------------------------------------------------------------//
+//- Private functions                                                  -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Define a decoder function that reads a log from a stream into the given member of the log union.
+ *
+ * \param[in]   name                        Decoder function name suffix.
+ * \param[in]   readFunc                    Function used to read the log from a stream.
+ * \param[in]   member                      Member of the log union.
+ */
+#define SBG_ECOM_LOG_DEFINE_PARSE_FUNC(name, readFunc, member)                                              \
+    static SbgErrorCode sbgEComLogParse##name(SbgEComLogUnion *pLogData, SbgStreamBuffer *pStreamBuffer)    \
+    {                                                                                                       \
+        assert(pLogData);                                                                                   \
+                                                                                                            \
+        return readFunc(&pLogData->member, pStreamBuffer);                                                  \
+    }
+
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(Status,         sbgEComLogStatusReadFromStream,                 statusData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(ImuLegacy,      sbgEComLogImuLegacyReadFromStream,              imuData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(ImuShort,       sbgEComLogImuShortReadFromStream,               imuShort)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(EkfEuler,       sbgEComLogEkfEulerReadFromStream,               ekfEulerData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(EkfQuat,        sbgEComLogEkfQuatReadFromStream,                ekfQuatData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(EkfNav,         sbgEComLogEkfNavReadFromStream,                 ekfNavData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(EkfVelBody,     sbgEComLogEkfVelBodyReadFromStream,             ekfVelBody)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(EkfRotAccel,    sbgEComLogEkfRotAccelReadFromStream,            ekfRotAccel)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(ShipMotion,     sbgEComLogShipMotionReadFromStream,             shipMotionData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(Odometer,       sbgEComLogOdometerReadFromStream,               odometerData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(Utc,            sbgEComLogUtcReadFromStream,                    utcData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(Ptp,            sbgEComLogPtpReadFromStream,                    ptpData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(VibMonFft,      sbgEComLogVibMonFftReadFromStream,              vibMonFft)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(VibMonReport,   sbgEComLogVibMonReportReadFromStream,           vibMonReport)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(GnssVel,        sbgEComLogGnssVelReadFromStream,                gpsVelData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(GnssPos,        sbgEComLogGnssPosReadFromStream,                gpsPosData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(GnssHdt,        sbgEComLogGnssHdtReadFromStream,                gpsHdtData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(GnssRaw,        sbgEComLogRawDataReadFromStream,                gpsRawData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(SatList,        sbgEComLogSatListReadFromStream,                satGroupData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(RtcmRaw,        sbgEComLogRawDataReadFromStream,                rtcmRawData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(Mag,            sbgEComLogMagReadFromStream,                    magData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(MagCalib,       sbgEComLogMagCalibReadFromStream,               magCalibData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(Dvl,            sbgEComLogDvlReadFromStream,                    dvlData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(AirData,        sbgEComLogAirDataReadFromStream,                airData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(Usbl,           sbgEComLogUsblReadFromStream,                   usblData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(Depth,          sbgEComLogDepthReadFromStream,                  depthData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(Event,          sbgEComLogEventReadFromStream,                  eventMarker)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(Diag,           sbgEComLogDiagReadFromStream,                   diagData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(SessionInfo,    sbgEComLogSessionInfoReadFromStream,            sessionInfoData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(Velocity,       sbgEComLogVelocityReadFromStream,               velocityData)
+SBG_ECOM_LOG_DEFINE_PARSE_FUNC(ImuFastLegacy,  sbgEComLogImuFastLegacyReadFromStream,          fastImuData)
+
+//----------------------------------------------------------------------//
+//- Static global decoder tables                                       -//
+//----------------------------------------------------------------------//
+
+/*!< Built-in decoders of the SBG_ECOM_CLASS_LOG_ECOM_0 logs, indexed by message ID. */
+static const SbgEComLogParseFunc gEcom0ParseFuncs[SBG_ECOM_LOG_ECOM_NUM_MESSAGES] =
+{
+    [SBG_ECOM_LOG_STATUS]                = sbgEComLogParseStatus,
+    [SBG_ECOM_LOG_IMU_DATA]              = sbgEComLogParseImuLegacy,
+    [SBG_ECOM_LOG_IMU_SHORT]             = sbgEComLogParseImuShort,
+    [SBG_ECOM_LOG_EKF_EULER]             = sbgEComLogParseEkfEuler,
+    [SBG_ECOM_LOG_EKF_QUAT]              = sbgEComLogParseEkfQuat,
+    [SBG_ECOM_LOG_EKF_NAV]               = sbgEComLogParseEkfNav,
+    [SBG_ECOM_LOG_EKF_VEL_BODY]          = sbgEComLogParseEkfVelBody,
+    [SBG_ECOM_LOG_EKF_ROT_ACCEL_BODY]    = sbgEComLogParseEkfRotAccel,
+    [SBG_ECOM_LOG_EKF_ROT_ACCEL_NED]     = sbgEComLogParseEkfRotAccel,
+    [SBG_ECOM_LOG_SHIP_MOTION]           = sbgEComLogParseShipMotion,
+    [SBG_ECOM_LOG_SHIP_MOTION_HP]        = sbgEComLogParseShipMotion,
+    [SBG_ECOM_LOG_ODO_VEL]               = sbgEComLogParseOdometer,
+    [SBG_ECOM_LOG_UTC_TIME]              = sbgEComLogParseUtc,
+    [SBG_ECOM_LOG_PTP_STATUS]            = sbgEComLogParsePtp,
+    [SBG_ECOM_LOG_VIB_MON_FFT]           = sbgEComLogParseVibMonFft,
+    [SBG_ECOM_LOG_VIB_MON_REPORT]        = sbgEComLogParseVibMonReport,
+    [SBG_ECOM_LOG_GPS1_VEL]              = sbgEComLogParseGnssVel,
+    [SBG_ECOM_LOG_GPS2_VEL]              = sbgEComLogParseGnssVel,
+    [SBG_ECOM_LOG_GPS1_POS]              = sbgEComLogParseGnssPos,
+    [SBG_ECOM_LOG_GPS2_POS]              = sbgEComLogParseGnssPos,
+    [SBG_ECOM_LOG_GPS1_HDT]              = sbgEComLogParseGnssHdt,
+    [SBG_ECOM_LOG_GPS2_HDT]              = sbgEComLogParseGnssHdt,
+    [SBG_ECOM_LOG_GPS1_RAW]              = sbgEComLogParseGnssRaw,
+    [SBG_ECOM_LOG_GPS2_RAW]              = sbgEComLogParseGnssRaw,
+    [SBG_ECOM_LOG_GPS1_SAT]              = sbgEComLogParseSatList,
+    [SBG_ECOM_LOG_GPS2_SAT]              = sbgEComLogParseSatList,
+    [SBG_ECOM_LOG_RTCM_RAW]              = sbgEComLogParseRtcmRaw,
+    [SBG_ECOM_LOG_MAG]                   = sbgEComLogParseMag,
+    [SBG_ECOM_LOG_MAG_CALIB]             = sbgEComLogParseMagCalib,
+    [SBG_ECOM_LOG_DVL_BOTTOM_TRACK]      = sbgEComLogParseDvl,
+    [SBG_ECOM_LOG_DVL_WATER_TRACK]       = sbgEComLogParseDvl,
+    [SBG_ECOM_LOG_AIR_DATA]              = sbgEComLogParseAirData,
+    [SBG_ECOM_LOG_USBL]                  = sbgEComLogParseUsbl,
+    [SBG_ECOM_LOG_DEPTH]                 = sbgEComLogParseDepth,
+    [SBG_ECOM_LOG_EVENT_A]               = sbgEComLogParseEvent,
+    [SBG_ECOM_LOG_EVENT_B]               = sbgEComLogParseEvent,
+    [SBG_ECOM_LOG_EVENT_C]               = sbgEComLogParseEvent,
+    [SBG_ECOM_LOG_EVENT_D]               = sbgEComLogParseEvent,
+    [SBG_ECOM_LOG_EVENT_E]               = sbgEComLogParseEvent,
+    [SBG_ECOM_LOG_EVENT_OUT_A]           = sbgEComLogParseEvent,
+    [SBG_ECOM_LOG_EVENT_OUT_B]           = sbgEComLogParseEvent,
+    [SBG_ECOM_LOG_DIAG]                  = sbgEComLogParseDiag,
+    [SBG_ECOM_LOG_SESSION_INFO]          = sbgEComLogParseSessionInfo,
+    [SBG_ECOM_LOG_VELOCITY_1]            = sbgEComLogParseVelocity
+};
+
+/*!< Built-in decoders of the SBG_ECOM_CLASS_LOG_ECOM_1 logs, indexed by message ID. */
+static const SbgEComLogParseFunc gEcom1ParseFuncs[SBG_ECOM_LOG_ECOM_1_NUM_MESSAGES] =
+{
+    [SBG_ECOM_LOG_FAST_IMU_DATA]         = sbgEComLogParseImuFastLegacy
+};
+
+/*!
+ * Get a mutable decoder from a log registry.
+ *
+ * \param[in]   pRegistry                   Log registry.
+ * \param[in]   msgClass                    Message class.
+ * \param[in]   msgId                       Message ID.
+ * \return                                  Log decoder, NULL if the message class or ID is out of the registry.
+ */
+static SbgEComLogDecoder *sbgEComLogRegistryGetMutableDecoder(SbgEComLogRegistry *pRegistry, SbgEComClass msgClass, SbgEComMsgId msgId)
+{
+    SbgEComLogDecoder                   *pDecoder = NULL;
+
+    assert(pRegistry);
+
+    if ((msgClass == SBG_ECOM_CLASS_LOG_ECOM_0) && (msgId < SBG_ARRAY_SIZE(pRegistry->ecom0Decoders)))
+    {
+        pDecoder = &pRegistry->ecom0Decoders[msgId];
+    }
+    else if ((msgClass == SBG_ECOM_CLASS_LOG_ECOM_1) && (msgId < SBG_ARRAY_SIZE(pRegistry->ecom1Decoders)))
+    {
+        pDecoder = &pRegistry->ecom1Decoders[msgId];
+    }
+
+    return pDecoder;
+}
+
 //----------------------------------------------------------------------//
 //- Public methods                                                     -//
 //----------------------------------------------------------------------//
@@ -40,6 +176,7 @@ SbgErrorCode sbgEComLogParse(SbgEComClass msgClass, SbgEComMsgId msgId, const vo
 {
     SbgErrorCode        errorCode = SBG_NO_ERROR;
     SbgStreamBuffer     inputStream;
+    SbgEComLogParseFunc pParseFunc;
 
     assert(pPayload);
     assert(payloadSize > 0);
@@ -51,146 +188,151 @@ SbgErrorCode sbgEComLogParse(SbgEComClass msgClass, SbgEComMsgId msgId, const vo
     sbgStreamBufferInitForRead(&inputStream, pPayload, payloadSize);
 
     //
-    // Handle the different classes of messages differently
+    // Find the decoder of the log according to its class and type
     //
-    if (msgClass == SBG_ECOM_CLASS_LOG_ECOM_0)
+    pParseFunc = sbgEComLogGetParseFunc(msgClass, msgId);
+
+    if (pParseFunc)
     {
-        //
-        // Parse the incoming log according to its type
-        //
-        switch (msgId)
-        {
-        case SBG_ECOM_LOG_STATUS:
-            errorCode = sbgEComLogStatusReadFromStream(&pLogData->statusData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_IMU_DATA:
-            errorCode = sbgEComLogImuLegacyReadFromStream(&pLogData->imuData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_IMU_SHORT:
-            errorCode = sbgEComLogImuShortReadFromStream(&pLogData->imuShort, &inputStream);
-            break;
-        case SBG_ECOM_LOG_EKF_EULER:
-            errorCode = sbgEComLogEkfEulerReadFromStream(&pLogData->ekfEulerData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_EKF_QUAT:
-            errorCode = sbgEComLogEkfQuatReadFromStream(&pLogData->ekfQuatData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_EKF_NAV:
-            errorCode = sbgEComLogEkfNavReadFromStream(&pLogData->ekfNavData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_EKF_VEL_BODY:
-            errorCode = sbgEComLogEkfVelBodyReadFromStream(&pLogData->ekfVelBody, &inputStream);
-            break;
-        case SBG_ECOM_LOG_EKF_ROT_ACCEL_BODY:
-        case SBG_ECOM_LOG_EKF_ROT_ACCEL_NED:
-            errorCode = sbgEComLogEkfRotAccelReadFromStream(&pLogData->ekfRotAccel, &inputStream);
-            break;
-        case SBG_ECOM_LOG_SHIP_MOTION:
-        case SBG_ECOM_LOG_SHIP_MOTION_HP:
-            errorCode = sbgEComLogShipMotionReadFromStream(&pLogData->shipMotionData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_ODO_VEL:
-            errorCode = sbgEComLogOdometerReadFromStream(&pLogData->odometerData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_UTC_TIME:
-            errorCode = sbgEComLogUtcReadFromStream(&pLogData->utcData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_PTP_STATUS:
-            errorCode = sbgEComLogPtpReadFromStream(&pLogData->ptpData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_VIB_MON_FFT:
-            errorCode = sbgEComLogVibMonFftReadFromStream(&pLogData->vibMonFft, &inputStream);
-            break;
-        case SBG_ECOM_LOG_VIB_MON_REPORT:
-            errorCode = sbgEComLogVibMonReportReadFromStream(&pLogData->vibMonReport, &inputStream);
-            break;
-        case SBG_ECOM_LOG_GPS1_VEL:
-        case SBG_ECOM_LOG_GPS2_VEL:
-            errorCode = sbgEComLogGnssVelReadFromStream(&pLogData->gpsVelData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_GPS1_POS:
-        case SBG_ECOM_LOG_GPS2_POS:
-            errorCode = sbgEComLogGnssPosReadFromStream(&pLogData->gpsPosData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_GPS1_HDT:
-        case SBG_ECOM_LOG_GPS2_HDT:
-            errorCode = sbgEComLogGnssHdtReadFromStream(&pLogData->gpsHdtData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_GPS1_RAW:
-        case SBG_ECOM_LOG_GPS2_RAW:
-            errorCode = sbgEComLogRawDataReadFromStream(&pLogData->gpsRawData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_GPS1_SAT:
-        case SBG_ECOM_LOG_GPS2_SAT:
-            errorCode = sbgEComLogSatListReadFromStream(&pLogData->satGroupData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_RTCM_RAW:
-            errorCode = sbgEComLogRawDataReadFromStream(&pLogData->rtcmRawData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_MAG:
-            errorCode = sbgEComLogMagReadFromStream(&pLogData->magData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_MAG_CALIB:
-            errorCode = sbgEComLogMagCalibReadFromStream(&pLogData->magCalibData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_DVL_BOTTOM_TRACK:
-            errorCode = sbgEComLogDvlReadFromStream(&pLogData->dvlData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_DVL_WATER_TRACK:
-            errorCode = sbgEComLogDvlReadFromStream(&pLogData->dvlData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_AIR_DATA:
-            errorCode = sbgEComLogAirDataReadFromStream(&pLogData->airData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_USBL:
-            errorCode = sbgEComLogUsblReadFromStream(&pLogData->usblData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_DEPTH:
-            errorCode = sbgEComLogDepthReadFromStream(&pLogData->depthData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_EVENT_A:
-        case SBG_ECOM_LOG_EVENT_B:
-        case SBG_ECOM_LOG_EVENT_C:
-        case SBG_ECOM_LOG_EVENT_D:
-        case SBG_ECOM_LOG_EVENT_E:
-        case SBG_ECOM_LOG_EVENT_OUT_A:
-        case SBG_ECOM_LOG_EVENT_OUT_B:
-            errorCode = sbgEComLogEventReadFromStream(&pLogData->eventMarker, &inputStream);
-            break;
-        case SBG_ECOM_LOG_DIAG:
-            errorCode = sbgEComLogDiagReadFromStream(&pLogData->diagData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_SESSION_INFO:
-            errorCode = sbgEComLogSessionInfoReadFromStream(&pLogData->sessionInfoData, &inputStream);
-            break;
-        case SBG_ECOM_LOG_VELOCITY_1:
-            errorCode = sbgEComLogVelocityReadFromStream(&pLogData->velocityData, &inputStream);
-            break;
-
-
-        default:
-            errorCode = SBG_ERROR;
-        }
+        errorCode = pParseFunc(pLogData, &inputStream);
     }
-    else if (msgClass == SBG_ECOM_CLASS_LOG_ECOM_1)
+    else
     {
         //
-        // Parse the message depending on the message ID
+        // Unhandled message class or ID
         //
-        switch ((SbgEComLog1)msgId)
+        errorCode = SBG_ERROR;
+    }
+
+    return errorCode;
+}
+
+SbgEComLogParseFunc sbgEComLogGetParseFunc(SbgEComClass msgClass, SbgEComMsgId msgId)
+{
+    SbgEComLogParseFunc pParseFunc = NULL;
+
+    if ((msgClass == SBG_ECOM_CLASS_LOG_ECOM_0) && (msgId < SBG_ARRAY_SIZE(gEcom0ParseFuncs)))
+    {
+        pParseFunc = gEcom0ParseFuncs[msgId];
+    }
+    else if ((msgClass == SBG_ECOM_CLASS_LOG_ECOM_1) && (msgId < SBG_ARRAY_SIZE(gEcom1ParseFuncs)))
+    {
+        pParseFunc = gEcom1ParseFuncs[msgId];
+    }
+
+    return pParseFunc;
+}
+
+void sbgEComLogRegistryInit(SbgEComLogRegistry *pRegistry)
+{
+    assert(pRegistry);
+
+    for (size_t i = 0; i < SBG_ARRAY_SIZE(pRegistry->ecom0Decoders); i++)
+    {
+        pRegistry->ecom0Decoders[i].pParseFunc  = gEcom0ParseFuncs[i];
+        pRegistry->ecom0Decoders[i].enabled     = true;
+    }
+
+    for (size_t i = 0; i < SBG_ARRAY_SIZE(pRegistry->ecom1Decoders); i++)
+    {
+        pRegistry->ecom1Decoders[i].pParseFunc  = gEcom1ParseFuncs[i];
+        pRegistry->ecom1Decoders[i].enabled     = true;
+    }
+}
+
+void sbgEComLogRegistrySetAllEnabled(SbgEComLogRegistry *pRegistry, bool enabled)
+{
+    assert(pRegistry);
+
+    for (size_t i = 0; i < SBG_ARRAY_SIZE(pRegistry->ecom0Decoders); i++)
+    {
+        pRegistry->ecom0Decoders[i].enabled = enabled;
+    }
+
+    for (size_t i = 0; i < SBG_ARRAY_SIZE(pRegistry->ecom1Decoders); i++)
+    {
+        pRegistry->ecom1Decoders[i].enabled = enabled;
+    }
+}
+
+SbgErrorCode sbgEComLogRegistryRegister(SbgEComLogRegistry *pRegistry, SbgEComClass msgClass, SbgEComMsgId msgId, SbgEComLogParseFunc pParseFunc)
+{
+    SbgErrorCode                         errorCode = SBG_NO_ERROR;
+    SbgEComLogDecoder                   *pDecoder;
+
+    pDecoder = sbgEComLogRegistryGetMutableDecoder(pRegistry, msgClass, msgId);
+
+    if (!pParseFunc)
+    {
+        pParseFunc = sbgEComLogGetParseFunc(msgClass, msgId);
+    }
+
+    if (pDecoder && pParseFunc)
+    {
+        pDecoder->pParseFunc    = pParseFunc;
+        pDecoder->enabled       = true;
+    }
+    else
+    {
+        errorCode = SBG_INVALID_PARAMETER;
+        SBG_LOG_ERROR(errorCode, "unable to register log %u/%u", msgClass, msgId);
+    }
+
+    return errorCode;
+}
+
+SbgErrorCode sbgEComLogRegistrySetEnabled(SbgEComLogRegistry *pRegistry, SbgEComClass msgClass, SbgEComMsgId msgId, bool enabled)
+{
+    SbgErrorCode                         errorCode = SBG_NO_ERROR;
+    SbgEComLogDecoder                   *pDecoder;
+
+    pDecoder = sbgEComLogRegistryGetMutableDecoder(pRegistry, msgClass, msgId);
+
+    if (pDecoder && pDecoder->pParseFunc)
+    {
+        pDecoder->enabled = enabled;
+    }
+    else
+    {
+        errorCode = SBG_INVALID_PARAMETER;
+        SBG_LOG_ERROR(errorCode, "no decoder for log %u/%u", msgClass, msgId);
+    }
+
+    return errorCode;
+}
+
+const SbgEComLogDecoder *sbgEComLogRegistryGetDecoder(const SbgEComLogRegistry *pRegistry, SbgEComClass msgClass, SbgEComMsgId msgId)
+{
+    return sbgEComLogRegistryGetMutableDecoder((SbgEComLogRegistry *)pRegistry, msgClass, msgId);
+}
+
+SbgErrorCode sbgEComLogRegistryParse(const SbgEComLogRegistry *pRegistry, SbgEComClass msgClass, SbgEComMsgId msgId, const void *pPayload, size_t payloadSize, SbgEComLogUnion *pLogData)
+{
+    SbgErrorCode                         errorCode;
+    const SbgEComLogDecoder             *pDecoder;
+
+    assert(pPayload);
+    assert(pLogData);
+
+    pDecoder = sbgEComLogRegistryGetDecoder(pRegistry, msgClass, msgId);
+
+    if (pDecoder && pDecoder->pParseFunc)
+    {
+        if (pDecoder->enabled)
         {
-        case SBG_ECOM_LOG_FAST_IMU_DATA:
-            errorCode = sbgEComLogImuFastLegacyReadFromStream(&pLogData->fastImuData, &inputStream);
-            break;
-        default:
-            errorCode = SBG_ERROR;
+            SbgStreamBuffer              inputStream;
+
+            sbgStreamBufferInitForRead(&inputStream, pPayload, payloadSize);
+
+            errorCode = pDecoder->pParseFunc(pLogData, &inputStream);
+        }
+        else
+        {
+            errorCode = SBG_NOT_READY;
         }
     }
     else
     {
-        //
-        // Unhandled message class
-        //
         errorCode = SBG_ERROR;
     }
 
@@ -119,6 +119,35 @@ typedef union _SbgEComLogUnion
 
 } SbgEComLogUnion;
 
+/*!
+ * Function used to decode the payload of a log into the corresponding member of the log union.
+ *
+ * \param[out]  pLogData                    Log union, only the member of the decoded log is written.
+ * \param[in]   pStreamBuffer               Input stream buffer on the log payload.
+ * \return                                  SBG_NO_ERROR if the log has been decoded successfully.
+ */
+typedef SbgErrorCode (*SbgEComLogParseFunc)(SbgEComLogUnion *pLogData, SbgStreamBuffer *pStreamBuffer);
+
+/*!
+ * Log decoder registered for a (message class, message ID) pair.
+ */
+typedef struct _SbgEComLogDecoder
+{
+    SbgEComLogParseFunc             pParseFunc;         /*!< Function used to decode the log, NULL if the log is unknown. */
+    bool                            enabled;            /*!< True if the log has to be decoded, disabled logs are discarded before any decoding. */
+} SbgEComLogDecoder;
+
+/*!
+ * Registry of the log decoders for the SBG_ECOM_CLASS_LOG_ECOM_0 and SBG_ECOM_CLASS_LOG_ECOM_1 classes.
+ *
+ * The registry is indexed by message ID to find the decoder of a received log in constant time.
+ */
+typedef struct _SbgEComLogRegistry
+{
+    SbgEComLogDecoder               ecom0Decoders[SBG_ECOM_LOG_ECOM_NUM_MESSAGES];      /*!< Decoders of the SBG_ECOM_CLASS_LOG_ECOM_0 logs. */
+    SbgEComLogDecoder               ecom1Decoders[SBG_ECOM_LOG_ECOM_1_NUM_MESSAGES];    /*!< Decoders of the SBG_ECOM_CLASS_LOG_ECOM_1 logs. */
+} SbgEComLogRegistry;
+
 //----------------------------------------------------------------------//
 //- Public methods                                                     -//
 //----------------------------------------------------------------------//
@@ -134,6 +163,81 @@ typedef union _SbgEComLogUnion
  */
 SbgErrorCode sbgEComLogParse(SbgEComClass msgClass, SbgEComMsgId msgId, const void *pPayload, size_t payloadSize, SbgEComLogUnion *pLogData);
 
+/*!
+ * Get the built-in decoder function of a log.
+ *
+ * \param[in]   msgClass                    Message class.
+ * \param[in]   msgId                       Message ID.
+ * \return                                  Decoder function, NULL if the log is unknown.
+ */
+SbgEComLogParseFunc sbgEComLogGetParseFunc(SbgEComClass msgClass, SbgEComMsgId msgId);
+
+/*!
+ * Initialize a log registry with the built-in decoders, all logs being enabled.
+ *
+ * \param[out]  pRegistry                   Log registry.
+ */
+void sbgEComLogRegistryInit(SbgEComLogRegistry *pRegistry);
+
+/*!
+ * Enable or disable all the logs of a registry.
+ *
+ * This is typically used to disable all logs before registering the few ones an application consumes.
+ *
+ * \param[in]   pRegistry                   Log registry.
+ * \param[in]   enabled                     True to enable all logs, false to disable them.
+ */
+void sbgEComLogRegistrySetAllEnabled(SbgEComLogRegistry *pRegistry, bool enabled);
+
+/*!
+ * Register and enable a log decoder.
+ *
+ * \param[in]   pRegistry                   Log registry.
+ * \param[in]   msgClass                    Message class.
+ * \param[in]   msgId                       Message ID.
+ * \param[in]   pParseFunc                  Decoder function, NULL to use the built-in decoder.
+ * \return                                  SBG_NO_ERROR if successful,
+ *                                          SBG_INVALID_PARAMETER if the log can't be registered.
+ */
+SbgErrorCode sbgEComLogRegistryRegister(SbgEComLogRegistry *pRegistry, SbgEComClass msgClass, SbgEComMsgId msgId, SbgEComLogParseFunc pParseFunc);
+
+/*!
+ * Enable or disable the decoding of a log.
+ *
+ * \param[in]   pRegistry                   Log registry.
+ * \param[in]   msgClass                    Message class.
+ * \param[in]   msgId                       Message ID.
+ * \param[in]   enabled                     True to decode the log, false to discard it.
+ * \return                                  SBG_NO_ERROR if successful,
+ *                                          SBG_INVALID_PARAMETER if the log has no decoder.
+ */
+SbgErrorCode sbgEComLogRegistrySetEnabled(SbgEComLogRegistry *pRegistry, SbgEComClass msgClass, SbgEComMsgId msgId, bool enabled);
+
+/*!
+ * Get the decoder of a log.
+ *
+ * \param[in]   pRegistry                   Log registry.
+ * \param[in]   msgClass                    Message class.
+ * \param[in]   msgId                       Message ID.
+ * \return                                  Log decoder, NULL if the message class or ID is out of the registry.
+ */
+const SbgEComLogDecoder *sbgEComLogRegistryGetDecoder(const SbgEComLogRegistry *pRegistry, SbgEComClass msgClass, SbgEComMsgId msgId);
+
+/*!
+ * Decode a log using the decoders of a registry.
+ *
+ * \param[in]   pRegistry                   Log registry.
+ * \param[in]   msgClass                    Received message class
+ * \param[in]   msgId                       Received message ID
+ * \param[in]   pPayload                    Read only pointer on the payload buffer.
+ * \param[in]   payloadSize                 Payload size in bytes.
+ * \param[out]  pLogData                    Pointer on the output union that stores parsed data.
+ * \return                                  SBG_NO_ERROR if the log has been decoded,
+ *                                          SBG_NOT_READY if the log is disabled,
+ *                                          SBG_ERROR if the log is unknown.
+ */
+SbgErrorCode sbgEComLogRegistryParse(const SbgEComLogRegistry *pRegistry, SbgEComClass msgClass, SbgEComMsgId msgId, const void *pPayload, size_t payloadSize, SbgEComLogUnion *pLogData);
+
 /*!
  * Clean up resources allocated during parsing, if any.
  *
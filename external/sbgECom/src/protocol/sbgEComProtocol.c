@@ -60,9 +60,235 @@ static void sbgEComProtocolPayloadSet(SbgEComProtocolPayload *pPayload, bool all
     pPayload->size      = size;
 }
 
+/*!
+ * Get the ring buffer index of a byte in the work buffer of a protocol.
+ *
+ * \param[in]   pProtocol                   Protocol.
+ * \param[in]   offset                      Byte offset, relative to the first valid byte.
+ * \return                                  Index of the byte in the ring buffer.
+ */
+static size_t sbgEComProtocolRxGetIndex(const SbgEComProtocol *pProtocol, size_t offset)
+{
+    size_t                               index;
+
+    assert(pProtocol);
+    assert(offset < pProtocol->rxBufferCapacity);
+
+    index = pProtocol->rxBufferHead + offset;
+
+    if (index >= pProtocol->rxBufferCapacity)
+    {
+        index -= pProtocol->rxBufferCapacity;
+    }
+
+    return index;
+}
+
+/*!
+ * Get a byte from the work buffer of a protocol.
+ *
+ * \param[in]   pProtocol                   Protocol.
+ * \param[in]   offset                      Byte offset, relative to the first valid byte.
+ * \return                                  Byte value.
+ */
+static uint8_t sbgEComProtocolRxGetUint8(const SbgEComProtocol *pProtocol, size_t offset)
+{
+    assert(pProtocol);
+    assert(offset < pProtocol->rxBufferSize);
+
+    return pProtocol->pRxBuffer[sbgEComProtocolRxGetIndex(pProtocol, offset)];
+}
+
+/*!
+ * Get a little endian 16 bits value from the work buffer of a protocol.
+ *
+ * \param[in]   pProtocol                   Protocol.
+ * \param[in]   offset                      Value offset, relative to the first valid byte.
+ * \return                                  Value.
+ */
+static uint16_t sbgEComProtocolRxGetUint16LE(const SbgEComProtocol *pProtocol, size_t offset)
+{
+    return (uint16_t)(sbgEComProtocolRxGetUint8(pProtocol, offset) | (sbgEComProtocolRxGetUint8(pProtocol, offset + 1) << 8));
+}
+
+/*!
+ * Compute the CRC of a range of bytes in the work buffer of a protocol.
+ *
+ * The range may straddle the end of the ring buffer.
+ *
+ * \param[in]   pProtocol                   Protocol.
+ * \param[in]   offset                      Range offset, relative to the first valid byte.
+ * \param[in]   size                        Range size, in bytes.
+ * \return                                  CRC of the range.
+ */
+static uint16_t sbgEComProtocolRxComputeCrc(const SbgEComProtocol *pProtocol, size_t offset, size_t size)
+{
+    SbgCrc16                             crc;
+    size_t                               index;
+    size_t                               contiguousSize;
+
+    assert(pProtocol);
+    assert((offset + size) <= pProtocol->rxBufferSize);
+
+    index           = sbgEComProtocolRxGetIndex(pProtocol, offset);
+    contiguousSize  = sbgMin(size, pProtocol->rxBufferCapacity - index);
+
+    sbgCrc16Initialize(&crc);
+    sbgCrc16Update(&crc, &pProtocol->pRxBuffer[index], contiguousSize);
+
+    if (contiguousSize != size)
+    {
+        sbgCrc16Update(&crc, pProtocol->pRxBuffer, size - contiguousSize);
+    }
+
+    return sbgCrc16Get(&crc);
+}
+
+/*!
+ * Get a linear view of a range of bytes in the work buffer of a protocol.
+ *
+ * If the range straddles the end of the ring buffer, it is copied into the frame buffer,
+ * otherwise the returned pointer directly references the ring buffer.
+ *
+ * \param[in]   pProtocol                   Protocol.
+ * \param[in]   offset                      Range offset, relative to the first valid byte.
+ * \param[in]   size                        Range size, in bytes.
+ * \return                                  Pointer to the linear range.
+ */
+static uint8_t *sbgEComProtocolRxGetLinearBuffer(SbgEComProtocol *pProtocol, size_t offset, size_t size)
+{
+    uint8_t                             *pBuffer;
+    size_t                               index;
+
+    assert(pProtocol);
+    assert((offset + size) <= pProtocol->rxBufferSize);
+    assert(size <= sizeof(pProtocol->rxFrameBuffer));
+
+    index = sbgEComProtocolRxGetIndex(pProtocol, offset);
+
+    if ((index + size) <= pProtocol->rxBufferCapacity)
+    {
+        pBuffer = &pProtocol->pRxBuffer[index];
+    }
+    else
+    {
+        size_t                           firstPartSize;
+
+        firstPartSize = pProtocol->rxBufferCapacity - index;
+
+        memcpy(pProtocol->rxFrameBuffer, &pProtocol->pRxBuffer[index], firstPartSize);
+        memcpy(&pProtocol->rxFrameBuffer[firstPartSize], pProtocol->pRxBuffer, size - firstPartSize);
+
+        pBuffer = pProtocol->rxFrameBuffer;
+    }
+
+    return pBuffer;
+}
+
+/*!
+ * Clear the work buffer of a protocol.
+ *
+ * \param[in]   pProtocol                   Protocol.
+ */
+static void sbgEComProtocolRxClear(SbgEComProtocol *pProtocol)
+{
+    assert(pProtocol);
+
+    pProtocol->rxBufferHead     = 0;
+    pProtocol->rxBufferSize     = 0;
+    pProtocol->discardSize      = 0;
+    pProtocol->rxFramePending   = false;
+    pProtocol->rxNrTimestamps   = 0;
+}
+
+/*!
+ * Add the reception time of a read into the work buffer of a protocol.
+ *
+ * If the reception times table is full, the read is attributed to the last tracked read.
+ *
+ * \param[in]   pProtocol                   Protocol.
+ * \param[in]   offset                      Offset of the first byte read, from the head of the reception buffer.
+ * \param[in]   pTimestamp                  Reception time of the read.
+ */
+static void sbgEComProtocolRxAddTimestamp(SbgEComProtocol *pProtocol, size_t offset, const SbgInterfaceTimestamp *pTimestamp)
+{
+    assert(pProtocol);
+    assert(pTimestamp);
+
+    if (pProtocol->rxNrTimestamps < SBG_ARRAY_SIZE(pProtocol->rxTimestamps))
+    {
+        pProtocol->rxTimestamps[pProtocol->rxNrTimestamps].offset       = offset;
+        pProtocol->rxTimestamps[pProtocol->rxNrTimestamps].timestamp    = *pTimestamp;
+        pProtocol->rxNrTimestamps++;
+    }
+}
+
+/*!
+ * Release the reception times of bytes discarded from the work buffer of a protocol.
+ *
+ * \param[in]   pProtocol                   Protocol.
+ * \param[in]   size                        Number of bytes discarded from the head of the reception buffer.
+ */
+static void sbgEComProtocolRxDiscardTimestamps(SbgEComProtocol *pProtocol, size_t size)
+{
+    size_t                               nrStale;
+
+    assert(pProtocol);
+
+    //
+    // Keep the last read starting within the discarded bytes as it may hold the next bytes
+    //
+    nrStale = 0;
+
+    while (((nrStale + 1) < pProtocol->rxNrTimestamps) && (pProtocol->rxTimestamps[nrStale + 1].offset <= size))
+    {
+        nrStale++;
+    }
+
+    if (nrStale != 0)
+    {
+        pProtocol->rxNrTimestamps -= nrStale;
+        memmove(pProtocol->rxTimestamps, &pProtocol->rxTimestamps[nrStale], pProtocol->rxNrTimestamps * sizeof(pProtocol->rxTimestamps[0]));
+    }
+
+    for (size_t i = 0; i < pProtocol->rxNrTimestamps; i++)
+    {
+        if (pProtocol->rxTimestamps[i].offset > size)
+        {
+            pProtocol->rxTimestamps[i].offset -= size;
+        }
+        else
+        {
+            pProtocol->rxTimestamps[i].offset = 0;
+        }
+    }
+}
+
+/*!
+ * Get the reception time of a byte in the work buffer of a protocol.
+ *
+ * \param[in]   pProtocol                   Protocol.
+ * \param[in]   offset                      Offset of the byte, from the head of the reception buffer.
+ * \param[out]  pTimestamp                  Reception time, null if unknown.
+ */
+static void sbgEComProtocolRxGetTimestamp(const SbgEComProtocol *pProtocol, size_t offset, SbgInterfaceTimestamp *pTimestamp)
+{
+    assert(pProtocol);
+    assert(pTimestamp);
+
+    memset(pTimestamp, 0x00, sizeof(*pTimestamp));
+
+    for (size_t i = 0; (i < pProtocol->rxNrTimestamps) && (pProtocol->rxTimestamps[i].offset <= offset); i++)
+    {
+        *pTimestamp = pProtocol->rxTimestamps[i].timestamp;
+    }
+}
+
 /*!
  * Discard unused bytes from the work buffer of a protocol.
  *
+ * Bytes are released by moving the head of the ring buffer, no data is moved.
+ *
  * \param[in]   pProtocol                   Protocol.
  */
 static void sbgEComProtocolDiscardUnusedBytes(SbgEComProtocol *pProtocol)
@@ -73,33 +299,179 @@ static void sbgEComProtocolDiscardUnusedBytes(SbgEComProtocol *pProtocol)
     {
         assert(pProtocol->discardSize <= pProtocol->rxBufferSize);
 
-        memmove(pProtocol->rxBuffer, &pProtocol->rxBuffer[pProtocol->discardSize], pProtocol->rxBufferSize - pProtocol->discardSize);
+        if (pProtocol->discardSize == pProtocol->rxBufferSize)
+        {
+            //
+            // Restart from the beginning of the ring buffer to get the largest contiguous space to read into.
+            //
+            sbgEComProtocolRxClear(pProtocol);
+        }
+        else
+        {
+            sbgEComProtocolRxDiscardTimestamps(pProtocol, pProtocol->discardSize);
 
-        pProtocol->rxBufferSize -= pProtocol->discardSize;
-        pProtocol->discardSize  = 0;
+            pProtocol->rxBufferHead = sbgEComProtocolRxGetIndex(pProtocol, pProtocol->discardSize);
+            pProtocol->rxBufferSize -= pProtocol->discardSize;
+            pProtocol->discardSize  = 0;
+        }
     }
 }
 
 /*!
- * Read data from the underlying interface into the work buffer of a protocol.
+ * Reference the interface data from the work buffer of a protocol.
+ *
+ * The bytes released since the previous call are skipped on the interface, and the work buffer
+ * then references all the data that can be read, starting with the bytes still held.
  *
  * \param[in]   pProtocol                   Protocol.
  */
-static void sbgEComProtocolRead(SbgEComProtocol *pProtocol)
+static void sbgEComProtocolRxMap(SbgEComProtocol *pProtocol)
 {
     SbgErrorCode                         errorCode;
+    const void                          *pBuffer;
+    size_t                               size;
 
     assert(pProtocol);
 
-    if (pProtocol->rxBufferSize < sizeof(pProtocol->rxBuffer))
+    if (pProtocol->rxMapped)
     {
-        size_t                           nrBytesRead;
+        assert(pProtocol->rxBufferSize <= pProtocol->rxMappedSize);
 
-        errorCode = sbgInterfaceRead(pProtocol->pLinkedInterface, &pProtocol->rxBuffer[pProtocol->rxBufferSize], &nrBytesRead, sizeof(pProtocol->rxBuffer) - pProtocol->rxBufferSize);
+        errorCode = sbgInterfaceSkip(pProtocol->pLinkedInterface, pProtocol->rxMappedSize - pProtocol->rxBufferSize);
+    }
+    else
+    {
+        assert(pProtocol->rxBufferSize == 0);
 
-        if (errorCode == SBG_NO_ERROR)
+        //
+        // The reception buffer storage is not used anymore
+        //
+        if (pProtocol->rxBufferAllocated)
         {
-            pProtocol->rxBufferSize += nrBytesRead;
+            free(pProtocol->pRxBuffer);
+            pProtocol->rxBufferAllocated = false;
+        }
+
+        errorCode = SBG_NO_ERROR;
+    }
+
+    if (errorCode == SBG_NO_ERROR)
+    {
+        errorCode = sbgInterfacePeek(pProtocol->pLinkedInterface, &pBuffer, &size);
+        pProtocol->stats.nrReads++;
+    }
+
+    if (errorCode == SBG_NO_ERROR)
+    {
+        assert(size >= pProtocol->rxBufferSize);
+
+        pProtocol->stats.nrBytesRead += size - pProtocol->rxBufferSize;
+
+        //
+        // The protocol never writes to the reception buffer, the const qualifier can be dropped
+        //
+        pProtocol->pRxBuffer            = (uint8_t *)pBuffer;
+        pProtocol->rxBufferCapacity     = size;
+        pProtocol->rxBufferHead         = 0;
+        pProtocol->rxBufferSize         = size;
+        pProtocol->rxMapped             = true;
+        pProtocol->rxMappedSize         = size;
+    }
+    else
+    {
+        SBG_LOG_ERROR(errorCode, "unable to access the interface data");
+    }
+}
+
+/*!
+ * Stop referencing the interface data from the work buffer of a protocol.
+ *
+ * The bytes released are skipped on the interface, and the work buffer is cleared.
+ *
+ * \param[in]   pProtocol                   Protocol.
+ */
+static void sbgEComProtocolRxUnmap(SbgEComProtocol *pProtocol)
+{
+    assert(pProtocol);
+
+    if (pProtocol->rxMapped)
+    {
+        sbgInterfaceSkip(pProtocol->pLinkedInterface, pProtocol->rxMappedSize - pProtocol->rxBufferSize);
+
+        pProtocol->pRxBuffer            = pProtocol->rxDefaultBuffer;
+        pProtocol->rxBufferCapacity     = sizeof(pProtocol->rxDefaultBuffer);
+        pProtocol->rxMapped             = false;
+        pProtocol->rxMappedSize         = 0;
+
+        sbgEComProtocolRxClear(pProtocol);
+    }
+}
+
+/*!
+ * Read data from the underlying interface into the work buffer of a protocol.
+ *
+ * If the free space of the ring buffer wraps, a second read is only attempted if the
+ * first one filled the space up to the end of the ring buffer.
+ *
+ * \param[in]   pProtocol                   Protocol.
+ */
+static void sbgEComProtocolRead(SbgEComProtocol *pProtocol)
+{
+    assert(pProtocol);
+
+    if (sbgInterfaceIsPeekable(pProtocol->pLinkedInterface))
+    {
+        sbgEComProtocolRxMap(pProtocol);
+    }
+    else
+    {
+        for (uint32_t i = 0; (i < 2) && (pProtocol->rxBufferSize < pProtocol->rxBufferCapacity); i++)
+        {
+            SbgErrorCode                     errorCode;
+            size_t                           index;
+            size_t                           freeSize;
+            size_t                           nrBytesRead;
+
+            if (pProtocol->rxBufferSize == 0)
+            {
+                pProtocol->rxBufferHead = 0;
+            }
+
+            index = pProtocol->rxBufferHead + pProtocol->rxBufferSize;
+
+            if (index < pProtocol->rxBufferCapacity)
+            {
+                freeSize = pProtocol->rxBufferCapacity - index;
+            }
+            else
+            {
+                index -= pProtocol->rxBufferCapacity;
+                freeSize = pProtocol->rxBufferHead - index;
+            }
+
+            errorCode = sbgInterfaceRead(pProtocol->pLinkedInterface, &pProtocol->pRxBuffer[index], &nrBytesRead, freeSize);
+            pProtocol->stats.nrReads++;
+
+            if (errorCode == SBG_NO_ERROR)
+            {
+                if (nrBytesRead != 0)
+                {
+                    sbgEComProtocolRxAddTimestamp(pProtocol, pProtocol->rxBufferSize, sbgInterfaceGetLastReadTimestamp(pProtocol->pLinkedInterface));
+                }
+
+                pProtocol->rxBufferSize += nrBytesRead;
+                pProtocol->stats.nrBytesRead += nrBytesRead;
+
+                if (pProtocol->rxBufferSize > pProtocol->stats.rxHighWaterMark)
+                {
+                    pProtocol->stats.rxHighWaterMark = pProtocol->rxBufferSize;
+                }
+            }
+
+            if ((errorCode != SBG_NO_ERROR) || (nrBytesRead != freeSize))
+            {
+                break;
+            }
         }
     }
 }
@@ -107,6 +479,10 @@ static void sbgEComProtocolRead(SbgEComProtocol *pProtocol)
 /*!
  * Find SYNC bytes in the work buffer of a protocol.
  *
+ * Candidates for the first SYNC byte are searched with memchr() over each contiguous part of the
+ * ring buffer, which the C library usually implements with word or vector operations, and only
+ * these candidates are checked for the second SYNC byte.
+ *
  * The output offset is set if either SBG_NO_ERROR or SBG_NOT_CONTINUOUS_FRAME is returned.
  *
  * \param[in]   pProtocol                   Protocol.
@@ -119,20 +495,47 @@ static void sbgEComProtocolRead(SbgEComProtocol *pProtocol)
 static SbgErrorCode sbgEComProtocolFindSyncBytes(SbgEComProtocol *pProtocol, size_t startOffset, size_t *pOffset)
 {
     SbgErrorCode                         errorCode;
+    size_t                               offset;
 
     assert(pProtocol);
     assert(pOffset);
     assert(pProtocol->rxBufferSize > 0);
 
-    errorCode = SBG_NOT_READY;
+    errorCode   = SBG_NOT_READY;
+    offset      = startOffset;
 
-    for (size_t i = startOffset; i < (pProtocol->rxBufferSize - 1); i++)
+    //
+    // The last byte can't start a pair of SYNC bytes, it is checked separately.
+    //
+    while (offset < (pProtocol->rxBufferSize - 1))
     {
-        if ((pProtocol->rxBuffer[i] == SBG_ECOM_SYNC_1) && (pProtocol->rxBuffer[i + 1] == SBG_ECOM_SYNC_2))
+        const uint8_t                   *pSegment;
+        const uint8_t                   *pCandidate;
+        size_t                           index;
+        size_t                           segmentSize;
+
+        index       = sbgEComProtocolRxGetIndex(pProtocol, offset);
+        segmentSize = sbgMin(pProtocol->rxBufferSize - 1 - offset, pProtocol->rxBufferCapacity - index);
+        pSegment    = &pProtocol->pRxBuffer[index];
+
+        pCandidate  = memchr(pSegment, SBG_ECOM_SYNC_1, segmentSize);
+
+        if (pCandidate)
         {
-            *pOffset    = i;
-            errorCode   = SBG_NO_ERROR;
-            break;
+            offset += (size_t)(pCandidate - pSegment);
+
+            if (sbgEComProtocolRxGetUint8(pProtocol, offset + 1) == SBG_ECOM_SYNC_2)
+            {
+                *pOffset    = offset;
+                errorCode   = SBG_NO_ERROR;
+                break;
+            }
+
+            offset++;
+        }
+        else
+        {
+            offset += segmentSize;
         }
     }
 
@@ -140,7 +543,7 @@ static SbgErrorCode sbgEComProtocolFindSyncBytes(SbgEComProtocol *pProtocol, siz
     // The SYNC bytes were not found, but check if the last byte in the work buffer is the first SYNC byte,
     // as it could result from receiving a partial frame.
     //
-    if ((errorCode != SBG_NO_ERROR) && (pProtocol->rxBuffer[pProtocol->rxBufferSize - 1] == SBG_ECOM_SYNC_1))
+    if ((errorCode != SBG_NO_ERROR) && (sbgEComProtocolRxGetUint8(pProtocol, pProtocol->rxBufferSize - 1) == SBG_ECOM_SYNC_1))
     {
         *pOffset    = pProtocol->rxBufferSize - 1;
         errorCode   = SBG_NOT_CONTINUOUS_FRAME;
@@ -154,6 +557,10 @@ static SbgErrorCode sbgEComProtocolFindSyncBytes(SbgEComProtocol *pProtocol, siz
  *
  * A non-zero number of pages indicates the reception of an extended frame.
  *
+ * The frame is validated in place, even if it straddles the end of the ring buffer.
+ * Only a valid frame is made linear, which requires a copy if it straddles the end
+ * of the ring buffer.
+ *
  * \param[in]   pProtocol                   Protocol.
  * \param[in]   offset                      Frame offset in the protocol work buffer.
  * \param[out]  pEndOffset                  Frame end offset in the protocol work buffer.
@@ -162,6 +569,7 @@ static SbgErrorCode sbgEComProtocolFindSyncBytes(SbgEComProtocol *pProtocol, siz
  * \param[out]  pTransferId                 Transfer ID.
  * \param[out]  pPageIndex                  Page index.
  * \param[out]  pNrPages                    Number of pages.
+ * \param[out]  pFrame                      Linear frame buffer.
  * \param[out]  pBuffer                     Payload buffer.
  * \param[out]  pSize                       Payload buffer size, in bytes.
  * \return                                  SBG_NO_ERROR if successful,
@@ -169,10 +577,10 @@ static SbgErrorCode sbgEComProtocolFindSyncBytes(SbgEComProtocol *pProtocol, siz
  *                                          SBG_INVALID_FRAME if the frame is invalid,
  *                                          SBG_INVALID_CRC if the frame CRC is invalid.
  */
-static SbgErrorCode sbgEComProtocolParseFrame(SbgEComProtocol *pProtocol, size_t offset, size_t *pEndOffset, uint8_t *pMsgClass, uint8_t *pMsgId, uint8_t *pTransferId, uint16_t *pPageIndex, uint16_t *pNrPages, void **pBuffer, size_t *pSize)
+static SbgErrorCode sbgEComProtocolParseFrame(SbgEComProtocol *pProtocol, size_t offset, size_t *pEndOffset, uint8_t *pMsgClass, uint8_t *pMsgId, uint8_t *pTransferId, uint16_t *pPageIndex, uint16_t *pNrPages, uint8_t **pFrame, void **pBuffer, size_t *pSize)
 {
     SbgErrorCode                         errorCode;
-    SbgStreamBuffer                      streamBuffer;
+    size_t                               availableSize;
     uint8_t                              msgId;
     uint8_t                              msgClass;
     size_t                               standardPayloadSize;
@@ -185,28 +593,26 @@ static SbgErrorCode sbgEComProtocolParseFrame(SbgEComProtocol *pProtocol, size_t
     assert(pTransferId);
     assert(pPageIndex);
     assert(pNrPages);
+    assert(pFrame);
     assert(pBuffer);
     assert(pSize);
 
-    sbgStreamBufferInitForRead(&streamBuffer, &pProtocol->rxBuffer[offset], pProtocol->rxBufferSize - offset);
+    availableSize = pProtocol->rxBufferSize - offset;
 
     //
-    // Skip SYNC bytes.
+    // The standard header is made of the SYNC bytes, the message ID and class, and the payload size.
     //
-    sbgStreamBufferSeek(&streamBuffer, 2, SB_SEEK_CUR_INC);
-
-    msgId               = sbgStreamBufferReadUint8(&streamBuffer);
-    msgClass            = sbgStreamBufferReadUint8(&streamBuffer);
-    standardPayloadSize = sbgStreamBufferReadUint16LE(&streamBuffer);
-
-    errorCode = sbgStreamBufferGetLastError(&streamBuffer);
-
-    if (errorCode == SBG_NO_ERROR)
+    if (availableSize >= 6)
     {
+        msgId               = sbgEComProtocolRxGetUint8(pProtocol, offset + 2);
+        msgClass            = sbgEComProtocolRxGetUint8(pProtocol, offset + 3);
+        standardPayloadSize = sbgEComProtocolRxGetUint16LE(pProtocol, offset + 4);
+
         if (standardPayloadSize <= SBG_ECOM_MAX_PAYLOAD_SIZE)
         {
-            if (sbgStreamBufferGetSize(&streamBuffer) >= (standardPayloadSize + 9))
+            if (availableSize >= (standardPayloadSize + 9))
             {
+                size_t                   payloadOffset;
                 size_t                   payloadSize;
                 uint8_t                  transferId;
                 uint16_t                 pageIndex;
@@ -214,26 +620,28 @@ static SbgErrorCode sbgEComProtocolParseFrame(SbgEComProtocol *pProtocol, size_t
 
                 if ((msgClass & 0x80) == 0)
                 {
-                    payloadSize = standardPayloadSize;
+                    payloadOffset   = 6;
+                    payloadSize     = standardPayloadSize;
 
-                    transferId  = 0;
-                    pageIndex   = 0;
-                    nrPages     = 0;
+                    transferId      = 0;
+                    pageIndex       = 0;
+                    nrPages         = 0;
 
                     errorCode = SBG_NO_ERROR;
                 }
-                else
+                else if (standardPayloadSize >= 5)
                 {
                     msgClass &= 0x7f;
 
                     //
                     // In extended frames, the payload size includes the extended headers.
                     //
-                    payloadSize = standardPayloadSize - 5;
+                    payloadOffset   = 11;
+                    payloadSize     = standardPayloadSize - 5;
 
-                    transferId  = sbgStreamBufferReadUint8(&streamBuffer);
-                    pageIndex   = sbgStreamBufferReadUint16LE(&streamBuffer);
-                    nrPages     = sbgStreamBufferReadUint16LE(&streamBuffer);
+                    transferId      = sbgEComProtocolRxGetUint8(pProtocol, offset + 6);
+                    pageIndex       = sbgEComProtocolRxGetUint16LE(pProtocol, offset + 7);
+                    nrPages         = sbgEComProtocolRxGetUint16LE(pProtocol, offset + 9);
 
                     if ((transferId & 0xf0) != 0)
                     {
@@ -251,21 +659,19 @@ static SbgErrorCode sbgEComProtocolParseFrame(SbgEComProtocol *pProtocol, size_t
                         SBG_LOG_ERROR(errorCode, "invalid page information : %" PRIu16 "/%" PRIu16, pageIndex, nrPages);
                     }
                 }
+                else
+                {
+                    errorCode = SBG_INVALID_FRAME;
+                    SBG_LOG_ERROR(errorCode, "invalid extended payload size %zu", standardPayloadSize);
+                }
 
                 if (errorCode == SBG_NO_ERROR)
                 {
-                    void                *pPayloadAddr;
                     uint16_t             frameCrc;
                     uint8_t              lastByte;
 
-                    pPayloadAddr = sbgStreamBufferGetCursor(&streamBuffer);
-
-                    sbgStreamBufferSeek(&streamBuffer, payloadSize, SB_SEEK_CUR_INC);
-
-                    frameCrc    = sbgStreamBufferReadUint16LE(&streamBuffer);
-                    lastByte    = sbgStreamBufferReadUint8(&streamBuffer);
-
-                    assert(sbgStreamBufferGetLastError(&streamBuffer) == SBG_NO_ERROR);
+                    frameCrc    = sbgEComProtocolRxGetUint16LE(pProtocol, offset + standardPayloadSize + 6);
+                    lastByte    = sbgEComProtocolRxGetUint8(pProtocol, offset + standardPayloadSize + 8);
 
                     if (lastByte == SBG_ECOM_ETX)
                     {
@@ -274,18 +680,22 @@ static SbgErrorCode sbgEComProtocolParseFrame(SbgEComProtocol *pProtocol, size_t
                         //
                         // The CRC spans from the header (excluding the SYNC bytes) up to the CRC bytes.
                         //
-                        sbgStreamBufferSeek(&streamBuffer, 2, SB_SEEK_SET);
-                        computedCrc = sbgCrc16Compute(sbgStreamBufferGetCursor(&streamBuffer), standardPayloadSize + 4);
+                        computedCrc = sbgEComProtocolRxComputeCrc(pProtocol, offset + 2, standardPayloadSize + 4);
 
                         if (frameCrc == computedCrc)
                         {
+                            uint8_t     *pFrameBuffer;
+
+                            pFrameBuffer = sbgEComProtocolRxGetLinearBuffer(pProtocol, offset, standardPayloadSize + 9);
+
                             *pEndOffset     = offset + standardPayloadSize + 9;
                             *pMsgClass      = msgClass;
                             *pMsgId         = msgId;
                             *pTransferId    = transferId;
                             *pPageIndex     = pageIndex;
                             *pNrPages       = nrPages;
-                            *pBuffer        = pPayloadAddr;
+                            *pFrame         = pFrameBuffer;
+                            *pBuffer        = &pFrameBuffer[payloadOffset];
                             *pSize          = payloadSize;
 
                             errorCode = SBG_NO_ERROR;
@@ -357,8 +767,9 @@ static SbgErrorCode sbgEComProtocolFindFrame(SbgEComProtocol *pProtocol, uint8_t
         if (errorCode == SBG_NO_ERROR)
         {
             size_t                       endOffset;
+            uint8_t                     *pFrame;
 
-            errorCode = sbgEComProtocolParseFrame(pProtocol, offset, &endOffset, pMsgClass, pMsgId, pTransferId, pPageIndex, pNrPages, pBuffer, pSize);
+            errorCode = sbgEComProtocolParseFrame(pProtocol, offset, &endOffset, pMsgClass, pMsgId, pTransferId, pPageIndex, pNrPages, &pFrame, pBuffer, pSize);
 
             if (errorCode == SBG_NO_ERROR)
             {
@@ -367,7 +778,16 @@ static SbgErrorCode sbgEComProtocolFindFrame(SbgEComProtocol *pProtocol, uint8_t
                 // on the next read.
                 //
                 pProtocol->discardSize = endOffset;
-                
+                pProtocol->stats.nrDiscardedBytes += offset;
+                pProtocol->stats.nrFrames++;
+
+                sbgEComProtocolRxGetTimestamp(pProtocol, offset, &pProtocol->rxFrameTimestamp);
+
+                if (*pMsgClass < SBG_ECOM_STATS_NR_CLASSES)
+                {
+                    pProtocol->nrFramesPerMsg[*pMsgClass][*pMsgId]++;
+                }
+
                 //
                 // If installed, call the method used to intercept received sbgECom frames
                 //
@@ -375,7 +795,7 @@ static SbgErrorCode sbgEComProtocolFindFrame(SbgEComProtocol *pProtocol, uint8_t
                 {
                     SbgStreamBuffer     fullFrameStream;
 
-                    sbgStreamBufferInitForRead(&fullFrameStream, &pProtocol->rxBuffer[offset], endOffset-offset);
+                    sbgStreamBufferInitForRead(&fullFrameStream, pFrame, endOffset-offset);
                     pProtocol->pReceiveFrameCb(pProtocol, *pMsgClass, *pMsgId, &fullFrameStream, pProtocol->pUserArg);
                 }
 
@@ -388,6 +808,7 @@ static SbgErrorCode sbgEComProtocolFindFrame(SbgEComProtocol *pProtocol, uint8_t
                 // Have all preceding bytes discarded on the next read.
                 //
                 pProtocol->discardSize = offset;
+                pProtocol->stats.nrDiscardedBytes += offset;
                 break;
             }
             else
@@ -395,6 +816,15 @@ static SbgErrorCode sbgEComProtocolFindFrame(SbgEComProtocol *pProtocol, uint8_t
                 //
                 // Not a valid frame, skip SYNC bytes and try again.
                 //
+                if (errorCode == SBG_INVALID_CRC)
+                {
+                    pProtocol->stats.nrCrcErrors++;
+                }
+                else
+                {
+                    pProtocol->stats.nrInvalidFrames++;
+                }
+
                 startOffset = offset + 2;
                 errorCode = SBG_NOT_READY;
             }
@@ -407,6 +837,7 @@ static SbgErrorCode sbgEComProtocolFindFrame(SbgEComProtocol *pProtocol, uint8_t
             // on the next read.
             //
             pProtocol->discardSize = offset;
+            pProtocol->stats.nrDiscardedBytes += offset;
             errorCode = SBG_NOT_READY;
             break;
         }
@@ -415,7 +846,8 @@ static SbgErrorCode sbgEComProtocolFindFrame(SbgEComProtocol *pProtocol, uint8_t
             //
             // No SYNC byte found, discard all data.
             //
-            pProtocol->rxBufferSize = 0;
+            pProtocol->stats.nrDiscardedBytes += pProtocol->rxBufferSize;
+            sbgEComProtocolRxClear(pProtocol);
             errorCode = SBG_NOT_READY;
             break;
         }
@@ -423,6 +855,11 @@ static SbgErrorCode sbgEComProtocolFindFrame(SbgEComProtocol *pProtocol, uint8_t
 
     assert(pProtocol->discardSize <= pProtocol->rxBufferSize);
 
+    //
+    // More frames may follow a valid one, but all complete frames have been consumed otherwise.
+    //
+    pProtocol->rxFramePending = (errorCode == SBG_NO_ERROR) && (pProtocol->discardSize < pProtocol->rxBufferSize);
+
     return errorCode;
 }
 
@@ -584,7 +1021,7 @@ static bool sbgEComProtocolLargeTransferInProgress(const SbgEComProtocol *pProto
 {
     assert(pProtocol);
 
-    return pProtocol->pLargeBuffer;
+    return pProtocol->nrPages != 0;
 }
 
 /*!
@@ -596,7 +1033,6 @@ static void sbgEComProtocolResetLargeTransfer(SbgEComProtocol *pProtocol)
 {
     assert(pProtocol);
 
-    pProtocol->pLargeBuffer     = NULL;
     pProtocol->largeBufferSize  = 0;
     pProtocol->transferId       = 0;
     pProtocol->pageIndex        = 0;
@@ -604,17 +1040,64 @@ static void sbgEComProtocolResetLargeTransfer(SbgEComProtocol *pProtocol)
 }
 
 /*!
- * Clear any large transfer in progress.
+ * Make sure the large transfer buffer of a protocol can hold a given number of bytes.
+ *
+ * The buffer only grows, and its content isn't preserved.
  *
  * \param[in]   pProtocol                   Protocol.
+ * \param[in]   size                        Required capacity, in bytes.
+ * \return                                  SBG_NO_ERROR if successful,
+ *                                          SBG_MALLOC_FAILED if the buffer can't be allocated.
  */
-static void sbgEComProtocolClearLargeTransfer(SbgEComProtocol *pProtocol)
+static SbgErrorCode sbgEComProtocolReserveLargeBuffer(SbgEComProtocol *pProtocol, size_t size)
 {
+    SbgErrorCode                         errorCode;
+
     assert(pProtocol);
 
-    free(pProtocol->pLargeBuffer);
+    if (size > pProtocol->largeBufferCapacity)
+    {
+        uint8_t                         *pBuffer;
+
+        pBuffer = malloc(size);
+
+        if (pBuffer)
+        {
+            free(pProtocol->pLargeBuffer);
+
+            pProtocol->pLargeBuffer         = pBuffer;
+            pProtocol->largeBufferCapacity  = size;
+
+            errorCode = SBG_NO_ERROR;
+        }
+        else
+        {
+            errorCode = SBG_MALLOC_FAILED;
+            SBG_LOG_ERROR(errorCode, "unable to allocate buffer");
+        }
+    }
+    else
+    {
+        errorCode = SBG_NO_ERROR;
+    }
+
+    return errorCode;
+}
+
+/*!
+ * Terminate the large transfer in progress before its completion.
+ *
+ * \param[in]   pProtocol                   Protocol.
+ */
+static void sbgEComProtocolAbortLargeTransfer(SbgEComProtocol *pProtocol)
+{
+    assert(pProtocol);
+
+    SBG_LOG_ERROR(SBG_ERROR, "terminating large transfer");
 
     sbgEComProtocolResetLargeTransfer(pProtocol);
+
+    pProtocol->stats.nrLargeTransferAborts++;
 }
 
 /*!
@@ -648,30 +1131,33 @@ static SbgErrorCode sbgEComProtocolProcessExtendedFrame(SbgEComProtocol *pProtoc
         if (sbgEComProtocolLargeTransferInProgress(pProtocol))
         {
             SBG_LOG_ERROR(SBG_ERROR, "large transfer started while a large transfer is in progress");
-            SBG_LOG_ERROR(SBG_ERROR, "terminating large transfer");
-
-            sbgEComProtocolClearLargeTransfer(pProtocol);
+            sbgEComProtocolAbortLargeTransfer(pProtocol);
         }
 
         capacity = nrPages * SBG_ECOM_MAX_EXTENDED_PAYLOAD_SIZE;
 
-        pProtocol->pLargeBuffer = malloc(capacity);
-
-        if (pProtocol->pLargeBuffer)
+        if ((pProtocol->maxLargeTransferSize == 0) || (capacity <= pProtocol->maxLargeTransferSize))
         {
-            pProtocol->largeBufferSize  = 0;
-            pProtocol->msgClass         = msgClass;
-            pProtocol->msgId            = msgId;
-            pProtocol->transferId       = transferId;
-            pProtocol->pageIndex        = 0;
-            pProtocol->nrPages          = nrPages;
-
-            errorCode = SBG_NO_ERROR;
+            errorCode = sbgEComProtocolReserveLargeBuffer(pProtocol, capacity);
         }
         else
         {
-            SBG_LOG_ERROR(SBG_MALLOC_FAILED, "unable to allocate buffer");
+            errorCode = SBG_BUFFER_OVERFLOW;
+            SBG_LOG_ERROR(errorCode, "large transfer of %" PRIu16 " pages exceeds the maximum size %zu", nrPages, pProtocol->maxLargeTransferSize);
+        }
 
+        if (errorCode == SBG_NO_ERROR)
+        {
+            pProtocol->largeBufferSize          = 0;
+            pProtocol->msgClass                 = msgClass;
+            pProtocol->msgId                    = msgId;
+            pProtocol->transferId               = transferId;
+            pProtocol->pageIndex                = 0;
+            pProtocol->nrPages                  = nrPages;
+            pProtocol->largeTransferTimestamp   = pProtocol->rxFrameTimestamp;
+        }
+        else
+        {
             sbgEComProtocolResetLargeTransfer(pProtocol);
 
             errorCode = SBG_NOT_READY;
@@ -693,84 +1179,53 @@ static SbgErrorCode sbgEComProtocolProcessExtendedFrame(SbgEComProtocol *pProtoc
 
     if (errorCode == SBG_NO_ERROR)
     {
-        if (msgClass == pProtocol->msgClass)
-        {
-            errorCode = SBG_NO_ERROR;
-        }
-        else
+        if (msgClass != pProtocol->msgClass)
         {
             SBG_LOG_ERROR(SBG_ERROR, "message class mismatch in extended frame");
-            SBG_LOG_ERROR(SBG_ERROR, "terminating large transfer");
-
-            sbgEComProtocolClearLargeTransfer(pProtocol);
+            sbgEComProtocolAbortLargeTransfer(pProtocol);
 
             errorCode = SBG_NOT_READY;
         }
-
-        if (msgId == pProtocol->msgId)
-        {
-            errorCode = SBG_NO_ERROR;
-        }
-        else
+        else if (msgId != pProtocol->msgId)
         {
             SBG_LOG_ERROR(SBG_ERROR, "message ID mismatch in extended frame");
-            SBG_LOG_ERROR(SBG_ERROR, "terminating large transfer");
-
-            sbgEComProtocolClearLargeTransfer(pProtocol);
+            sbgEComProtocolAbortLargeTransfer(pProtocol);
 
             errorCode = SBG_NOT_READY;
         }
-
-        if (transferId == pProtocol->transferId)
-        {
-            errorCode = SBG_NO_ERROR;
-        }
-        else
+        else if (transferId != pProtocol->transferId)
         {
             SBG_LOG_ERROR(SBG_ERROR, "transfer ID mismatch in extended frame");
-            SBG_LOG_ERROR(SBG_ERROR, "terminating large transfer");
-
-            sbgEComProtocolClearLargeTransfer(pProtocol);
+            sbgEComProtocolAbortLargeTransfer(pProtocol);
 
             errorCode = SBG_NOT_READY;
         }
-
-        if (errorCode == SBG_NO_ERROR)
+        else if (nrPages != pProtocol->nrPages)
         {
-            if (nrPages == pProtocol->nrPages)
-            {
-                if (pageIndex == pProtocol->pageIndex)
-                {
-                    size_t               offset;
+            SBG_LOG_ERROR(SBG_ERROR, "page count mismatch in extended frame");
+            sbgEComProtocolAbortLargeTransfer(pProtocol);
 
-                    offset = pageIndex * SBG_ECOM_MAX_EXTENDED_PAYLOAD_SIZE;
-                    memcpy(&pProtocol->pLargeBuffer[offset], pBuffer, size);
+            errorCode = SBG_NOT_READY;
+        }
+        else if (pageIndex != pProtocol->pageIndex)
+        {
+            SBG_LOG_ERROR(SBG_ERROR, "extended frame received out of sequence");
+            sbgEComProtocolAbortLargeTransfer(pProtocol);
 
-                    pProtocol->largeBufferSize += size;
-                    pProtocol->pageIndex++;
+            errorCode = SBG_NOT_READY;
+        }
+        else
+        {
+            size_t                       offset;
 
-                    if (pProtocol->pageIndex != pProtocol->nrPages)
-                    {
-                        errorCode = SBG_NOT_READY;
-                    }
-                }
-                else
-                {
-                    SBG_LOG_ERROR(SBG_ERROR, "extended frame received out of sequence");
-                    SBG_LOG_ERROR(SBG_ERROR, "terminating large transfer");
+            offset = pageIndex * SBG_ECOM_MAX_EXTENDED_PAYLOAD_SIZE;
+            memcpy(&pProtocol->pLargeBuffer[offset], pBuffer, size);
 
-                    sbgEComProtocolClearLargeTransfer(pProtocol);
+            pProtocol->largeBufferSize += size;
+            pProtocol->pageIndex++;
 
-                    errorCode = SBG_NOT_READY;
-                }
-            }
-            else
+            if (pProtocol->pageIndex != pProtocol->nrPages)
             {
-                SBG_LOG_ERROR(SBG_ERROR, "page count mismatch in extended frame");
-                SBG_LOG_ERROR(SBG_ERROR, "terminating large transfer");
-
-                sbgEComProtocolClearLargeTransfer(pProtocol);
-
                 errorCode = SBG_NOT_READY;
             }
         }
@@ -865,7 +1320,12 @@ SbgErrorCode sbgEComProtocolInit(SbgEComProtocol *pProtocol, SbgInterface *pInte
 
     memset(pProtocol, 0x00, sizeof(*pProtocol));
 
-    pProtocol->pLinkedInterface = pInterface;
+    pProtocol->pLinkedInterface     = pInterface;
+    pProtocol->pRxBuffer            = pProtocol->rxDefaultBuffer;
+    pProtocol->rxBufferCapacity     = sizeof(pProtocol->rxDefaultBuffer);
+    pProtocol->rxBufferAllocated    = false;
+
+    sbgEComProtocolRxClear(pProtocol);
 
     sbgEComProtocolResetLargeTransfer(pProtocol);
 
@@ -877,15 +1337,167 @@ SbgErrorCode sbgEComProtocolClose(SbgEComProtocol *pProtocol)
     assert(pProtocol);
 
     pProtocol->pLinkedInterface = NULL;
-    pProtocol->rxBufferSize     = 0;
-    pProtocol->discardSize      = 0;
     pProtocol->nextLargeTxId    = 0;
+    pProtocol->rxMapped         = false;
+    pProtocol->rxMappedSize     = 0;
+
+    sbgEComProtocolRxClear(pProtocol);
 
-    sbgEComProtocolClearLargeTransfer(pProtocol);
+    if (pProtocol->rxBufferAllocated)
+    {
+        free(pProtocol->pRxBuffer);
+    }
+
+    pProtocol->pRxBuffer            = pProtocol->rxDefaultBuffer;
+    pProtocol->rxBufferCapacity     = sizeof(pProtocol->rxDefaultBuffer);
+    pProtocol->rxBufferAllocated    = false;
+
+    sbgEComProtocolResetLargeTransfer(pProtocol);
+
+    free(pProtocol->pLargeBuffer);
+
+    pProtocol->pLargeBuffer         = NULL;
+    pProtocol->largeBufferCapacity  = 0;
+    pProtocol->maxLargeTransferSize = 0;
 
     return SBG_NO_ERROR;
 }
 
+SbgErrorCode sbgEComProtocolSetRxBufferCapacity(SbgEComProtocol *pProtocol, size_t capacity)
+{
+    SbgErrorCode                         errorCode;
+
+    assert(pProtocol);
+
+    //
+    // Release consumed bytes first, only the pending data is moved to the new ring buffer.
+    //
+    sbgEComProtocolDiscardUnusedBytes(pProtocol);
+
+    if (pProtocol->rxMapped)
+    {
+        //
+        // The reception buffer references the interface data, there is no storage to resize
+        //
+        errorCode = SBG_NO_ERROR;
+    }
+    else if ((capacity >= SBG_ECOM_MAX_BUFFER_SIZE) && (capacity >= pProtocol->rxBufferSize))
+    {
+        errorCode = SBG_NO_ERROR;
+
+        if (capacity != pProtocol->rxBufferCapacity)
+        {
+            uint8_t                     *pRxBuffer;
+            bool                         allocated;
+
+            if (capacity == sizeof(pProtocol->rxDefaultBuffer))
+            {
+                pRxBuffer   = pProtocol->rxDefaultBuffer;
+                allocated   = false;
+            }
+            else
+            {
+                pRxBuffer   = malloc(capacity);
+                allocated   = true;
+            }
+
+            if (pRxBuffer)
+            {
+                size_t                   firstPartSize;
+
+                //
+                // Store the pending data at the beginning of the new ring buffer.
+                //
+                firstPartSize = sbgMin(pProtocol->rxBufferSize, pProtocol->rxBufferCapacity - pProtocol->rxBufferHead);
+
+                memcpy(pRxBuffer, &pProtocol->pRxBuffer[pProtocol->rxBufferHead], firstPartSize);
+                memcpy(&pRxBuffer[firstPartSize], pProtocol->pRxBuffer, pProtocol->rxBufferSize - firstPartSize);
+
+                if (pProtocol->rxBufferAllocated)
+                {
+                    free(pProtocol->pRxBuffer);
+                }
+
+                pProtocol->pRxBuffer            = pRxBuffer;
+                pProtocol->rxBufferCapacity     = capacity;
+                pProtocol->rxBufferAllocated    = allocated;
+                pProtocol->rxBufferHead         = 0;
+            }
+            else
+            {
+                errorCode = SBG_MALLOC_FAILED;
+                SBG_LOG_ERROR(errorCode, "unable to allocate reception buffer");
+            }
+        }
+    }
+    else
+    {
+        errorCode = SBG_INVALID_PARAMETER;
+        SBG_LOG_ERROR(errorCode, "invalid reception buffer capacity: %zu", capacity);
+    }
+
+    return errorCode;
+}
+
+size_t sbgEComProtocolGetRxBufferCapacity(const SbgEComProtocol *pProtocol)
+{
+    assert(pProtocol);
+
+    return pProtocol->rxBufferCapacity;
+}
+
+SbgErrorCode sbgEComProtocolSetMaxLargeTransferSize(SbgEComProtocol *pProtocol, size_t maxSize)
+{
+    SbgErrorCode                         errorCode;
+
+    assert(pProtocol);
+
+    sbgEComProtocolResetLargeTransfer(pProtocol);
+
+    errorCode = sbgEComProtocolReserveLargeBuffer(pProtocol, maxSize);
+
+    if (errorCode == SBG_NO_ERROR)
+    {
+        pProtocol->maxLargeTransferSize = maxSize;
+    }
+
+    return errorCode;
+}
+
+void sbgEComProtocolGetStats(const SbgEComProtocol *pProtocol, SbgEComProtocolStats *pStats)
+{
+    assert(pProtocol);
+    assert(pStats);
+
+    *pStats = pProtocol->stats;
+}
+
+uint32_t sbgEComProtocolGetNrFrames(const SbgEComProtocol *pProtocol, uint8_t msgClass, uint8_t msgId)
+{
+    uint32_t                             nrFrames;
+
+    assert(pProtocol);
+
+    if (msgClass < SBG_ECOM_STATS_NR_CLASSES)
+    {
+        nrFrames = pProtocol->nrFramesPerMsg[msgClass][msgId];
+    }
+    else
+    {
+        nrFrames = 0;
+    }
+
+    return nrFrames;
+}
+
+void sbgEComProtocolResetStats(SbgEComProtocol *pProtocol)
+{
+    assert(pProtocol);
+
+    memset(&pProtocol->stats, 0x00, sizeof(pProtocol->stats));
+    memset(pProtocol->nrFramesPerMsg, 0x00, sizeof(pProtocol->nrFramesPerMsg));
+}
+
 SbgErrorCode sbgEComProtocolPurgeIncoming(SbgEComProtocol *pProtocol)
 {
     SbgErrorCode    errorCode = SBG_NO_ERROR;
@@ -893,13 +1505,9 @@ SbgErrorCode sbgEComProtocolPurgeIncoming(SbgEComProtocol *pProtocol)
     uint32_t        timeStamp;
 
     //
-    // Reset the work buffer
+    // Reset the work buffer, the interface data is read into the buffer storage below
     //
-    pProtocol->rxBufferSize     = 0;
-    pProtocol->discardSize      = 0;
-    pProtocol->nextLargeTxId    = 0;
-
-    sbgEComProtocolClearLargeTransfer(pProtocol);
+    sbgEComProtocolClearIncoming(pProtocol);
 
     //
     // Try to read all incoming data for at least 100 ms and trash them
@@ -908,13 +1516,17 @@ SbgErrorCode sbgEComProtocolPurgeIncoming(SbgEComProtocol *pProtocol)
 
     do
     {
-        errorCode = sbgInterfaceRead(pProtocol->pLinkedInterface, pProtocol->rxBuffer, &numBytesRead, sizeof(pProtocol->rxBuffer));
+        errorCode = sbgInterfaceRead(pProtocol->pLinkedInterface, pProtocol->pRxBuffer, &numBytesRead, pProtocol->rxBufferCapacity);
+        pProtocol->stats.nrReads++;
 
         if (errorCode != SBG_NO_ERROR)
         {
             SBG_LOG_ERROR(errorCode, "Unable to read data from interface");
             break;
         }
+
+        pProtocol->stats.nrBytesRead        += numBytesRead;
+        pProtocol->stats.nrDiscardedBytes   += numBytesRead;
     } while ((sbgGetTime() - timeStamp) < 100);
 
     //
@@ -929,6 +1541,20 @@ SbgErrorCode sbgEComProtocolPurgeIncoming(SbgEComProtocol *pProtocol)
     return errorCode;
 }
 
+void sbgEComProtocolClearIncoming(SbgEComProtocol *pProtocol)
+{
+    assert(pProtocol);
+
+    //
+    // A mapped region is released first, so that only the bytes already parsed are skipped
+    //
+    sbgEComProtocolRxUnmap(pProtocol);
+    sbgEComProtocolRxClear(pProtocol);
+    pProtocol->nextLargeTxId    = 0;
+
+    sbgEComProtocolResetLargeTransfer(pProtocol);
+}
+
 SbgErrorCode sbgEComProtocolSend(SbgEComProtocol *pProtocol, uint8_t msgClass, uint8_t msgId, const void *pData, size_t size)
 {
     SbgErrorCode                         errorCode;
@@ -1058,9 +1684,7 @@ SbgErrorCode sbgEComProtocolReceive2(SbgEComProtocol *pProtocol, uint8_t *pMsgCl
             if (sbgEComProtocolLargeTransferInProgress(pProtocol))
             {
                 SBG_LOG_ERROR(SBG_ERROR, "standard frame received while a large transfer is in progress");
-                SBG_LOG_ERROR(SBG_ERROR, "terminating large transfer");
-
-                sbgEComProtocolClearLargeTransfer(pProtocol);
+                sbgEComProtocolAbortLargeTransfer(pProtocol);
             }
 
             if (pMsgClass)
@@ -1074,6 +1698,7 @@ SbgErrorCode sbgEComProtocolReceive2(SbgEComProtocol *pProtocol, uint8_t *pMsgCl
             }
 
             sbgEComProtocolPayloadSet(pPayload, false, pBuffer, size);
+            pProtocol->receiveTimestamp = pProtocol->rxFrameTimestamp;
         }
         else
         {
@@ -1091,7 +1716,8 @@ SbgErrorCode sbgEComProtocolReceive2(SbgEComProtocol *pProtocol, uint8_t *pMsgCl
                     *pMsgId = msgId;
                 }
 
-                sbgEComProtocolPayloadSet(pPayload, true, pProtocol->pLargeBuffer, pProtocol->largeBufferSize);
+                sbgEComProtocolPayloadSet(pPayload, false, pProtocol->pLargeBuffer, pProtocol->largeBufferSize);
+                pProtocol->receiveTimestamp = pProtocol->largeTransferTimestamp;
                 sbgEComProtocolResetLargeTransfer(pProtocol);
             }
         }
@@ -1100,6 +1726,31 @@ SbgErrorCode sbgEComProtocolReceive2(SbgEComProtocol *pProtocol, uint8_t *pMsgCl
     return errorCode;
 }
 
+const SbgInterfaceTimestamp *sbgEComProtocolGetReceiveTimestamp(const SbgEComProtocol *pProtocol)
+{
+    assert(pProtocol);
+
+    return &pProtocol->receiveTimestamp;
+}
+
+SbgErrorCode sbgEComProtocolWaitReadable(SbgEComProtocol *pProtocol, uint32_t timeOut)
+{
+    SbgErrorCode                         errorCode;
+
+    assert(pProtocol);
+
+    if (pProtocol->rxFramePending)
+    {
+        errorCode = SBG_NO_ERROR;
+    }
+    else
+    {
+        errorCode = sbgInterfaceWaitReadable(pProtocol->pLinkedInterface, timeOut);
+    }
+
+    return errorCode;
+}
+
 void sbgEComProtocolSetOnFrameReceivedCb(SbgEComProtocol *pProtocol, SbgEComProtocolFrameCb pOnFrameReceivedCb, void *pUserArg)
 {
     assert(pProtocol);
@@ -60,6 +60,11 @@ extern "C" {
 
 #define SBG_ECOM_RX_TIME_OUT                    (450)                   /*!< Default time out for new frame reception. */
 
+#define SBG_ECOM_STATS_NR_CLASSES               (0x11)                  /*!< Number of message classes, starting from 0, with per message frame counters. */
+#define SBG_ECOM_STATS_NR_MSG_IDS               (256)                   /*!< Number of message IDs per class with frame counters. */
+
+#define SBG_ECOM_RX_NR_TIMESTAMPS               (32)                    /*!< Maximum number of time stamped reads tracked in the reception buffer. */
+
 //----------------------------------------------------------------------//
 //- Callbacks definitions                                              -//
 //----------------------------------------------------------------------//
@@ -100,19 +105,84 @@ typedef struct _SbgEComProtocolPayload
     size_t                               size;                                      /*!< Buffer size, in bytes. */
 } SbgEComProtocolPayload;
 
+/*!
+ * Reception time of the data read into the reception buffer.
+ */
+typedef struct _SbgEComProtocolRxTimestamp
+{
+    size_t                               offset;                                    /*!< Offset of the first byte read, from the head of the reception buffer. */
+    SbgInterfaceTimestamp                timestamp;                                 /*!< Reception time of the read. */
+} SbgEComProtocolRxTimestamp;
+
+/*!
+ * Reception statistics of a protocol.
+ *
+ * All counters are cumulative since the protocol initialization or the last statistics reset.
+ */
+typedef struct _SbgEComProtocolStats
+{
+    uint64_t                             nrReads;                                   /*!< Number of calls to sbgInterfaceRead(). */
+    uint64_t                             nrBytesRead;                               /*!< Number of bytes read from the interface. */
+    uint64_t                             nrFrames;                                  /*!< Number of valid frames received, each page of a large transfer counts as a frame. */
+    uint64_t                             nrCrcErrors;                               /*!< Number of frames rejected because of an invalid CRC. */
+    uint64_t                             nrInvalidFrames;                           /*!< Number of frames rejected because of an invalid size, end-of-frame or page information. */
+    uint64_t                             nrDiscardedBytes;                          /*!< Number of bytes discarded while looking for SYNC bytes. */
+    uint64_t                             nrLargeTransferAborts;                     /*!< Number of large transfers terminated before completion. */
+    size_t                               rxHighWaterMark;                           /*!< Largest number of bytes held by the reception ring buffer, in bytes. */
+} SbgEComProtocolStats;
+
 /*!
  * Struct containing all protocol related data.
  *
- * The member variables related to large transfers are valid if and only if the large buffer is valid.
+ * The reception buffer is a ring buffer: received bytes are stored from the head offset and wrap
+ * around at the buffer capacity. Consumed bytes are released by moving the head, so no data is moved
+ * in memory. A frame is only copied, into the frame buffer, when it straddles the end of the ring.
+ *
+ * The reception buffer uses the embedded default storage unless a larger one has been allocated,
+ * so a protocol instance must not be moved in memory once initialized.
+ *
+ * Each read into the reception buffer is time stamped by the interface, so the reception time of the first
+ * byte of each frame is known. If more reads than SBG_ECOM_RX_NR_TIMESTAMPS are pending, the data of the
+ * latest reads is attributed to the last tracked read.
+ *
+ * If the interface supports peek operations, such as a mapped file, the reception buffer directly references
+ * the interface data instead: the whole data that can be read is seen as a ring buffer that never wraps, and
+ * consumed bytes are skipped on the interface on the next read. No data is copied in this case.
+ *
+ * Large transfers are reassembled into a buffer that is allocated once and kept for the next transfers,
+ * so no allocation occurs in steady state. The member variables related to the transfer in progress are
+ * valid if and only if the number of pages is not zero.
  */
 struct _SbgEComProtocol
 {
     SbgInterface                        *pLinkedInterface;                          /*!< Associated interface used by the protocol to read/write bytes. */
-    uint8_t                              rxBuffer[SBG_ECOM_MAX_BUFFER_SIZE];        /*!< The reception buffer. */
+    uint8_t                             *pRxBuffer;                                 /*!< The reception ring buffer. */
+    size_t                               rxBufferCapacity;                          /*!< Capacity of the reception ring buffer, in bytes. */
+    bool                                 rxBufferAllocated;                         /*!< True if the reception ring buffer is allocated with malloc(). */
+    size_t                               rxBufferHead;                              /*!< Offset of the first valid byte in the reception ring buffer. */
     size_t                               rxBufferSize;                              /*!< The current reception buffer size in bytes. */
     size_t                               discardSize;                               /*!< Number of bytes to discard on the next receive attempt. */
+    bool                                 rxFramePending;                            /*!< True if the reception buffer may hold a complete frame not received yet. */
+    bool                                 rxMapped;                                  /*!< True if the reception buffer references the interface data. */
+    size_t                               rxMappedSize;                              /*!< Size of the interface data referenced by the reception buffer, in bytes. */
+    uint8_t                              rxDefaultBuffer[SBG_ECOM_MAX_BUFFER_SIZE]; /*!< Default storage for the reception ring buffer. */
+    uint8_t                              rxFrameBuffer[SBG_ECOM_MAX_BUFFER_SIZE];   /*!< Linear copy of the last received frame if it straddled the end of the ring buffer. */
     uint8_t                              nextLargeTxId;                             /*!< Transfer ID of the next large send. */
 
+    //
+    // Reception time stamps
+    //
+    SbgEComProtocolRxTimestamp           rxTimestamps[SBG_ECOM_RX_NR_TIMESTAMPS];   /*!< Reception times of the reads held by the reception buffer, by increasing offset. */
+    size_t                               rxNrTimestamps;                            /*!< Number of valid reception times. */
+    SbgInterfaceTimestamp                rxFrameTimestamp;                          /*!< Reception time of the first byte of the last frame found. */
+    SbgInterfaceTimestamp                receiveTimestamp;                          /*!< Reception time of the last payload returned by sbgEComProtocolReceive2(). */
+
+    //
+    // Reception statistics
+    //
+    SbgEComProtocolStats                 stats;                                     /*!< Reception statistics. */
+    uint32_t                             nrFramesPerMsg[SBG_ECOM_STATS_NR_CLASSES][SBG_ECOM_STATS_NR_MSG_IDS];  /*!< Number of valid frames received per message class and ID, wraps around. */
+
     //
     // Raw stream sbgECom frame reception callback
     //
@@ -122,13 +192,16 @@ struct _SbgEComProtocol
     //
     // Member variables related to large transfer reception.
     //
-    uint8_t                             *pLargeBuffer;                              /*!< Buffer for large transfers, allocated with malloc() if valid. */
-    size_t                               largeBufferSize;                           /*!< Size of the large transfer buffer, in bytes. */
+    uint8_t                             *pLargeBuffer;                              /*!< Reusable buffer for large transfers, allocated with malloc() if valid. */
+    size_t                               largeBufferCapacity;                       /*!< Capacity of the large transfer buffer, in bytes. */
+    size_t                               maxLargeTransferSize;                      /*!< Maximum size of a large transfer, in bytes, 0 if unlimited. */
+    size_t                               largeBufferSize;                           /*!< Size of the data received for the current large transfer, in bytes. */
     uint8_t                              msgClass;                                  /*!< Message class for the current large transfer. */
     uint8_t                              msgId;                                     /*!< Message ID for the current large transfer. */
     uint8_t                              transferId;                                /*!< ID of the current large transfer. */
     uint16_t                             pageIndex;                                 /*!< Expected page index of the next frame. */
     uint16_t                             nrPages;                                   /*!< Number of pages in the current transfer. */
+    SbgInterfaceTimestamp                largeTransferTimestamp;                    /*!< Reception time of the first page of the current transfer. */
 };
 
 //----------------------------------------------------------------------//
@@ -199,6 +272,75 @@ SbgErrorCode sbgEComProtocolInit(SbgEComProtocol *pProtocol, SbgInterface *pInte
  */
 SbgErrorCode sbgEComProtocolClose(SbgEComProtocol *pProtocol);
 
+/*!
+ * Set the capacity of the reception ring buffer.
+ *
+ * A larger ring buffer absorbs bigger bursts of incoming data between two receive calls.
+ * Any data already received is preserved.
+ *
+ * The capacity doesn't apply if the interface supports peek operations, as the reception buffer
+ * then references the interface data.
+ *
+ * \param[in]   pProtocol                       A valid protocol instance.
+ * \param[in]   capacity                        Ring buffer capacity, in bytes, at least SBG_ECOM_MAX_BUFFER_SIZE.
+ * \return                                      SBG_NO_ERROR if successful,
+ *                                              SBG_INVALID_PARAMETER if the capacity is too small or can't hold the data already received,
+ *                                              SBG_MALLOC_FAILED if the ring buffer can't be allocated.
+ */
+SbgErrorCode sbgEComProtocolSetRxBufferCapacity(SbgEComProtocol *pProtocol, size_t capacity);
+
+/*!
+ * Get the capacity of the reception ring buffer.
+ *
+ * \param[in]   pProtocol                       A valid protocol instance.
+ * \return                                      Ring buffer capacity, in bytes.
+ */
+size_t sbgEComProtocolGetRxBufferCapacity(const SbgEComProtocol *pProtocol);
+
+/*!
+ * Set the maximum size of a received large transfer.
+ *
+ * The large transfer buffer is allocated upfront to the maximum size so that large transfers are
+ * received without any allocation. Large transfers that may exceed the maximum size are dropped.
+ *
+ * If no maximum size is set, the large transfer buffer grows on demand and is kept for the next transfers.
+ *
+ * Any large transfer in progress is terminated.
+ *
+ * \param[in]   pProtocol                       A valid protocol instance.
+ * \param[in]   maxSize                         Maximum large transfer size, in bytes, 0 if unlimited.
+ * \return                                      SBG_NO_ERROR if successful,
+ *                                              SBG_MALLOC_FAILED if the large transfer buffer can't be allocated.
+ */
+SbgErrorCode sbgEComProtocolSetMaxLargeTransferSize(SbgEComProtocol *pProtocol, size_t maxSize);
+
+/*!
+ * Get a snapshot of the reception statistics.
+ *
+ * \param[in]   pProtocol                       A valid protocol instance.
+ * \param[out]  pStats                          Reception statistics.
+ */
+void sbgEComProtocolGetStats(const SbgEComProtocol *pProtocol, SbgEComProtocolStats *pStats);
+
+/*!
+ * Get the number of valid frames received for a message.
+ *
+ * Frames are only counted for message classes below SBG_ECOM_STATS_NR_CLASSES.
+ *
+ * \param[in]   pProtocol                       A valid protocol instance.
+ * \param[in]   msgClass                        Message class.
+ * \param[in]   msgId                           Message ID.
+ * \return                                      Number of valid frames received, 0 if the message class isn't counted.
+ */
+uint32_t sbgEComProtocolGetNrFrames(const SbgEComProtocol *pProtocol, uint8_t msgClass, uint8_t msgId);
+
+/*!
+ * Reset the reception statistics.
+ *
+ * \param[in]   pProtocol                       A valid protocol instance.
+ */
+void sbgEComProtocolResetStats(SbgEComProtocol *pProtocol);
+
 /*!
  * Purge the interface rx buffer as well as the sbgECom rx work buffer.
  *
@@ -211,6 +353,16 @@ SbgErrorCode sbgEComProtocolClose(SbgEComProtocol *pProtocol);
  */
 SbgErrorCode sbgEComProtocolPurgeIncoming(SbgEComProtocol *pProtocol);
 
+/*!
+ * Discard the data held by the sbgECom rx work buffer, as well as any pending large transfer.
+ *
+ * Unlike sbgEComProtocolPurgeIncoming(), the interface isn't read, so this method doesn't block.
+ * It is meant to be called once the linked interface has been reopened.
+ *
+ * \param[in]   pProtocol                       A valid protocol instance.
+ */
+void sbgEComProtocolClearIncoming(SbgEComProtocol *pProtocol);
+
 /*!
  * Send data.
  *
@@ -250,8 +402,8 @@ SbgErrorCode sbgEComProtocolReceive(SbgEComProtocol *pProtocol, uint8_t *pMsgCla
  *
  * Any allocated resource associated with the given payload is released when calling this function.
  *
- * Because the payload buffer may directly refer to the protocol work buffer on return, it is only valid until
- * the next attempt to receive a frame, with any of the receive functions.
+ * Because the payload buffer may directly refer to the protocol work buffer or large transfer buffer on return,
+ * it is only valid until the next attempt to receive a frame, with any of the receive functions.
  *
  * \param[in]   pProtocol                       A valid protocol instance.
  * \param[out]  pMsgClass                       Message class, may be NULL.
@@ -262,6 +414,35 @@ SbgErrorCode sbgEComProtocolReceive(SbgEComProtocol *pProtocol, uint8_t *pMsgCla
  */
 SbgErrorCode sbgEComProtocolReceive2(SbgEComProtocol *pProtocol, uint8_t *pMsgClass, uint8_t *pMsgId, SbgEComProtocolPayload *pPayload);
 
+/*!
+ * Get the reception time of the last payload received.
+ *
+ * The time is the one of the first byte of the frame, or of the first page for a large transfer, as
+ * reported by the interface. It is null if the interface doesn't support time stamping.
+ *
+ * The time is only valid after a successful call to any of the receive functions, until the next attempt
+ * to receive a frame.
+ *
+ * \param[in]   pProtocol                       A valid protocol instance.
+ * \return                                      Reception time of the last payload received.
+ */
+const SbgInterfaceTimestamp *sbgEComProtocolGetReceiveTimestamp(const SbgEComProtocol *pProtocol);
+
+/*!
+ * Wait until a frame may be received.
+ *
+ * This function returns immediately if the reception buffer may still hold a complete frame, and otherwise
+ * blocks until the interface becomes readable. It is intended to be called once a receive function
+ * returned SBG_NOT_READY, to avoid polling the interface.
+ *
+ * \param[in]   pProtocol                       A valid protocol instance.
+ * \param[in]   timeOut                         Maximum time to wait, in ms.
+ * \return                                      SBG_NO_ERROR if a frame may be received,
+ *                                              SBG_TIME_OUT if no data has been received before the time out,
+ *                                              SBG_INVALID_PARAMETER if the interface doesn't support wait operations.
+ */
+SbgErrorCode sbgEComProtocolWaitReadable(SbgEComProtocol *pProtocol, uint32_t timeOut);
+
 /*!
  * Define the optional function called each time a valid sbgECom frame is received.
  * 
@@ -7,6 +7,134 @@
 #include "commands/sbgEComCmdCommon.h"
 #include "sbgECom.h"
 
+//----------------------------------------------------------------------//
+//- Private functions                                                  -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Try to receive and decode one log from the input interface.
+ *
+ * Frames that are not logs, as well as disabled logs, are consumed without being decoded.
+ *
+ * \param[in]   pHandle                         A valid sbgECom handle.
+ * \param[out]  pMsgClass                       Class of the decoded log.
+ * \param[out]  pMsgId                          ID of the decoded log.
+ * \param[out]  pLogData                        Decoded log data.
+ * \param[out]  pArrivalTime                    Host reception time of the decoded log.
+ * \param[out]  pDecoded                        Set to true if a log has been decoded, which must then be cleaned up.
+ * \return                                      SBG_NO_ERROR if a frame has been consumed,
+ *                                              SBG_NOT_READY if no frame is available,
+ *                                              an error code if an invalid frame or log has been received.
+ */
+static SbgErrorCode sbgEComReceiveLog(SbgEComHandle *pHandle, SbgEComClass *pMsgClass, SbgEComMsgId *pMsgId, SbgEComLogUnion *pLogData, SbgInterfaceTimestamp *pArrivalTime, bool *pDecoded)
+{
+    SbgErrorCode            errorCode = SBG_NO_ERROR;
+    uint8_t                 receivedMsg;
+    uint8_t                 receivedMsgClass;
+    SbgEComProtocolPayload  payload;
+
+    assert(pHandle);
+    assert(pMsgClass);
+    assert(pMsgId);
+    assert(pLogData);
+    assert(pArrivalTime);
+    assert(pDecoded);
+
+    *pDecoded = false;
+
+    sbgEComProtocolPayloadConstruct(&payload);
+
+    //
+    // Try to read a received frame, the payload directly references the protocol work buffer
+    // so the log is parsed without any intermediate copy
+    //
+    errorCode = sbgEComProtocolReceive2(&pHandle->protocolHandle, &receivedMsgClass, &receivedMsg, &payload);
+
+    //
+    // Test if we have received a valid frame
+    //
+    if (errorCode == SBG_NO_ERROR)
+    {
+        //
+        // Test if the received frame is a binary log
+        //
+        if (sbgEComMsgClassIsALog((SbgEComClass)receivedMsgClass))
+        {
+            //
+            // The received frame is a binary log one, only the union member of this log is written
+            //
+            errorCode = sbgEComLogRegistryParse(&pHandle->logRegistry, (SbgEComClass)receivedMsgClass, (SbgEComMsgId)receivedMsg, sbgEComProtocolPayloadGetBuffer(&payload), sbgEComProtocolPayloadGetSize(&payload), pLogData);
+
+            //
+            // Test if the incoming log has been parsed successfully
+            //
+            if (errorCode == SBG_NOT_READY)
+            {
+                //
+                // The log is disabled, it is discarded without being decoded
+                //
+                errorCode = SBG_NO_ERROR;
+            }
+            else if (errorCode == SBG_NO_ERROR)
+            {
+                *pMsgClass      = (SbgEComClass)receivedMsgClass;
+                *pMsgId         = (SbgEComMsgId)receivedMsg;
+                *pArrivalTime   = *sbgEComProtocolGetReceiveTimestamp(&pHandle->protocolHandle);
+                *pDecoded       = true;
+            }
+            else
+            {
+                //
+                // Call the on error callback
+                //
+            }
+        }
+        else
+        {
+            //
+            // We have received a command, it shouldn't happen
+            //
+        }
+    }
+    else if (errorCode != SBG_NOT_READY)
+    {
+        //
+        // We have received an invalid frame
+        //
+        SBG_LOG_WARNING(errorCode, "Invalid frame received");
+    }
+
+    sbgEComProtocolPayloadDestroy(&payload);
+
+    return errorCode;
+}
+
+/*!
+ * Report a batch of decoded logs and clean them up.
+ *
+ * \param[in]   pHandle                         A valid sbgECom handle.
+ * \param[in]   pEntries                        Decoded logs, in arrival order.
+ * \param[in]   nrEntries                       Number of decoded logs.
+ */
+static void sbgEComDeliverLogBatch(SbgEComHandle *pHandle, SbgEComLogBatchEntry *pEntries, size_t nrEntries)
+{
+    assert(pHandle);
+    assert(pEntries);
+
+    if (pHandle->pReceiveLogBatchCallback)
+    {
+        pHandle->pReceiveLogBatchCallback(pHandle, pEntries, nrEntries, pHandle->pBatchUserArg);
+    }
+
+    //
+    // Clean up resources allocated during parsing, if any.
+    //
+    for (size_t i = 0; i < nrEntries; i++)
+    {
+        sbgEComLogCleanup(&pEntries[i].logData, pEntries[i].msgClass, pEntries[i].msgId);
+    }
+}
+
 //----------------------------------------------------------------------//
 //- Public methods                                                     -//
 //----------------------------------------------------------------------//
@@ -21,8 +149,13 @@ SbgErrorCode sbgEComInit(SbgEComHandle *pHandle, SbgInterface *pInterface)
     //
     // Initialize the sbgECom handle
     //
-    pHandle->pReceiveLogCallback    = NULL;
-    pHandle->pUserArg               = NULL;
+    pHandle->pReceiveLogCallback        = NULL;
+    pHandle->pReceiveLogCallback2       = NULL;
+    pHandle->pUserArg                   = NULL;
+    pHandle->pReceiveLogBatchCallback   = NULL;
+    pHandle->pBatchUserArg              = NULL;
+
+    sbgEComLogRegistryInit(&pHandle->logRegistry);
 
     //
     // Initialize the default number of trials and time out
@@ -55,77 +188,83 @@ SbgErrorCode sbgEComClose(SbgEComHandle *pHandle)
 SbgErrorCode sbgEComHandleOneLog(SbgEComHandle *pHandle)
 {
     SbgErrorCode        errorCode = SBG_NO_ERROR;
-    SbgEComLogUnion     logData;
-    uint8_t             receivedMsg;
-    uint8_t             receivedMsgClass;
-    size_t              payloadSize;
-    uint8_t             payloadData[SBG_ECOM_MAX_PAYLOAD_SIZE];
+    SbgEComLogUnion         logData;
+    SbgEComClass            msgClass;
+    SbgEComMsgId            msgId;
+    SbgInterfaceTimestamp   arrivalTime;
+    bool                    decoded;
 
     assert(pHandle);
 
-    //
-    // Try to read a received frame
-    //
-    errorCode = sbgEComProtocolReceive(&pHandle->protocolHandle, &receivedMsgClass, &receivedMsg, payloadData, &payloadSize, sizeof(payloadData));
+    errorCode = sbgEComReceiveLog(pHandle, &msgClass, &msgId, &logData, &arrivalTime, &decoded);
 
-    //
-    // Test if we have received a valid frame
-    //
-    if (errorCode == SBG_NO_ERROR)
+    if (decoded)
     {
         //
-        // Test if the received frame is a binary log
+        // Test if we have a valid callback to handle received logs
         //
-        if (sbgEComMsgClassIsALog((SbgEComClass)receivedMsgClass))
+        if (pHandle->pReceiveLogCallback2)
+        {
+            errorCode = pHandle->pReceiveLogCallback2(pHandle, msgClass, msgId, &logData, &arrivalTime, pHandle->pUserArg);
+        }
+        else if (pHandle->pReceiveLogCallback)
         {
             //
-            // The received frame is a binary log one
+            // Call the binary log callback using the new method
             //
-            errorCode = sbgEComLogParse((SbgEComClass)receivedMsgClass, (SbgEComMsgId)receivedMsg, payloadData, payloadSize, &logData);
+            errorCode = pHandle->pReceiveLogCallback(pHandle, msgClass, msgId, &logData, pHandle->pUserArg);
+        }
 
-            //
-            // Test if the incoming log has been parsed successfully
-            //
-            if (errorCode == SBG_NO_ERROR)
-            {
-                //
-                // Test if we have a valid callback to handle received logs
-                //
-                if (pHandle->pReceiveLogCallback)
-                {
-                    //
-                    // Call the binary log callback using the new method
-                    //
-                    errorCode = pHandle->pReceiveLogCallback(pHandle, (SbgEComClass)receivedMsgClass, receivedMsg, &logData, pHandle->pUserArg);
-                }
+        //
+        // Clean up resources allocated during parsing, if any.
+        //
+        sbgEComLogCleanup(&logData, msgClass, msgId);
+    }
+    
+    return errorCode;
+}
 
-                //
-                // Clean up resources allocated during parsing, if any.
-                //
-                sbgEComLogCleanup(&logData, (SbgEComClass)receivedMsgClass, (SbgEComMsgId)receivedMsg);
-            }
-            else
-            {
-                //
-                // Call the on error callback
-                //
-            }
-        }
-        else
+SbgErrorCode sbgEComHandleBatch(SbgEComHandle *pHandle, SbgEComLogBatchEntry *pEntries, size_t maxEntries)
+{
+    SbgErrorCode        errorCode = SBG_NO_ERROR;
+    size_t              nrEntries;
+
+    assert(pHandle);
+    assert(pEntries);
+    assert(maxEntries > 0);
+
+    nrEntries = 0;
+
+    //
+    // Decode all received frames in arrival order, we thus loop until we get an SBG_NOT_READY error
+    //
+    do
+    {
+        SbgEComLogBatchEntry   *pEntry = &pEntries[nrEntries];
+        bool                    decoded;
+
+        errorCode = sbgEComReceiveLog(pHandle, &pEntry->msgClass, &pEntry->msgId, &pEntry->logData, &pEntry->arrivalTime, &decoded);
+
+        if (decoded)
         {
+            nrEntries++;
+
             //
-            // We have received a command, it shouldn't happen
+            // Report the batch as soon as the caller array is full
             //
+            if (nrEntries == maxEntries)
+            {
+                sbgEComDeliverLogBatch(pHandle, pEntries, nrEntries);
+                nrEntries = 0;
+            }
         }
-    }
-    else if (errorCode != SBG_NOT_READY)
+    } while (errorCode != SBG_NOT_READY);
+
+    if (nrEntries != 0)
     {
-        //
-        // We have received an invalid frame
-        //
-        SBG_LOG_WARNING(errorCode, "Invalid frame received");
+        sbgEComDeliverLogBatch(pHandle, pEntries, nrEntries);
     }
-    
+
     return errorCode;
 }
 
@@ -171,6 +310,50 @@ void sbgEComSetReceiveLogCallback(SbgEComHandle *pHandle, SbgEComReceiveLogFunc
     pHandle->pUserArg               = pUserArg;
 }
 
+void sbgEComSetReceiveLogCallback2(SbgEComHandle *pHandle, SbgEComReceiveLogFunc2 pReceiveLogCallback, void *pUserArg)
+{
+    assert(pHandle);
+
+    pHandle->pReceiveLogCallback2   = pReceiveLogCallback;
+    pHandle->pUserArg               = pUserArg;
+}
+
+SbgEComLogRegistry *sbgEComGetLogRegistry(SbgEComHandle *pHandle)
+{
+    assert(pHandle);
+
+    return &pHandle->logRegistry;
+}
+
+void sbgEComGetStats(const SbgEComHandle *pHandle, SbgEComProtocolStats *pStats)
+{
+    assert(pHandle);
+
+    sbgEComProtocolGetStats(&pHandle->protocolHandle, pStats);
+}
+
+uint32_t sbgEComGetNrFrames(const SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msgId)
+{
+    assert(pHandle);
+
+    return sbgEComProtocolGetNrFrames(&pHandle->protocolHandle, (uint8_t)msgClass, msgId);
+}
+
+void sbgEComResetStats(SbgEComHandle *pHandle)
+{
+    assert(pHandle);
+
+    sbgEComProtocolResetStats(&pHandle->protocolHandle);
+}
+
+void sbgEComSetReceiveLogBatchCallback(SbgEComHandle *pHandle, SbgEComReceiveLogBatchFunc pReceiveLogBatchCallback, void *pUserArg)
+{
+    assert(pHandle);
+
+    pHandle->pReceiveLogBatchCallback   = pReceiveLogBatchCallback;
+    pHandle->pBatchUserArg              = pUserArg;
+}
+
 void sbgEComSetCmdTrialsAndTimeOut(SbgEComHandle *pHandle, uint32_t numTrials, uint32_t cmdDefaultTimeOut)
 {
     assert(pHandle);
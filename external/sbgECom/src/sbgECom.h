@@ -77,6 +77,40 @@ typedef struct _SbgEComHandle SbgEComHandle;
  */
 typedef SbgErrorCode (*SbgEComReceiveLogFunc)(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const SbgEComLogUnion *pLogData, void *pUserArg);
 
+/*!
+ * Callback definition called each time a new log is received, with its host reception time.
+ *
+ * \param[in]   pHandle                                 Valid handle on the sbgECom instance that has called this callback.
+ * \param[in]   msgClass                                Class of the message we have received
+ * \param[in]   msg                                     Message ID of the log received.
+ * \param[in]   pLogData                                Contains the received log data as an union.
+ * \param[in]   pArrivalTime                            Host reception time of the first byte of the log frame, null if not supported by the interface.
+ * \param[in]   pUserArg                                Optional user supplied argument.
+ * \return                                              SBG_NO_ERROR if the received log has been used successfully.
+ */
+typedef SbgErrorCode (*SbgEComReceiveLogFunc2)(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const SbgEComLogUnion *pLogData, const SbgInterfaceTimestamp *pArrivalTime, void *pUserArg);
+
+/*!
+ * Decoded log stored in a batch.
+ */
+typedef struct _SbgEComLogBatchEntry
+{
+    SbgEComClass                 msgClass;                  /*!< Class of the log. */
+    SbgEComMsgId                 msgId;                     /*!< Message ID of the log. */
+    SbgEComLogUnion              logData;                   /*!< Decoded log data. */
+    SbgInterfaceTimestamp        arrivalTime;               /*!< Host reception time of the first byte of the log frame, null if not supported by the interface. */
+} SbgEComLogBatchEntry;
+
+/*!
+ * Callback definition called each time a batch of logs has been received.
+ *
+ * \param[in]   pHandle                                 Valid handle on the sbgECom instance that has called this callback.
+ * \param[in]   pEntries                                Decoded logs, in arrival order.
+ * \param[in]   nrEntries                               Number of decoded logs.
+ * \param[in]   pUserArg                                Optional user supplied argument.
+ */
+typedef void (*SbgEComReceiveLogBatchFunc)(SbgEComHandle *pHandle, const SbgEComLogBatchEntry *pEntries, size_t nrEntries, void *pUserArg);
+
 //----------------------------------------------------------------------//
 //- Structures definitions                                             -//
 //----------------------------------------------------------------------//
@@ -89,8 +123,14 @@ struct _SbgEComHandle
     SbgEComProtocol              protocolHandle;            /*!< Handle on the protocol system. */
 
     SbgEComReceiveLogFunc        pReceiveLogCallback;       /*!< Pointer on the method called each time a new binary log is received. */
+    SbgEComReceiveLogFunc2       pReceiveLogCallback2;      /*!< Pointer on the method called each time a new binary log is received, with its reception time. */
     void                        *pUserArg;                  /*!< Optional user supplied argument for callbacks. */
 
+    SbgEComReceiveLogBatchFunc   pReceiveLogBatchCallback;  /*!< Pointer on the method called for each batch of logs received by sbgEComHandleBatch. */
+    void                        *pBatchUserArg;             /*!< Optional user supplied argument for the batch callback. */
+
+    SbgEComLogRegistry           logRegistry;               /*!< Decoders of the received logs, disabled logs are discarded before decoding. */
+
     uint32_t                     numTrials;                 /*!< Number of trials when a command is sent (default is 3). */
     uint32_t                     cmdDefaultTimeOut;         /*!< Default time out in ms to get an answer from the device (default 500 ms). */
 };
@@ -132,6 +172,20 @@ SbgErrorCode sbgEComHandleOneLog(SbgEComHandle *pHandle);
  */
 SbgErrorCode sbgEComHandle(SbgEComHandle *pHandle);
 
+/*!
+ * Handle all incoming logs until no more log are available in the input interface, reporting them by batch.
+ *
+ * All received logs are decoded, in arrival order, into the given array. The batch callback is called
+ * once the array is full and once all received logs have been decoded. The single log callback is not
+ * called by this method.
+ *
+ * \param[in]   pHandle                         A valid sbgECom handle.
+ * \param[out]  pEntries                        Array used to store the decoded logs.
+ * \param[in]   maxEntries                      Number of entries in the array.
+ * \return                                      SBG_NOT_READY once all received logs have been handled.
+ */
+SbgErrorCode sbgEComHandleBatch(SbgEComHandle *pHandle, SbgEComLogBatchEntry *pEntries, size_t maxEntries);
+
 /*!
  * Purge the interface rx buffer as well as the sbgECom rx work buffer.
  *
@@ -153,6 +207,65 @@ SbgErrorCode sbgEComPurgeIncoming(SbgEComHandle *pHandle);
  */
 void sbgEComSetReceiveLogCallback(SbgEComHandle *pHandle, SbgEComReceiveLogFunc pReceiveLogCallback, void *pUserArg);
 
+/*!
+ * Define the callback that should be called each time a new binary log is received, with its host reception time.
+ *
+ * If defined, this callback is called instead of the one set with sbgEComSetReceiveLogCallback, and both
+ * callbacks share the same user argument.
+ *
+ * \param[in]   pHandle                         A valid sbgECom handle.
+ * \param[in]   pReceiveLogCallback             Pointer on the callback to call when a new log is received.
+ * \param[in]   pUserArg                        Optional user argument that will be passed to the callback method.
+ */
+void sbgEComSetReceiveLogCallback2(SbgEComHandle *pHandle, SbgEComReceiveLogFunc2 pReceiveLogCallback, void *pUserArg);
+
+/*!
+ * Define the callback that should be called for each batch of logs received by sbgEComHandleBatch.
+ *
+ * \param[in]   pHandle                         A valid sbgECom handle.
+ * \param[in]   pReceiveLogBatchCallback        Pointer on the callback to call when a batch of logs is received.
+ * \param[in]   pUserArg                        Optional user argument that will be passed to the callback method.
+ */
+void sbgEComSetReceiveLogBatchCallback(SbgEComHandle *pHandle, SbgEComReceiveLogBatchFunc pReceiveLogBatchCallback, void *pUserArg);
+
+/*!
+ * Get the registry of the log decoders.
+ *
+ * All logs are decoded by default. Logs disabled in the registry are discarded as soon as their frame
+ * is validated, without being decoded nor reported to the receive log callback.
+ *
+ * \param[in]   pHandle                         A valid sbgECom handle.
+ * \return                                      Log registry.
+ */
+SbgEComLogRegistry *sbgEComGetLogRegistry(SbgEComHandle *pHandle);
+
+/*!
+ * Get a snapshot of the reception statistics.
+ *
+ * The statistics are cheap to copy and may be polled periodically, for example to detect a saturated link.
+ *
+ * \param[in]   pHandle                         A valid sbgECom handle.
+ * \param[out]  pStats                          Reception statistics.
+ */
+void sbgEComGetStats(const SbgEComHandle *pHandle, SbgEComProtocolStats *pStats);
+
+/*!
+ * Get the number of valid frames received for a message.
+ *
+ * \param[in]   pHandle                         A valid sbgECom handle.
+ * \param[in]   msgClass                        Message class.
+ * \param[in]   msgId                           Message ID.
+ * \return                                      Number of valid frames received.
+ */
+uint32_t sbgEComGetNrFrames(const SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msgId);
+
+/*!
+ * Reset the reception statistics.
+ *
+ * \param[in]   pHandle                         A valid sbgECom handle.
+ */
+void sbgEComResetStats(SbgEComHandle *pHandle);
+
 /*!
  * Define the default number of trials that should be done when a command is send to the device as well as the time out.
  * 
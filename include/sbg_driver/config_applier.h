@@ -40,6 +40,7 @@
 #include <string>
 
 // Project headers
+#include <config_cache.h>
 #include <config_store.h>
 
 namespace sbg
@@ -166,15 +167,44 @@ private:
   void configureOdometerRejection(const SbgEComOdoRejectionConf& ref_odometer_rejection);
 
   /*!
-   * Configure the output for the SBG log.
+   * Configure the output for the SBG logs.
    * If a Log is not available for the connected device, a warning will be logged.
    * It will be user responsability to check.
    *
+   * The output commands are pipelined, so the current modes are read and the
+   * changed ones updated in about two link round trips.
+   *
    * \param[in] output_port       Output communication port.
-   * \param[in] ref_log_output    Log output to configure.
+   * \param[in] ref_log_outputs   Log outputs to configure.
    * \throw                       Unable to configure the output.
    */
-  void configureOutput(SbgEComOutputPort output_port, const ConfigStore::SbgLogOutput &ref_log_output);
+  void configureOutputs(SbgEComOutputPort output_port, const std::vector<ConfigStore::SbgLogOutput> &ref_log_outputs);
+
+  /*!
+   * Configure the device with all the settings defined in the store.
+   *
+   * \param[in] ref_config_store            Configuration to apply.
+   * \throw                                 Unable to configure the device.
+   */
+  void configureDevice(const ConfigStore& ref_config_store);
+
+  /*!
+   * Compute the hash of the device configuration defined in the store.
+   *
+   * \param[in] ref_config_store            Configuration to hash.
+   * \return                                Configuration hash.
+   */
+  uint64_t computeConfigurationHash(const ConfigStore& ref_config_store) const;
+
+  /*!
+   * Export the device settings and compute their hash.
+   *
+   * All the settings are retrieved with a single transfer.
+   *
+   * \param[out] ref_settings_hash          Settings hash.
+   * \return                                SBG_NO_ERROR if the settings have been exported.
+   */
+  SbgErrorCode computeSettingsHash(uint64_t& ref_settings_hash) const;
 
 public:
 
@@ -200,9 +230,14 @@ public:
   /*!
    * Apply a configuration to the SBG device.
    *
+   * If a cache directory is defined, the device settings are exported and compared with the
+   * cached state of the device. When the device already runs this configuration, the settings
+   * aren't read nor written one by one.
+   *
    * \param[in] ref_config_store            Configuration to apply.
+   * \param[in] serial_number               Device serial number.
    */
-  void applyConfiguration(const ConfigStore& ref_config_store);
+  void applyConfiguration(const ConfigStore& ref_config_store, uint32_t serial_number);
 
   /*!
    * Save the configuration to the device.
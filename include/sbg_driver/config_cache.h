@@ -0,0 +1,163 @@
+/*!
+*  \file         config_cache.h
+*  \author       SBG Systems
+*  \date         16/10/2026
+*
+*  \brief        Cache the state of configured devices.
+*
+*  For each device serial number, the cache records the hash of the ROS
+*  configuration last applied and the hash of the settings exported by the
+*  device right after. If both still match at startup, the device already
+*  runs this configuration and doesn't have to be configured again.
+*
+*  The cache also records the last known baud rate of each serial port.
+*
+*  \section CodeCopyright Copyright Notice
+*  MIT License
+*
+*  Copyright (c) 2023 SBG Systems
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+#ifndef CONFIG_CACHE_H
+#define CONFIG_CACHE_H
+
+// Standard headers
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace sbg
+{
+/*!
+ * Device configuration cache.
+ *
+ * Each device is stored in its own file, named after its serial number, in the cache directory.
+ * Baud rates are stored in files named after the serial port.
+ */
+class ConfigCache
+{
+private:
+
+  //---------------------------------------------------------------------//
+  //- Private variables                                                 -//
+  //---------------------------------------------------------------------//
+
+  std::string                 directory_;
+
+  //---------------------------------------------------------------------//
+  //- Private  methods                                                  -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Get the cache file path of a device.
+   *
+   * \param[in] serial_number       Device serial number.
+   * \return                        Cache file path.
+   */
+  std::string getFilePath(uint32_t serial_number) const;
+
+  /*!
+   * Get the baud rate cache file path of a serial port.
+   *
+   * \param[in] ref_port_name       Serial port name.
+   * \return                        Cache file path.
+   */
+  std::string getBaudRateFilePath(const std::string &ref_port_name) const;
+
+  /*!
+   * Replace a cache file.
+   *
+   * \param[in] ref_file_path       Cache file path.
+   * \param[in] ref_content         Cache file content.
+   * \return                        True if the cache file has been written.
+   */
+  static bool writeFile(const std::string &ref_file_path, const std::string &ref_content);
+
+public:
+
+  //---------------------------------------------------------------------//
+  //- Constructor                                                       -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Constructor.
+   *
+   * \param[in] ref_directory       Existing directory holding the cache files.
+   */
+  explicit ConfigCache(const std::string &ref_directory);
+
+  //---------------------------------------------------------------------//
+  //- Operations                                                        -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Compute the 64 bits FNV-1a hash of a buffer.
+   *
+   * Hashes can be chained by passing the previous hash as the initial value.
+   *
+   * \param[in] p_buffer            Buffer.
+   * \param[in] size                Buffer size, in bytes.
+   * \param[in] hash                Initial hash value.
+   * \return                        Hash value.
+   */
+  static uint64_t computeHash(const void *p_buffer, size_t size, uint64_t hash = 0xcbf29ce484222325ull);
+
+  /*!
+   * Check if a device already runs a configuration.
+   *
+   * \param[in] serial_number       Device serial number.
+   * \param[in] config_hash         Hash of the configuration to apply.
+   * \param[in] settings_hash       Hash of the settings currently exported by the device.
+   * \return                        True if the device has been configured with this configuration, and its settings haven't changed since.
+   */
+  bool isUpToDate(uint32_t serial_number, uint64_t config_hash, uint64_t settings_hash) const;
+
+  /*!
+   * Record the configuration applied to a device.
+   *
+   * \param[in] serial_number       Device serial number.
+   * \param[in] config_hash         Hash of the applied configuration.
+   * \param[in] settings_hash       Hash of the settings exported by the device once configured.
+   * \return                        True if the cache file has been written.
+   */
+  bool update(uint32_t serial_number, uint64_t config_hash, uint64_t settings_hash) const;
+
+  /*!
+   * Get the last known baud rate of the device connected to a serial port.
+   *
+   * \param[in]  ref_port_name      Serial port name.
+   * \param[out] ref_baud_rate      Baud rate, in bps.
+   * \return                        True if a baud rate has been cached for this port.
+   */
+  bool getBaudRate(const std::string &ref_port_name, uint32_t &ref_baud_rate) const;
+
+  /*!
+   * Record the baud rate of the device connected to a serial port.
+   *
+   * \param[in] ref_port_name       Serial port name.
+   * \param[in] baud_rate           Baud rate, in bps.
+   * \return                        True if the cache file has been written.
+   */
+  bool updateBaudRate(const std::string &ref_port_name, uint32_t baud_rate) const;
+};
+}
+
+#endif // CONFIG_CACHE_H
@@ -52,6 +52,7 @@ namespace sbg
   {
     ROS = 0,
     INS_UNIX = 1,
+    HOST_SYNC = 2,
   };
 
 /*!
@@ -77,17 +78,26 @@ private:
   SbgEComOutputPort           output_port_;
   uint32_t                    uart_baud_rate_;
   std::vector<int64_t>        uart_fallback_baud_rates_;
+  bool                        uart_low_latency_;
+  bool                        uart_exclusive_;
   bool                        serial_communication_;
 
   sbgIpAddress                sbg_ip_address_;
   uint32_t                    out_port_address_;
   uint32_t                    in_port_address_;
+  uint32_t                    udp_receive_buffer_size_;
+  uint32_t                    udp_busy_poll_;
+  uint32_t                    udp_batch_size_;
   bool                        upd_communication_;
 
   std::string                 sbg_file_;
+  double                      replay_rate_;
+  bool                        replay_start_paused_;
+  bool                        replay_publish_clock_;
   bool                        file_communication_;
 
   bool                        configure_through_ros_;
+  std::string                 config_cache_directory_;
 
   SbgEComInitConditionConf    init_condition_conf_;
   SbgEComMotionProfileStdIds  motion_profile_model_info_;
@@ -116,6 +126,11 @@ private:
   TimeReference               time_reference_;
 
   uint32_t                    rate_frequency_;
+  bool                        reader_thread_;
+  int32_t                     reader_thread_cpu_;
+  uint32_t                    reader_queue_size_;
+  bool                        link_watchdog_;
+  bool                        loaned_messages_;
   std::string                 frame_id_;
   bool                        use_enu_;
 
@@ -285,6 +300,13 @@ public:
    */
   bool checkConfigWithRos() const;
 
+  /*!
+   * Get the directory caching the state of the configured devices.
+   *
+   * \return                      Cache directory, empty if the device state isn't cached.
+   */
+  const std::string &getConfigCacheDirectory() const;
+
   /*!
    * Check if the interface configuration is a serial interface.
    *
@@ -313,6 +335,20 @@ public:
    */
   const std::vector<int64_t> getFallbackBaudRates() const;
 
+  /*!
+   * Check if the UART low latency mode is enabled.
+   *
+   * \return                      True if the serial driver should forward received data immediately.
+   */
+  bool isUartLowLatency() const;
+
+  /*!
+   * Check if the UART port is opened with exclusive access.
+   *
+   * \return                      True if other processes are prevented from opening the port.
+   */
+  bool isUartExclusive() const;
+
   /*!
    * Get the output port of the device.
    *
@@ -348,6 +384,27 @@ public:
    */
   uint32_t getInputPortAddress() const;
 
+  /*!
+   * Get the UDP socket receive buffer size.
+   *
+   * \return                      Receive buffer size in bytes, 0 to keep the system default.
+   */
+  uint32_t getUdpReceiveBufferSize() const;
+
+  /*!
+   * Get the UDP socket busy polling time.
+   *
+   * \return                      Busy polling time in us, 0 if disabled.
+   */
+  uint32_t getUdpBusyPoll() const;
+
+  /*!
+   * Get the maximum number of UDP datagrams received per system call.
+   *
+   * \return                      Number of datagrams, 0 or 1 if batched reception is disabled.
+   */
+  uint32_t getUdpBatchSize() const;
+
   /*!
    * Check if the interface configuration is a log file.
    *
@@ -362,6 +419,27 @@ public:
    */
   const std::string &getFile() const;
 
+  /*!
+   * Get the log file replay rate.
+   *
+   * \return                      Replay speed relative to real time, 0 to replay as fast as possible.
+   */
+  double getReplayRate() const;
+
+  /*!
+   * Check if the log file replay starts paused.
+   *
+   * \return                      True if the replay starts paused.
+   */
+  bool isReplayStartPaused() const;
+
+  /*!
+   * Returns if the replay time should be published on the /clock topic.
+   *
+   * \return                      True to publish the replay time.
+   */
+  bool shouldPublishReplayClock() const;
+
   /*!
    * Get the initial conditions configuration.
    *
@@ -489,6 +567,44 @@ public:
    */
   uint32_t getReadingRateFrequency() const;
 
+  /*!
+   * Check if the device has to be read from a dedicated thread.
+   *
+   * \return                      True if a dedicated reader thread is used.
+   */
+  bool useReaderThread() const;
+
+  /*!
+   * Get the CPU the reader thread is pinned to.
+   *
+   * \return                      CPU index, negative if the reader thread isn't pinned.
+   */
+  int32_t getReaderThreadCpu() const;
+
+  /*!
+   * Get the size of the queue between the reader thread and the publishers.
+   *
+   * \return                      Maximum number of logs held by the queue.
+   */
+  uint32_t getReaderQueueSize() const;
+
+  /*!
+   * Check if the link to the device is monitored, and reopened once lost.
+   *
+   * \return                      True if the link watchdog is enabled.
+   */
+  bool useLinkWatchdog() const;
+
+  /*!
+   * Check if messages are published through loans from the middleware, when it supports them.
+   *
+   * Zero copy middlewares only loan fixed size messages, fixed size variants of the IMU and quaternion
+   * messages are then published as well.
+   *
+   * \return                      True if loaned messages are enabled.
+   */
+  bool useLoanedMessages() const;
+
   /*!
    * Get the frame ID.
    *
@@ -32,9 +32,16 @@
 #ifndef SBG_ROS_MESSAGE_PUBLISHER_H
 #define SBG_ROS_MESSAGE_PUBLISHER_H
 
+// Standard headers
+#include <array>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
 // Project headers
 #include <config_store.h>
 #include <message_wrapper.h>
+#include <sbg_log_traits.h>
 
 namespace sbg
 {
@@ -45,37 +52,29 @@ class MessagePublisher
 {
 private:
 
-  rclcpp::Publisher<sbg_driver::msg::SbgStatus, std::allocator<void>>::SharedPtr        sbg_status_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgUtcTime, std::allocator<void>>::SharedPtr       sbg_utc_time_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgImuData, std::allocator<void>>::SharedPtr       sbg_imu_data_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgEkfEuler, std::allocator<void>>::SharedPtr      sbg_ekf_euler_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgEkfQuat, std::allocator<void>>::SharedPtr       sbg_ekf_quat_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgEkfNav, std::allocator<void>>::SharedPtr        sbg_ekf_nav_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgEkfVelBody, std::allocator<void>>::SharedPtr    sbg_ekf_vel_body_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgEkfRotAccel, std::allocator<void>>::SharedPtr   sbg_ekf_rot_accel_body_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgEkfRotAccel, std::allocator<void>>::SharedPtr   sbg_ekf_rot_accel_ned_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgShipMotion, std::allocator<void>>::SharedPtr    sbg_ship_motion_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgMag, std::allocator<void>>::SharedPtr           sbg_mag_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgMagCalib, std::allocator<void>>::SharedPtr      sbg_mag_calib_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgGpsVel, std::allocator<void>>::SharedPtr        sbg_gps_vel_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgGpsPos, std::allocator<void>>::SharedPtr        sbg_gps_pos_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgGpsHdt, std::allocator<void>>::SharedPtr        sbg_gps_hdt_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgGpsRaw, std::allocator<void>>::SharedPtr        sbg_gps_raw_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgOdoVel, std::allocator<void>>::SharedPtr        sbg_odo_vel_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgEvent, std::allocator<void>>::SharedPtr         sbg_event_a_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgEvent, std::allocator<void>>::SharedPtr         sbg_event_b_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgEvent, std::allocator<void>>::SharedPtr         sbg_event_c_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgEvent, std::allocator<void>>::SharedPtr         sbg_event_d_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgEvent, std::allocator<void>>::SharedPtr         sbg_event_e_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgImuShort, std::allocator<void>>::SharedPtr      sbg_imu_short_pub_;
-  rclcpp::Publisher<sbg_driver::msg::SbgAirData, std::allocator<void>>::SharedPtr       sbg_air_data_pub_;
+  /*!
+   * Function getting the time stamp of a SBG log.
+   */
+  using TimestampFunction = uint32_t (*)(const SbgEComLogUnion &ref_sbg_log);
+
+  /*!
+   * Handlers of a SBG log, generated from its traits.
+   */
+  struct LogHandlers
+  {
+    void (MessagePublisher::*init_function)(rclcpp::Node &ref_ros_node_handle);
+    void (MessagePublisher::*publish_function)(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id);
+    TimestampFunction timestamp_function;
+  };
+
+  static const std::array<LogHandlers, SBG_ECOM_LOG_ECOM_NUM_MESSAGES>                  log_handlers_;
+  std::array<rclcpp::PublisherBase::SharedPtr, SBG_ECOM_LOG_ECOM_NUM_MESSAGES>          log_publishers_;
 
   rclcpp::Publisher<sensor_msgs::msg::Imu, std::allocator<void>>::SharedPtr             imu_pub_;
-  sbg_driver::msg::SbgImuData                                                           sbg_imu_message_;
-  sbg_driver::msg::SbgImuShort                                                          sbg_imu_short_message_;
-  sbg_driver::msg::SbgEkfQuat                                                           sbg_ekf_quat_message_;
-  sbg_driver::msg::SbgEkfNav                                                            sbg_ekf_nav_message_;
-  sbg_driver::msg::SbgEkfEuler                                                          sbg_ekf_euler_message_;
+  SbgImuState                                                                           imu_state_;
+  SbgEkfQuatState                                                                       ekf_quat_state_;
+  SbgEkfNavState                                                                        ekf_nav_state_;
+  SbgEkfEulerState                                                                      ekf_euler_state_;
 
   rclcpp::Publisher<sensor_msgs::msg::Temperature, std::allocator<void>>::SharedPtr     temp_pub_;
   rclcpp::Publisher<sensor_msgs::msg::MagneticField, std::allocator<void>>::SharedPtr   mag_pub_;
@@ -88,8 +87,13 @@ private:
 
   rclcpp::Publisher<nmea_msgs::msg::Sentence, std::allocator<void>>::SharedPtr          nmea_gga_pub_;
 
+  rclcpp::Publisher<sbg_driver::msg::SbgImuDataFixed, std::allocator<void>>::SharedPtr  imu_data_fixed_pub_;
+  rclcpp::Publisher<sbg_driver::msg::SbgImuShortFixed, std::allocator<void>>::SharedPtr imu_short_fixed_pub_;
+  rclcpp::Publisher<sbg_driver::msg::SbgEkfQuatFixed, std::allocator<void>>::SharedPtr  ekf_quat_fixed_pub_;
+
   MessageWrapper                                                                        message_wrapper_;
   uint32_t                                                                              max_messages_;
+  bool                                                                                  use_loaned_messages_;
   std::string                                                                           frame_id_;
 
   //---------------------------------------------------------------------//
@@ -97,78 +101,186 @@ private:
   //---------------------------------------------------------------------//
 
   /*!
-   * Get the corresponding topic name output for the SBG output mode.
+   * Get the time stamp function of a SBG log without time stamp.
    *
-   * \param[in] sbg_message_id          SBG message ID.
-   * \return                            Output topic name.
+   * \return                            Null function.
    */
-  std::string getOutputTopicName(SbgEComMsgId sbg_message_id) const;
+  template <SbgEComMsgId MsgId>
+  static constexpr TimestampFunction makeTimestampFunction(std::false_type)
+  {
+    return nullptr;
+  }
 
   /*!
-   * Initialize the publisher for the specified SBG Id, and the output configuration.
+   * Get the time stamp function of a SBG log.
    *
-   * \param[in] ref_ros_node_handle     Ros Node to advertise the publisher.
-   * \param[in] sbg_msg_id              Id of the SBG message.
-   * \param[in] output_conf             Output configuration.
-   * \param[in] ref_output_topic        Output topic for the publisher.
+   * \return                            Time stamp function.
    */
-  void initPublisher(rclcpp::Node& ref_ros_node_handle, SbgEComMsgId sbg_msg_id, SbgEComOutputMode output_conf, const std::string &ref_output_topic);
+  template <SbgEComMsgId MsgId>
+  static constexpr TimestampFunction makeTimestampFunction(std::true_type)
+  {
+    return &SbgLogTimestamp<MsgId>::get;
+  }
 
   /*!
-   * Define standard ROS publishers.
+   * Get the handlers of a SBG log that isn't published.
    *
-   * \param[in] ref_ros_node_handle     Ros Node to advertise the publisher.
-   * \param[in] odom_enable             If true, enable odometry messages.
+   * \return                            Handlers with the time stamp function only.
    */
-  void defineRosStandardPublishers(rclcpp::Node& ref_ros_node_handle, bool odom_enable, bool enu_enable);
+  template <SbgEComMsgId MsgId>
+  static constexpr LogHandlers makeLogHandlers(std::false_type)
+  {
+    return { nullptr, nullptr, makeTimestampFunction<MsgId>(std::integral_constant<bool, SbgLogTimestamp<MsgId>::has_timestamp>()) };
+  }
 
   /*!
-   * Process a received SBG IMU log.
+   * Get the handlers of a published SBG log.
+   *
+   * \return                            Log handlers.
    */
-  void processImuMessage();
+  template <SbgEComMsgId MsgId>
+  static constexpr LogHandlers makeLogHandlers(std::true_type)
+  {
+    return { &MessagePublisher::initLogPublisher<MsgId>, &MessagePublisher::publishLog<MsgId>,
+             makeTimestampFunction<MsgId>(std::integral_constant<bool, SbgLogTimestamp<MsgId>::has_timestamp>()) };
+  }
 
   /*!
-   * Process a ROS Velocity standard message.
+   * Generate the handlers table, indexed by SBG message ID.
+   *
+   * The table is evaluated at compile time, its definition is constexpr.
+   *
+   * \return                            Handlers of all the ECOM_0 logs.
    */
-  void processRosVelMessage();
+  template <size_t... MsgIds>
+  static constexpr std::array<LogHandlers, SBG_ECOM_LOG_ECOM_NUM_MESSAGES> makeLogHandlersTable(std::index_sequence<MsgIds...>)
+  {
+    return {{ makeLogHandlers<MsgIds>(std::integral_constant<bool, SbgLogTraits<MsgIds>::is_published>())... }};
+  }
 
   /*!
-   * Process a ROS IMU standard message.
+   * Get the publisher of a SBG log.
+   *
+   * \return                            Publisher, nullptr if the log output is disabled.
    */
-  void processRosImuMessage();
+  template <SbgEComMsgId MsgId>
+  rclcpp::Publisher<typename SbgLogTraits<MsgId>::MessageType> *getLogPublisher() const
+  {
+    return static_cast<rclcpp::Publisher<typename SbgLogTraits<MsgId>::MessageType>*>(log_publishers_[SbgLogTraits<MsgId>::publisher_id].get());
+  }
 
   /*!
-   * Process a ROS odometry standard message.
+   * Check if a SBG log is published.
+   *
+   * \param[in] sbg_msg_id              Id of the SBG message.
+   * \return                            True if the log publisher has been initialized.
    */
-  void processRosOdoMessage();
+  bool isLogPublished(SbgEComMsgId sbg_msg_id) const
+  {
+    return log_publishers_[sbg_msg_id] != nullptr;
+  }
 
   /*!
-   * Publish a received SBG Magnetic log.
+   * Initialize the publisher of a SBG log.
    *
-   * \param[in] ref_sbg_log             SBG log.
+   * \param[in] ref_ros_node_handle     Ros Node to advertise the publisher.
    */
-  void publishMagData(const SbgEComLogUnion &ref_sbg_log);
+  template <SbgEComMsgId MsgId>
+  void initLogPublisher(rclcpp::Node &ref_ros_node_handle)
+  {
+    using Traits = SbgLogTraits<MsgId>;
+
+    log_publishers_[Traits::publisher_id] = ref_ros_node_handle.create_publisher<typename Traits::MessageType>(Traits::getTopicName(), max_messages_);
+  }
 
   /*!
-   * Publish a received SBG Fluid pressure log.
+   * Publish a received SBG log.
+   *
+   * Logs also used to build ROS standard messages have dedicated specializations.
    *
    * \param[in] ref_sbg_log             SBG log.
+   * \param[in] sbg_msg_id              Id of the SBG message.
    */
-  void publishFluidPressureData(const SbgEComLogUnion &ref_sbg_log);
+  template <SbgEComMsgId MsgId>
+  void publishLog(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id)
+  {
+    rclcpp::Publisher<typename SbgLogTraits<MsgId>::MessageType> *p_publisher = getLogPublisher<MsgId>();
+
+    SBG_UNUSED_PARAMETER(sbg_msg_id);
+
+    if (p_publisher)
+    {
+      publishMessage(*p_publisher, [&](auto &ref_message) { SbgLogTraits<MsgId>::fill(message_wrapper_, ref_sbg_log, ref_message); });
+    }
+  }
 
   /*!
-   * Publish a received SBG EkfNav log.
+   * Fill and publish a message.
    *
-   * \param[in] ref_sbg_log             SBG log.
+   * When enabled and supported by the middleware for the message type, the message is filled in a loan
+   * from the middleware. Zero copy middlewares only loan fixed size types.
+   * Otherwise it is filled in a unique pointer whose ownership is handed over to the middleware, so that
+   * subscriptions in the same process receive it without any copy when intra-process communications
+   * are enabled.
+   *
+   * \param[in] ref_publisher           Publisher.
+   * \param[in] fill_function           Function filling the message, called with a reference to the message.
    */
-  void publishEkfNavigationData(const SbgEComLogUnion &ref_sbg_log);
+  template <typename MessageType, typename FillFunction>
+  void publishMessage(rclcpp::Publisher<MessageType> &ref_publisher, FillFunction fill_function) const
+  {
+    if (use_loaned_messages_ && ref_publisher.can_loan_messages())
+    {
+      auto loaned_message = ref_publisher.borrow_loaned_message();
+
+      fill_function(loaned_message.get());
+      ref_publisher.publish(std::move(loaned_message));
+    }
+    else
+    {
+      std::unique_ptr<MessageType> p_message = std::make_unique<MessageType>();
+
+      fill_function(*p_message);
+      ref_publisher.publish(std::move(p_message));
+    }
+  }
 
   /*!
-   * Publish a received SBG UTC log.
+   * Define standard ROS publishers.
    *
-   * \param[in] ref_sbg_log             SBG log.
+   * \param[in] ref_ros_node_handle     Ros Node to advertise the publisher.
+   * \param[in] odom_enable             If true, enable odometry messages.
+   */
+  void defineRosStandardPublishers(rclcpp::Node& ref_ros_node_handle, bool odom_enable, bool enu_enable);
+
+  /*!
+   * Define the publishers of the fixed size variants of high rate SBG messages.
+   *
+   * Unlike the other messages, they carry no frame ID string, so that zero copy middlewares can loan them.
+   *
+   * \param[in] ref_ros_node_handle     Ros Node to advertise the publisher.
    */
-  void publishUtcData(const SbgEComLogUnion &ref_sbg_log);
+  void defineFixedSizePublishers(rclcpp::Node& ref_ros_node_handle);
+
+  /*!
+   * Process a received SBG IMU log.
+   */
+  void processImuMessage();
+
+  /*!
+   * Process a ROS Velocity standard message.
+   */
+  void processRosVelMessage();
+
+  /*!
+   * Process a ROS IMU standard message.
+   */
+  void processRosImuMessage();
+
+  /*!
+   * Process a ROS odometry standard message.
+   */
+  void processRosOdoMessage();
 
   /*!
    * Publish a received SBG GpsPos log.
@@ -207,8 +319,9 @@ public:
    * \param[in] sbg_msg_class           Class ID of the SBG message.
    * \param[in] sbg_msg_id              Id of the SBG message.
    * \param[in] ref_sbg_log             SBG binary log.
+   * \param[in] ref_arrival_time        Host time at which the log has been received, null clocks if unknown.
    */
-  void publish(SbgEComClass sbg_msg_class, SbgEComMsgId sbg_msg_id, const SbgEComLogUnion &ref_sbg_log);
+  void publish(SbgEComClass sbg_msg_class, SbgEComMsgId sbg_msg_id, const SbgEComLogUnion &ref_sbg_log, const SbgInterfaceTimestamp &ref_arrival_time);
 
   /*!
    * Get the timestamp of an SBG binary log.
@@ -216,10 +329,24 @@ public:
    * \param[in] sbg_msg_class           Class ID of the SBG message.
    * \param[in] sbg_msg_id              Id of the SBG message.
    * \param[in] ref_sbg_log             SBG binary log.
-   * \return                            Timestamp in us.
+   * \return                            Timestamp in us, zero if the log has none.
    */
-  uint32_t getTimestamp(SbgEComClass sbg_msg_class, SbgEComMsgId sbg_msg_id, const SbgEComLogUnion &ref_sbg_log);
+  uint32_t getTimestamp(SbgEComClass sbg_msg_class, SbgEComMsgId sbg_msg_id, const SbgEComLogUnion &ref_sbg_log) const;
 };
+
+//
+// Logs feeding ROS standard messages have dedicated handlers.
+//
+template <> void MessagePublisher::publishLog<SBG_ECOM_LOG_UTC_TIME>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id);
+template <> void MessagePublisher::publishLog<SBG_ECOM_LOG_IMU_DATA>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id);
+template <> void MessagePublisher::publishLog<SBG_ECOM_LOG_MAG>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id);
+template <> void MessagePublisher::publishLog<SBG_ECOM_LOG_EKF_EULER>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id);
+template <> void MessagePublisher::publishLog<SBG_ECOM_LOG_EKF_QUAT>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id);
+template <> void MessagePublisher::publishLog<SBG_ECOM_LOG_EKF_NAV>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id);
+template <> void MessagePublisher::publishLog<SBG_ECOM_LOG_GPS1_POS>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id);
+template <> void MessagePublisher::publishLog<SBG_ECOM_LOG_GPS2_POS>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id);
+template <> void MessagePublisher::publishLog<SBG_ECOM_LOG_AIR_DATA>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id);
+template <> void MessagePublisher::publishLog<SBG_ECOM_LOG_IMU_SHORT>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id);
 }
 
 #endif // SBG_ROS_MESSAGE_PUBLISHER_H
@@ -42,6 +42,7 @@
 #include <sbg_matrix3.h>
 #include <config_store.h>
 #include <sbg_utm.h>
+#include <sbg_clock_sync.h>
 
 // ROS headers
 #include <rclcpp/rclcpp.hpp>
@@ -63,8 +64,10 @@
 #include "sbg_driver/msg/sbg_status.hpp"
 #include "sbg_driver/msg/sbg_utc_time.hpp"
 #include "sbg_driver/msg/sbg_imu_data.hpp"
+#include "sbg_driver/msg/sbg_imu_data_fixed.hpp"
 #include "sbg_driver/msg/sbg_ekf_euler.hpp"
 #include "sbg_driver/msg/sbg_ekf_quat.hpp"
+#include "sbg_driver/msg/sbg_ekf_quat_fixed.hpp"
 #include "sbg_driver/msg/sbg_ekf_nav.hpp"
 #include "sbg_driver/msg/sbg_ekf_vel_body.hpp"
 #include "sbg_driver/msg/sbg_ekf_rot_accel.hpp"
@@ -78,11 +81,62 @@
 #include "sbg_driver/msg/sbg_odo_vel.hpp"
 #include "sbg_driver/msg/sbg_event.hpp"
 #include "sbg_driver/msg/sbg_imu_short.hpp"
+#include "sbg_driver/msg/sbg_imu_short_fixed.hpp"
 #include "sbg_driver/msg/sbg_air_data.hpp"
 
 namespace sbg
 {
 
+/*!
+ * IMU data kept to build ROS standard messages.
+ */
+struct SbgImuState
+{
+  uint32_t                      time_stamp{};             /*!< Time since sensor is powered up, in us. */
+  bool                          from_imu_short{};         /*!< True if filled from an IMU short message. */
+  geometry_msgs::msg::Vector3   angular_velocity;         /*!< Angular velocity, in rad/s. */
+  geometry_msgs::msg::Vector3   linear_acceleration;      /*!< Linear acceleration, in m/s^2. */
+  geometry_msgs::msg::Vector3   delta_angle;              /*!< Delta angle of the SBG message. */
+  geometry_msgs::msg::Vector3   gyro;                     /*!< Gyroscope of the SBG message, its delta angle for an IMU short message. */
+  double                        temperature{};            /*!< Temperature, in degrees Celsius. */
+};
+
+/*!
+ * EKF quaternion data kept to build ROS standard messages.
+ */
+struct SbgEkfQuatState
+{
+  uint32_t                      time_stamp{};             /*!< Time since sensor is powered up, in us. */
+  bool                          valid{};                  /*!< True once a quaternion message has been received. */
+  geometry_msgs::msg::Quaternion quaternion;              /*!< Orientation quaternion. */
+  geometry_msgs::msg::Vector3   accuracy;                 /*!< Angle accuracy, in rad. */
+};
+
+/*!
+ * EKF Euler data kept to build ROS standard messages.
+ */
+struct SbgEkfEulerState
+{
+  uint32_t                      time_stamp{};             /*!< Time since sensor is powered up, in us. */
+  geometry_msgs::msg::Vector3   angle;                    /*!< Euler angles, in rad. */
+  geometry_msgs::msg::Vector3   accuracy;                 /*!< Angle accuracy, in rad. */
+};
+
+/*!
+ * EKF navigation data kept to build ROS standard messages.
+ */
+struct SbgEkfNavState
+{
+  uint32_t                      time_stamp{};             /*!< Time since sensor is powered up, in us. */
+  uint8_t                       solution_mode{};          /*!< EKF solution mode. */
+  double                        latitude{};               /*!< Latitude, in degrees. */
+  double                        longitude{};              /*!< Longitude, in degrees. */
+  double                        altitude{};               /*!< Altitude above mean sea level, in m. */
+  geometry_msgs::msg::Vector3   velocity;                 /*!< Velocity, in m/s. */
+  geometry_msgs::msg::Vector3   velocity_accuracy;        /*!< Velocity accuracy, in m/s. */
+  geometry_msgs::msg::Vector3   position_accuracy;        /*!< Position accuracy, in m. */
+};
+
 /*!
  * Class to wrap the SBG logs into ROS messages.
  */
@@ -94,6 +148,11 @@ private:
   std::string                         frame_id_;
   bool                                use_enu_;
   TimeReference                       time_reference_;
+  rclcpp::Time                        arrival_time_;
+  rclcpp::Clock                       system_clock_;
+  SbgClockSync                        clock_sync_;
+  int64_t                             utc_epoch_ns_;
+  uint32_t                            utc_timestamp_;
 
   bool                                odom_enable_;
   bool                                odom_publish_tf_;
@@ -111,16 +170,26 @@ private:
   //---------------------------------------------------------------------//
 
   /*!
-   * Create a ROS message header.
+   * Fill a ROS message header.
    * 
    * \param[in] device_timestamp    SBG device timestamp (in microseconds).
-   * \return                        ROS header message.
+   * \param[out] ref_header         ROS header message.
+   */
+  void fillRosHeader(uint32_t device_timestamp, std_msgs::msg::Header &ref_header) const;
+
+  /*!
+   * Get the host time at which the log being processed has been received.
+   *
+   * \return                        Log arrival time, or the current time if unknown.
    */
-  const std_msgs::msg::Header createRosHeader(uint32_t device_timestamp) const;
+  const rclcpp::Time getArrivalTime() const;
 
   /*!
    * Convert INS timestamp from a SBG device to UNIX timestamp.
-   * 
+   *
+   * The epoch time of the last UTC log is cached, so the conversion only adds the device time elapsed since.
+   * Time stamps slightly older than the last UTC log are converted too.
+   *
    * \param[in] device_timestamp    SBG device timestamp (in microseconds).
    * \return                        ROS time.
    */
@@ -135,110 +204,101 @@ private:
   const rclcpp::Time convertUtcTimeToUnix(const sbg_driver::msg::SbgUtcTime& ref_sbg_utc_msg) const;
 
   /*!
-   * Create SBG-ROS Ekf status message.
+   * Fill SBG-ROS Ekf status message.
    * 
    * \param[in] ekf_status          SBG Ekf status.
-   * \return                        Ekf status message.
+   * \param[out] ref_ekf_status_message Ekf status message.
    */
-  const sbg_driver::msg::SbgEkfStatus createEkfStatusMessage(uint32_t ekf_status) const;
+  void fillEkfStatusMessage(uint32_t ekf_status, sbg_driver::msg::SbgEkfStatus &ref_ekf_status_message) const;
 
   /*!
-   * Create SBG-ROS GPS Position status message.
+   * Fill SBG-ROS GPS Position status message.
    * 
    * \param[in] ref_log_gps_pos     SBG GPS position log.
-   * \return                        GPS Position status.
+   * \param[out] ref_gps_pos_status_message GPS Position status.
    */
-  const sbg_driver::msg::SbgGpsPosStatus createGpsPosStatusMessage(const SbgEComLogGnssPos& ref_log_gps_pos) const;
+  void fillGpsPosStatusMessage(const SbgEComLogGnssPos& ref_log_gps_pos, sbg_driver::msg::SbgGpsPosStatus &ref_gps_pos_status_message) const;
 
   /*!
-   * Create SBG-ROS GPS Velocity status message.
+   * Fill SBG-ROS GPS Velocity status message.
    * 
    * \param[in] ref_log_gps_vel     SBG GPS Velocity log.
-   * \return                        GPS Velocity status.
+   * \param[out] ref_gps_vel_status_message GPS Velocity status.
    */
-  const sbg_driver::msg::SbgGpsVelStatus createGpsVelStatusMessage(const SbgEComLogGnssVel& ref_log_gps_vel) const;
+  void fillGpsVelStatusMessage(const SbgEComLogGnssVel& ref_log_gps_vel, sbg_driver::msg::SbgGpsVelStatus &ref_gps_vel_status_message) const;
 
   /*!
-   * Create a SBG-ROS IMU status message.
+   * Fill a SBG-ROS IMU status message.
    * 
    * \param[in] sbg_imu_status      SBG IMU status.
-   * \return                        IMU status message.
+   * \param[out] ref_imu_status_message IMU status message.
    */
-  const sbg_driver::msg::SbgImuStatus createImuStatusMessage(uint16_t sbg_imu_status) const;
+  void fillImuStatusMessage(uint16_t sbg_imu_status, sbg_driver::msg::SbgImuStatus &ref_imu_status_message) const;
 
   /*!
-   * Create a SBG-ROS Magnetometer status message.
+   * Fill a SBG-ROS Magnetometer status message.
    * 
    * \param[in] ref_log_mag         SBG Magnetometer log.
-   * \return                        Magnetometer status message.
+   * \param[out] ref_mag_status_message Magnetometer status message.
    */
-  const sbg_driver::msg::SbgMagStatus createMagStatusMessage(const SbgEComLogMag& ref_log_mag) const;
+  void fillMagStatusMessage(const SbgEComLogMag& ref_log_mag, sbg_driver::msg::SbgMagStatus &ref_mag_status_message) const;
 
   /*!
-   * Create a SBG-ROS Ship motion status message.
+   * Fill a SBG-ROS Ship motion status message.
    * 
    * \param[in] ref_log_ship_motion SBG Ship motion log.
-   * \return                        ship motion status message.
+   * \param[out] ref_ship_motion_status_message ship motion status message.
    */
-  const sbg_driver::msg::SbgShipMotionStatus createShipMotionStatusMessage(const SbgEComLogShipMotion& ref_log_ship_motion) const;
+  void fillShipMotionStatusMessage(const SbgEComLogShipMotion& ref_log_ship_motion, sbg_driver::msg::SbgShipMotionStatus &ref_ship_motion_status_message) const;
 
   /*!
-   * Create a SBG-ROS aiding status message.
+   * Fill a SBG-ROS aiding status message.
    *
    * \param[in] ref_log_status      SBG status log.
-   * \return                        Aiding status message.
+   * \param[out] ref_status_aiding_message Aiding status message.
    */
-  const sbg_driver::msg::SbgStatusAiding createStatusAidingMessage(const SbgEComLogStatus& ref_log_status) const;
+  void fillStatusAidingMessage(const SbgEComLogStatus& ref_log_status, sbg_driver::msg::SbgStatusAiding &ref_status_aiding_message) const;
 
   /*!
-   * Create a SBG-ROS com status message.
+   * Fill a SBG-ROS com status message.
    *
    * \param[in] ref_log_status      SBG status log.
-   * \return                        Com status message.
+   * \param[out] ref_status_com_message Com status message.
    */
-  const sbg_driver::msg::SbgStatusCom createStatusComMessage(const SbgEComLogStatus& ref_log_status) const;
+  void fillStatusComMessage(const SbgEComLogStatus& ref_log_status, sbg_driver::msg::SbgStatusCom &ref_status_com_message) const;
 
   /*!
-   * Create a SBG-ROS general status message.
+   * Fill a SBG-ROS general status message.
    *
    * \param[in] ref_log_status      SBG status log.
-   * \return                        General status message.
+   * \param[out] ref_status_general_message General status message.
    */
-  const sbg_driver::msg::SbgStatusGeneral createStatusGeneralMessage(const SbgEComLogStatus& ref_log_status) const;
+  void fillStatusGeneralMessage(const SbgEComLogStatus& ref_log_status, sbg_driver::msg::SbgStatusGeneral &ref_status_general_message) const;
 
   /*!
-   * Create a SBG-ROS UTC time status message.
+   * Fill a SBG-ROS UTC time status message.
    * 
    * \param[in] ref_log_utc         SBG UTC data log.
-   * \return                        UTC time status message.
+   * \param[out] ref_utc_status_message UTC time status message.
    */
-  const sbg_driver::msg::SbgUtcTimeStatus createUtcStatusMessage(const SbgEComLogUtc& ref_log_utc) const;
+  void fillUtcStatusMessage(const SbgEComLogUtc& ref_log_utc, sbg_driver::msg::SbgUtcTimeStatus &ref_utc_status_message) const;
 
   /*!
-   * Create a SBG-ROS air data status message.
+   * Fill a SBG-ROS air data status message.
    * 
    * \param[in] ref_sbg_air_data    SBG AirData log.
-   * \return                        SBG-ROS air data status message.
+   * \param[out] ref_air_data_status_message SBG-ROS air data status message.
    */
-  const sbg_driver::msg::SbgAirDataStatus createAirDataStatusMessage(const SbgEComLogAirData& ref_sbg_air_data) const;
+  void fillAirDataStatusMessage(const SbgEComLogAirData& ref_sbg_air_data, sbg_driver::msg::SbgAirDataStatus &ref_air_data_status_message) const;
  
   /*!
-   * Create a ROS standard TwistStamped message.
-   *
-   * \param[in] body_vel            SBG Body velocity vector.
-   * \param[in] ref_sbg_air_data    SBG IMU message.
-   * \return                        SBG TwistStamped message.
-   */
-  const geometry_msgs::msg::TwistStamped createRosTwistStampedMessage(const sbg::SbgVector3f& body_vel, const sbg_driver::msg::SbgImuData& ref_sbg_imu_msg) const;
-
-  /*!
-   * Create a ROS standard TwistStamped message.
+   * Fill a ROS standard TwistStamped message.
    *
    * \param[in] body_vel            SBG Body velocity vector.
-   * \param[in] ref_sbg_air_data    SBG IMU message.
-   * \return                        SBG TwistStamped message.
+   * \param[in] ref_imu_state       IMU state.
+   * \param[out] ref_twist_stamped_message SBG TwistStamped message.
    */
-  const geometry_msgs::msg::TwistStamped createRosTwistStampedMessage(const sbg::SbgVector3f& body_vel, const sbg_driver::msg::SbgImuShort& ref_sbg_imu_msg) const;
+  void fillRosTwistStampedMessage(const sbg::SbgVector3f& body_vel, const SbgImuState& ref_imu_state, geometry_msgs::msg::TwistStamped &ref_twist_stamped_message) const;
 
   /*!
    * Fill a transformation.
@@ -279,6 +339,16 @@ public:
    */
   void setTimeReference(TimeReference time_reference);
 
+  /*!
+   * Set the host time at which the log being processed has been received.
+   *
+   * With the host synchronized time reference, the arrival time also updates the device to host clock estimation.
+   *
+   * \param[in] ref_arrival_time  Log arrival time, null clocks if unknown.
+   * \param[in] device_timestamp  SBG device timestamp of the log (in microseconds), zero if the log has none.
+   */
+  void setArrivalTime(const SbgInterfaceTimestamp &ref_arrival_time, uint32_t device_timestamp);
+
   /*!
    * Set Frame ID.
    *
@@ -333,336 +403,332 @@ public:
   //---------------------------------------------------------------------//
 
   /*!
-   * Create a SBG-ROS Ekf Euler message.
+   * Fill a SBG-ROS Ekf Euler message.
    * 
    * \param[in] ref_log_ekf_euler   SBG Ekf Euler log.
-   * \return                        Ekf Euler message.
+   * \param[out] ref_ekf_euler_message Ekf Euler message.
    */
-  const sbg_driver::msg::SbgEkfEuler createSbgEkfEulerMessage(const SbgEComLogEkfEuler& ref_log_ekf_euler) const;
+  void fillSbgEkfEulerMessage(const SbgEComLogEkfEuler& ref_log_ekf_euler, sbg_driver::msg::SbgEkfEuler &ref_ekf_euler_message) const;
 
   /*!
-   * Create a SBG-ROS Ekf Navigation message.
+   * Fill a SBG-ROS Ekf Navigation message.
    * 
    * \param[in] ref_log_ekf_nav     SBG Ekf Navigation log.
-   * \return                        Ekf Navigation message.
+   * \param[out] ref_ekf_nav_message Ekf Navigation message.
    */
-  const sbg_driver::msg::SbgEkfNav createSbgEkfNavMessage(const SbgEComLogEkfNav& ref_log_ekf_nav) const;
+  void fillSbgEkfNavMessage(const SbgEComLogEkfNav& ref_log_ekf_nav, sbg_driver::msg::SbgEkfNav &ref_ekf_nav_message) const;
 
   /*!
-   * Create a SBG-ROS Ekf Quaternion message.
+   * Fill a SBG-ROS Ekf Quaternion message.
    * 
    * \param[in] ref_log_ekf_quat    SBG Ekf Quaternion log.
-   * \return                        Ekf Quaternion message.
+   * \param[out] ref_ekf_quat_message Ekf Quaternion message.
    */
-  const sbg_driver::msg::SbgEkfQuat createSbgEkfQuatMessage(const SbgEComLogEkfQuat& ref_log_ekf_quat) const;
+  void fillSbgEkfQuatMessage(const SbgEComLogEkfQuat& ref_log_ekf_quat, sbg_driver::msg::SbgEkfQuat &ref_ekf_quat_message) const;
 
   /*!
-   * Create a SBG-ROS Ekf Velocity Body message.
+   * Fill a SBG-ROS Ekf Velocity Body message.
    *
    * \param[in] ref_log_ekf_vel_body        SBG Ekf Velocity Body log.
-   * \return                                Ekf Velocity body message.
+   * \param[out] ref_ekf_vel_body_message   Ekf Velocity body message.
    */
-  const sbg_driver::msg::SbgEkfVelBody createSbgEkfVelBodyMessage(const SbgEComLogEkfVelBody& ref_log_ekf_vel_body) const;
+  void fillSbgEkfVelBodyMessage(const SbgEComLogEkfVelBody& ref_log_ekf_vel_body, sbg_driver::msg::SbgEkfVelBody &ref_ekf_vel_body_message) const;
 
   /*!
-   * Create a SBG-ROS Ekf Rotation Acceleration message.
+   * Fill a SBG-ROS Ekf Rotation Acceleration message.
    *
    * \param[in] ref_log_ekf_rot_accel       SBG Ekf Rotation Acceleration log.
-   * \return                                Ekf Rotation Acceleration message.
+   * \param[out] ref_ekf_vel_rot_accel_message Ekf Rotation Acceleration message.
    */
-  const sbg_driver::msg::SbgEkfRotAccel createSbgEkfRotAccelMessage(const SbgEComLogEkfRotAccel& ref_log_ekf_rot_accel) const;
+  void fillSbgEkfRotAccelMessage(const SbgEComLogEkfRotAccel& ref_log_ekf_rot_accel, sbg_driver::msg::SbgEkfRotAccel &ref_ekf_vel_rot_accel_message) const;
 
   /*!
-   * Create a SBG-ROS event message.
+   * Fill a SBG-ROS event message.
    * 
    * \param[in] ref_log_event       SBG event log.
-   * \return                        Event message.
+   * \param[out] ref_event_message  Event message.
    */
-  const sbg_driver::msg::SbgEvent createSbgEventMessage(const SbgEComLogEvent& ref_log_event) const;
+  void fillSbgEventMessage(const SbgEComLogEvent& ref_log_event, sbg_driver::msg::SbgEvent &ref_event_message) const;
 
   /*!
-   * Create SBG-ROS GPS-HDT message.
+   * Fill SBG-ROS GPS-HDT message.
    * 
    * \param[in] ref_log_gps_hdt     SBG GPS HDT log.
-   * \return                        GPS HDT message.
+   * \param[out] ref_gps_hdt_message GPS HDT message.
    */
-  const sbg_driver::msg::SbgGpsHdt createSbgGpsHdtMessage(const SbgEComLogGnssHdt& ref_log_gps_hdt) const;
+  void fillSbgGpsHdtMessage(const SbgEComLogGnssHdt& ref_log_gps_hdt, sbg_driver::msg::SbgGpsHdt &ref_gps_hdt_message) const;
 
   /*!
-   * Create a SBG-ROS GPS-Position message.
+   * Fill a SBG-ROS GPS-Position message.
    * 
    * \param[in] ref_log_gps_pos     SBG GPS Position log.
-   * \return                        GPS Position message.
+   * \param[out] ref_gps_pos_message GPS Position message.
    */
-  const sbg_driver::msg::SbgGpsPos createSbgGpsPosMessage(const SbgEComLogGnssPos& ref_log_gps_pos) const;
+  void fillSbgGpsPosMessage(const SbgEComLogGnssPos& ref_log_gps_pos, sbg_driver::msg::SbgGpsPos &ref_gps_pos_message) const;
 
   /*!
-   * Create a SBG-ROS GPS raw message.
+   * Fill a SBG-ROS GPS raw message.
    * 
    * \param[in] ref_log_gps_raw     SBG GPS raw log.
-   * \return                        GPS raw message.
+   * \param[out] ref_gps_raw_message GPS raw message.
    */
-  const sbg_driver::msg::SbgGpsRaw createSbgGpsRawMessage(const SbgEComLogRawData& ref_log_gps_raw) const;
+  void fillSbgGpsRawMessage(const SbgEComLogRawData& ref_log_gps_raw, sbg_driver::msg::SbgGpsRaw &ref_gps_raw_message) const;
 
   /*!
-   * Create a SBG-ROS GPS Velocity message.
+   * Fill a SBG-ROS GPS Velocity message.
    * 
    * \param[in] ref_log_gps_vel     SBG GPS Velocity log.
-   * \return                        GPS Velocity message.
+   * \param[out] ref_gps_vel_message GPS Velocity message.
    */
-  const sbg_driver::msg::SbgGpsVel createSbgGpsVelMessage(const SbgEComLogGnssVel& ref_log_gps_vel) const;
+  void fillSbgGpsVelMessage(const SbgEComLogGnssVel& ref_log_gps_vel, sbg_driver::msg::SbgGpsVel &ref_gps_vel_message) const;
 
   /*!
-   * Create a SBG-ROS Imu data message.
+   * Fill a SBG-ROS Imu data message.
    * 
    * \param[in] ref_log_imu_data    SBG Imu data log.
-   * \return                        Imu data message.
+   * \param[out] ref_imu_data_message Imu data message.
    */
-  const sbg_driver::msg::SbgImuData createSbgImuDataMessage(const SbgEComLogImuLegacy& ref_log_imu_data) const;
+  void fillSbgImuDataMessage(const SbgEComLogImuLegacy& ref_log_imu_data, sbg_driver::msg::SbgImuData &ref_imu_data_message) const;
 
   /*!
-   * Create a SBG-ROS Magnetometer message.
+   * Fill a SBG-ROS Magnetometer message.
    * 
    * \param[in] ref_log_mag         SBG Magnetometer log.
-   * \return                        Magnetometer message.
+   * \param[out] ref_mag_message    Magnetometer message.
    */
-  const sbg_driver::msg::SbgMag createSbgMagMessage(const SbgEComLogMag& ref_log_mag) const;
+  void fillSbgMagMessage(const SbgEComLogMag& ref_log_mag, sbg_driver::msg::SbgMag &ref_mag_message) const;
 
   /*!
-   * Create a SBG-ROS Magnetometer calibration message.
+   * Fill a SBG-ROS Magnetometer calibration message.
    * 
    * \param[in] ref_log_mag_calib   SBG Magnetometer calibration log.
-   * \return                        Magnetometer calibration message.
+   * \param[out] ref_mag_calib_message Magnetometer calibration message.
    */
-  const sbg_driver::msg::SbgMagCalib createSbgMagCalibMessage(const SbgEComLogMagCalib& ref_log_mag_calib) const;
+  void fillSbgMagCalibMessage(const SbgEComLogMagCalib& ref_log_mag_calib, sbg_driver::msg::SbgMagCalib &ref_mag_calib_message) const;
 
   /*!
-   * Create a SBG-ROS Odometer velocity message.
+   * Fill a SBG-ROS Odometer velocity message.
    * 
    * \param[in] ref_log_odo         SBG Odometer log.
-   * \return                        Odometer message.
+   * \param[out] ref_odo_vel_message Odometer message.
    */
-  const sbg_driver::msg::SbgOdoVel createSbgOdoVelMessage(const SbgEComLogOdometer& ref_log_odo) const;
+  void fillSbgOdoVelMessage(const SbgEComLogOdometer& ref_log_odo, sbg_driver::msg::SbgOdoVel &ref_odo_vel_message) const;
 
   /*!
-   * Create a SBG-ROS Shipmotion message.
+   * Fill a SBG-ROS Shipmotion message.
    * 
    * \param[in] ref_log_ship_motion SBG Ship motion log.
-   * \return                        Ship motion message.
+   * \param[out] ref_ship_motion_message Ship motion message.
    */
-  const sbg_driver::msg::SbgShipMotion createSbgShipMotionMessage(const SbgEComLogShipMotion& ref_log_ship_motion) const;
+  void fillSbgShipMotionMessage(const SbgEComLogShipMotion& ref_log_ship_motion, sbg_driver::msg::SbgShipMotion &ref_ship_motion_message) const;
 
   /*!
-   * Create a SBG-ROS status message from a SBG status log.
+   * Fill a SBG-ROS status message from a SBG status log.
    *
    * \param[in] ref_log_status      SBG status log.
-   * \return                        Status message.
+   * \param[out] ref_status_message Status message.
    */
-  const sbg_driver::msg::SbgStatus createSbgStatusMessage(const SbgEComLogStatus& ref_log_status) const;
+  void fillSbgStatusMessage(const SbgEComLogStatus& ref_log_status, sbg_driver::msg::SbgStatus &ref_status_message) const;
 
   /*!
-   * Create a SBG-ROS UTC time message from a SBG UTC log.
+   * Fill a SBG-ROS UTC time message from a SBG UTC log.
    *
    * \param[in] ref_log_utc         SBG UTC log.
-   * \return                        UTC time message.                  
+   * \param[out] ref_utc_time_message UTC time message.                  
    */
-  const sbg_driver::msg::SbgUtcTime createSbgUtcTimeMessage(const SbgEComLogUtc& ref_log_utc);
+  void fillSbgUtcTimeMessage(const SbgEComLogUtc& ref_log_utc, sbg_driver::msg::SbgUtcTime &ref_utc_time_message);
 
   /*!
-   * Create a SBG-ROS Air data message from a SBG log.
+   * Fill a SBG-ROS Air data message from a SBG log.
    * 
    * \param[in] ref_air_data_log    SBG AirData log.
-   * \return                        SBG-ROS airData message.
+   * \param[out] ref_air_data_message SBG-ROS airData message.
    */
-  const sbg_driver::msg::SbgAirData createSbgAirDataMessage(const SbgEComLogAirData& ref_air_data_log) const;
+  void fillSbgAirDataMessage(const SbgEComLogAirData& ref_air_data_log, sbg_driver::msg::SbgAirData &ref_air_data_message) const;
 
   /*!
-   * Create a SBG-ROS Short Imu message.
+   * Fill a SBG-ROS Short Imu message.
    * 
    * \param[in] ref_short_imu_log   SBG Imu short log.
-   * \return                        SBG-ROS Imu short message.
+   * \param[out] ref_imu_short_message SBG-ROS Imu short message.
    */
-  const sbg_driver::msg::SbgImuShort createSbgImuShortMessage(const SbgEComLogImuShort& ref_short_imu_log) const;
+  void fillSbgImuShortMessage(const SbgEComLogImuShort& ref_short_imu_log, sbg_driver::msg::SbgImuShort &ref_imu_short_message) const;
 
   /*!
-   * Create a ROS standard IMU message from SBG messages.
-   * 
+   * Fill a SBG-ROS fixed size IMU message.
+   *
    * \param[in] ref_sbg_imu_msg     SBG-ROS IMU message.
-   * \param[in] ref_sbg_quat_msg    SBG_ROS Quaternion message.
-   * \return                        ROS standard IMU message.
+   * \param[out] ref_imu_data_fixed_message SBG-ROS fixed size IMU message.
    */
-  const sensor_msgs::msg::Imu createRosImuMessage(const sbg_driver::msg::SbgImuData& ref_sbg_imu_msg, const sbg_driver::msg::SbgEkfQuat& ref_sbg_quat_msg) const;
+  void fillSbgImuDataFixedMessage(const sbg_driver::msg::SbgImuData& ref_sbg_imu_msg, sbg_driver::msg::SbgImuDataFixed &ref_imu_data_fixed_message) const;
 
   /*!
-   * Create a ROS standard IMU message from SBG messages.
-   * 
-   * \param[in] ref_sbg_imu_msg     SBG-ROS IMU message.
-   * \param[in] ref_sbg_quat_msg    SBG_ROS Quaternion message.
-   * \return                        ROS standard IMU message.
+   * Fill a SBG-ROS fixed size Short Imu message.
+   *
+   * \param[in] ref_sbg_imu_msg     SBG-ROS Short Imu message.
+   * \param[out] ref_imu_short_fixed_message SBG-ROS fixed size Short Imu message.
    */
-  const sensor_msgs::msg::Imu createRosImuMessage(const sbg_driver::msg::SbgImuShort& ref_sbg_imu_msg, const sbg_driver::msg::SbgEkfQuat& ref_sbg_quat_msg) const;
+  void fillSbgImuShortFixedMessage(const sbg_driver::msg::SbgImuShort& ref_sbg_imu_msg, sbg_driver::msg::SbgImuShortFixed &ref_imu_short_fixed_message) const;
 
   /*!
-   * Create a ROS standard odometry message from SBG messages.
+   * Fill a SBG-ROS fixed size Ekf Quaternion message.
    *
-   * \param[in] ref_sbg_imu_msg         SBG-ROS IMU message.
-   * \param[in] ref_sbg_ekf_nav_msg     SBG-ROS Ekf Nav message.
-   * \param[in] ref_sbg_ekf_quat_msg    SBG-ROS Ekf Quaternion message.
-   * \param[in] ref_sbg_ekf_euler_msg   SBG-ROS Ekf Euler message.
-   * \return                            ROS standard odometry message.
+   * \param[in] ref_sbg_ekf_quat_msg  SBG-ROS Ekf Quaternion message.
+   * \param[out] ref_ekf_quat_fixed_message SBG-ROS fixed size Ekf Quaternion message.
    */
-  const nav_msgs::msg::Odometry createRosOdoMessage(const sbg_driver::msg::SbgImuData &ref_sbg_imu_msg, const sbg_driver::msg::SbgEkfNav &ref_sbg_ekf_nav_msg, const sbg_driver::msg::SbgEkfQuat &ref_sbg_ekf_quat_msg, const sbg_driver::msg::SbgEkfEuler &ref_sbg_ekf_euler_msg);
+  void fillSbgEkfQuatFixedMessage(const sbg_driver::msg::SbgEkfQuat& ref_sbg_ekf_quat_msg, sbg_driver::msg::SbgEkfQuatFixed &ref_ekf_quat_fixed_message) const;
 
   /*!
-   * Create a ROS standard odometry message from SBG messages.
+   * Fill an IMU state from a SBG-ROS IMU message.
    *
-   * \param[in] ref_sbg_imu_msg         SBG-ROS IMU message.
-   * \param[in] ref_sbg_ekf_nav_msg     SBG-ROS Ekf Nav message.
-   * \param[in] ref_sbg_ekf_euler_msg   SBG-ROS Ekf Euler message.
-   * \return                            ROS standard odometry message.
+   * \param[in] ref_sbg_imu_msg     SBG-ROS IMU message.
+   * \param[out] ref_imu_state      IMU state.
    */
-  const nav_msgs::msg::Odometry createRosOdoMessage(const sbg_driver::msg::SbgImuData &ref_sbg_imu_msg, const sbg_driver::msg::SbgEkfNav &ref_sbg_ekf_nav_msg, const sbg_driver::msg::SbgEkfEuler &ref_sbg_ekf_euler_msg);
+  void fillImuState(const sbg_driver::msg::SbgImuData& ref_sbg_imu_msg, SbgImuState &ref_imu_state) const;
 
   /*!
-   * Create a ROS standard odometry message from SBG messages and tf2 quaternion.
+   * Fill an IMU state from a SBG-ROS Short Imu message.
    *
-   * \param[in] ref_sbg_imu_msg         SBG-ROS IMU message.
-   * \param[in] ref_sbg_ekf_nav_msg     SBG-ROS Ekf Nav message.
-   * \param[in] orientation             Orientation as a Tf2 quaternion.
-   * \param[in] ref_sbg_ekf_euler_msg   SBG-ROS Ekf Euler message.
-   * \return                            ROS standard odometry message.
+   * \param[in] ref_sbg_imu_msg     SBG-ROS Short Imu message.
+   * \param[out] ref_imu_state      IMU state.
    */
-  const nav_msgs::msg::Odometry createRosOdoMessage(const sbg_driver::msg::SbgImuData &ref_sbg_imu_msg, const sbg_driver::msg::SbgEkfNav &ref_sbg_ekf_nav_msg, const tf2::Quaternion &ref_orientation, const sbg_driver::msg::SbgEkfEuler &ref_sbg_ekf_euler_msg);
+  void fillImuState(const sbg_driver::msg::SbgImuShort& ref_sbg_imu_msg, SbgImuState &ref_imu_state) const;
 
   /*!
-   * Create a ROS standard odometry message from SBG messages.
+   * Fill an EKF quaternion state from a SBG-ROS message.
    *
-   * \param[in] ref_sbg_imu_msg         SBG-ROS IMU message.
-   * \param[in] ref_sbg_ekf_nav_msg     SBG-ROS Ekf Nav message.
-   * \param[in] ref_sbg_ekf_quat_msg    SBG-ROS Ekf Quaternion message.
-   * \param[in] ref_sbg_ekf_euler_msg   SBG-ROS Ekf Euler message.
-   * \return                            ROS standard odometry message.
+   * \param[in] ref_sbg_ekf_quat_msg  SBG-ROS Ekf Quaternion message.
+   * \param[out] ref_ekf_quat_state   EKF quaternion state.
    */
-  const nav_msgs::msg::Odometry createRosOdoMessage(const sbg_driver::msg::SbgImuShort &ref_sbg_imu_msg, const sbg_driver::msg::SbgEkfNav &ref_sbg_ekf_nav_msg, const sbg_driver::msg::SbgEkfQuat &ref_sbg_ekf_quat_msg, const sbg_driver::msg::SbgEkfEuler &ref_sbg_ekf_euler_msg);
+  void fillEkfQuatState(const sbg_driver::msg::SbgEkfQuat& ref_sbg_ekf_quat_msg, SbgEkfQuatState &ref_ekf_quat_state) const;
 
   /*!
-   * Create a ROS standard odometry message from SBG messages.
+   * Fill an EKF Euler state from a SBG-ROS message.
    *
-   * \param[in] ref_sbg_imu_msg         SBG-ROS IMU message.
-   * \param[in] ref_sbg_ekf_nav_msg     SBG-ROS Ekf Nav message.
-   * \param[in] ref_sbg_ekf_euler_msg   SBG-ROS Ekf Euler message.
-   * \return                            ROS standard odometry message.
+   * \param[in] ref_sbg_ekf_euler_msg SBG-ROS Ekf Euler message.
+   * \param[out] ref_ekf_euler_state  EKF Euler state.
    */
-  const nav_msgs::msg::Odometry createRosOdoMessage(const sbg_driver::msg::SbgImuShort &ref_sbg_imu_msg, const sbg_driver::msg::SbgEkfNav &ref_sbg_ekf_nav_msg, const sbg_driver::msg::SbgEkfEuler &ref_sbg_ekf_euler_msg);
+  void fillEkfEulerState(const sbg_driver::msg::SbgEkfEuler& ref_sbg_ekf_euler_msg, SbgEkfEulerState &ref_ekf_euler_state) const;
 
   /*!
-   * Create a ROS standard odometry message from SBG messages and tf2 quaternion.
+   * Fill an EKF navigation state from a SBG-ROS message.
    *
-   * \param[in] ref_sbg_imu_msg         SBG-ROS IMU message.
-   * \param[in] ref_sbg_ekf_nav_msg     SBG-ROS Ekf Nav message.
-   * \param[in] orientation             Orientation as a Tf2 quaternion.
-   * \param[in] ref_sbg_ekf_euler_msg   SBG-ROS Ekf Euler message.
-   * \return                            ROS standard odometry message.
+   * \param[in] ref_sbg_ekf_nav_msg   SBG-ROS Ekf Nav message.
+   * \param[out] ref_ekf_nav_state    EKF navigation state.
    */
-  const nav_msgs::msg::Odometry createRosOdoMessage(const sbg_driver::msg::SbgImuShort &ref_sbg_imu_msg, const sbg_driver::msg::SbgEkfNav &ref_sbg_ekf_nav_msg, const tf2::Quaternion &ref_orientation, const sbg_driver::msg::SbgEkfEuler &ref_sbg_ekf_euler_msg);
+  void fillEkfNavState(const sbg_driver::msg::SbgEkfNav& ref_sbg_ekf_nav_msg, SbgEkfNavState &ref_ekf_nav_state) const;
 
   /*!
-   * Create a ROS standard Temperature message from SBG message.
+   * Fill a ROS standard IMU message from SBG states.
    * 
-   * \param[in] ref_sbg_imu_msg     SBG-ROS IMU message.
-   * \return                        ROS standard Temperature message.
+   * \param[in] ref_imu_state       IMU state.
+   * \param[in] ref_ekf_quat_state  EKF quaternion state.
+   * \param[out] ref_imu_ros_message ROS standard IMU message.
    */
-  const sensor_msgs::msg::Temperature createRosTemperatureMessage(const sbg_driver::msg::SbgImuData& ref_sbg_imu_msg) const;
+  void fillRosImuMessage(const SbgImuState& ref_imu_state, const SbgEkfQuatState& ref_ekf_quat_state, sensor_msgs::msg::Imu &ref_imu_ros_message) const;
 
   /*!
-   * Create a ROS standard Temperature message from SBG message.
-   * 
-   * \param[in] ref_sbg_imu_msg     SBG-ROS IMU message.
-   * \return                        ROS standard Temperature message.
+   * Fill a ROS standard odometry message from SBG states.
+   *
+   * \param[in] ref_imu_state           IMU state.
+   * \param[in] ref_ekf_nav_state       EKF navigation state.
+   * \param[in] ref_ekf_quat_state      EKF quaternion state.
+   * \param[in] ref_ekf_euler_state     EKF Euler state.
+   * \param[out] ref_odo_ros_msg        ROS standard odometry message.
    */
-  const sensor_msgs::msg::Temperature createRosTemperatureMessage(const sbg_driver::msg::SbgImuShort& ref_sbg_imu_msg) const;
+  void fillRosOdoMessage(const SbgImuState &ref_imu_state, const SbgEkfNavState &ref_ekf_nav_state, const SbgEkfQuatState &ref_ekf_quat_state, const SbgEkfEulerState &ref_ekf_euler_state, nav_msgs::msg::Odometry &ref_odo_ros_msg);
 
   /*!
-   * Create a ROS standard MagneticField message from SBG message.
-   * 
-   * \param[in] ref_sbg_mag_msg     SBG-ROS Mag message.
-   * \return                        ROS standard Mag message.
+   * Fill a ROS standard odometry message from SBG states.
+   *
+   * \param[in] ref_imu_state           IMU state.
+   * \param[in] ref_ekf_nav_state       EKF navigation state.
+   * \param[in] ref_ekf_euler_state     EKF Euler state.
+   * \param[out] ref_odo_ros_msg        ROS standard odometry message.
    */
-  const sensor_msgs::msg::MagneticField createRosMagneticMessage(const sbg_driver::msg::SbgMag& ref_sbg_mag_msg) const;
+  void fillRosOdoMessage(const SbgImuState &ref_imu_state, const SbgEkfNavState &ref_ekf_nav_state, const SbgEkfEulerState &ref_ekf_euler_state, nav_msgs::msg::Odometry &ref_odo_ros_msg);
 
   /*!
-   * Create a ROS standard TwistStamped message from SBG messages.
+   * Fill a ROS standard odometry message from SBG states and tf2 quaternion.
+   *
+   * \param[in] ref_imu_state           IMU state.
+   * \param[in] ref_ekf_nav_state       EKF navigation state.
+   * \param[in] orientation             Orientation as a Tf2 quaternion.
+   * \param[in] ref_ekf_euler_state     EKF Euler state.
+   * \param[out] ref_odo_ros_msg        ROS standard odometry message.
+   */
+  void fillRosOdoMessage(const SbgImuState &ref_imu_state, const SbgEkfNavState &ref_ekf_nav_state, const tf2::Quaternion &ref_orientation, const SbgEkfEulerState &ref_ekf_euler_state, nav_msgs::msg::Odometry &ref_odo_ros_msg);
+
+  /*!
+   * Fill a ROS standard Temperature message from SBG state.
    * 
-   * \param[in] ref_sbg_ekf_euler_msg   SBG-ROS Ekf Euler message.
-   * \param[in] ref_sbg_ekf_nav_msg     SBG-ROS Ekf Nav message.
-   * \param[in] ref_sbg_imu_msg     SBG-ROS IMU message.
-   * \return                        ROS standard TwistStamped message.
+   * \param[in] ref_imu_state       IMU state.
+   * \param[out] ref_temperature_message ROS standard Temperature message.
    */
-  const geometry_msgs::msg::TwistStamped createRosTwistStampedMessage(const sbg_driver::msg::SbgEkfEuler& ref_sbg_ekf_euler_msg, const sbg_driver::msg::SbgEkfNav& ref_sbg_ekf_nav_msg, const sbg_driver::msg::SbgImuData& ref_sbg_imu_msg) const;
+  void fillRosTemperatureMessage(const SbgImuState& ref_imu_state, sensor_msgs::msg::Temperature &ref_temperature_message) const;
 
   /*!
-   * Create a ROS standard TwistStamped message from SBG messages.
-   *
-   * \param[in] ref_sbg_ekf_quat_msg    SBG-ROS Ekf Quaternion message.
-   * \param[in] ref_sbg_ekf_nav_msg     SBG-ROS Ekf Nav message.
-   * \param[in] ref_sbg_imu_msg         SBG-ROS IMU message.
-   * \return                            ROS standard TwistStamped message.
+   * Fill a ROS standard MagneticField message from SBG message.
+   * 
+   * \param[in] ref_sbg_mag_msg     SBG-ROS Mag message.
+   * \param[out] ref_magnetic_message ROS standard Mag message.
    */
-  const geometry_msgs::msg::TwistStamped createRosTwistStampedMessage(const sbg_driver::msg::SbgEkfQuat& ref_sbg_ekf_vel_msg, const sbg_driver::msg::SbgEkfNav& ref_sbg_ekf_nav_msg, const sbg_driver::msg::SbgImuData& ref_sbg_imu_msg) const;
+  void fillRosMagneticMessage(const sbg_driver::msg::SbgMag& ref_sbg_mag_msg, sensor_msgs::msg::MagneticField &ref_magnetic_message) const;
+
   /*!
-   * Create a ROS standard TwistStamped message from SBG messages.
+   * Fill a ROS standard TwistStamped message from SBG states.
    * 
-   * \param[in] ref_sbg_ekf_euler_msg   SBG-ROS Ekf Euler message.
-   * \param[in] ref_sbg_ekf_nav_msg     SBG-ROS Ekf Nav message.
-   * \param[in] ref_sbg_imu_msg     SBG-ROS IMU message.
-   * \return                        ROS standard TwistStamped message.
+   * \param[in] ref_ekf_euler_state EKF Euler state.
+   * \param[in] ref_ekf_nav_state   EKF navigation state.
+   * \param[in] ref_imu_state       IMU state.
+   * \param[out] ref_twist_stamped_message ROS standard TwistStamped message.
    */
-  const geometry_msgs::msg::TwistStamped createRosTwistStampedMessage(const sbg_driver::msg::SbgEkfEuler& ref_sbg_ekf_euler_msg, const sbg_driver::msg::SbgEkfNav& ref_sbg_ekf_nav_msg, const sbg_driver::msg::SbgImuShort& ref_sbg_imu_msg) const;
+  void fillRosTwistStampedMessage(const SbgEkfEulerState& ref_ekf_euler_state, const SbgEkfNavState& ref_ekf_nav_state, const SbgImuState& ref_imu_state, geometry_msgs::msg::TwistStamped &ref_twist_stamped_message) const;
 
   /*!
-   * Create a ROS standard TwistStamped message from SBG messages.
+   * Fill a ROS standard TwistStamped message from SBG states.
    *
-   * \param[in] ref_sbg_ekf_quat_msg    SBG-ROS Ekf Quaternion message.
-   * \param[in] ref_sbg_ekf_nav_msg     SBG-ROS Ekf Nav message.
-   * \param[in] ref_sbg_imu_msg         SBG-ROS IMU message.
-   * \return                            ROS standard TwistStamped message.
+   * \param[in] ref_ekf_quat_state  EKF quaternion state.
+   * \param[in] ref_ekf_nav_state   EKF navigation state.
+   * \param[in] ref_imu_state       IMU state.
+   * \param[out] ref_twist_stamped_message ROS standard TwistStamped message.
    */
-  const geometry_msgs::msg::TwistStamped createRosTwistStampedMessage(const sbg_driver::msg::SbgEkfQuat& ref_sbg_ekf_vel_msg, const sbg_driver::msg::SbgEkfNav& ref_sbg_ekf_nav_msg, const sbg_driver::msg::SbgImuShort& ref_sbg_imu_msg) const;
+  void fillRosTwistStampedMessage(const SbgEkfQuatState& ref_ekf_quat_state, const SbgEkfNavState& ref_ekf_nav_state, const SbgImuState& ref_imu_state, geometry_msgs::msg::TwistStamped &ref_twist_stamped_message) const;
 
   /*!
-   * Create a ROS standard PointStamped message from SBG messages.
+   * Fill a ROS standard PointStamped message from SBG state.
    * 
-   * \param[in] ref_sbg_ekf_msg     SBG-ROS EkfNav message.
-   * \return                        ROS standard PointStamped message (ECEF).
+   * \param[in] ref_ekf_nav_state   EKF navigation state.
+   * \param[out] ref_point_stamped_message ROS standard PointStamped message (ECEF).
    */
-  const geometry_msgs::msg::PointStamped createRosPointStampedMessage(const sbg_driver::msg::SbgEkfNav& ref_sbg_ekf_msg) const;
+  void fillRosPointStampedMessage(const SbgEkfNavState& ref_ekf_nav_state, geometry_msgs::msg::PointStamped &ref_point_stamped_message) const;
 
   /*!
-   * Create a ROS standard timeReference message for a UTC time.
+   * Fill a ROS standard timeReference message for a UTC time.
    * 
    * \param[in] ref_sbg_utc_msg     SBG-ROS UTC message.
-   * \return                        ROS standard timeReference message.
+   * \param[out] ref_utc_reference_message ROS standard timeReference message.
    */
-  const sensor_msgs::msg::TimeReference createRosUtcTimeReferenceMessage(const sbg_driver::msg::SbgUtcTime& ref_sbg_utc_msg) const;
+  void fillRosUtcTimeReferenceMessage(const sbg_driver::msg::SbgUtcTime& ref_sbg_utc_msg, sensor_msgs::msg::TimeReference &ref_utc_reference_message) const;
 
   /*!
-   * Create a ROS standard NavSatFix message from a Gps message.
+   * Fill a ROS standard NavSatFix message from a Gps message.
    * 
    * \param[in] ref_sbg_gps_msg     SBG-ROS GPS position message.
-   * \return                        ROS standard NavSatFix message.
+   * \param[out] ref_nav_sat_fix_message ROS standard NavSatFix message.
    */
-  const sensor_msgs::msg::NavSatFix createRosNavSatFixMessage(const sbg_driver::msg::SbgGpsPos& ref_sbg_gps_msg) const;
+  void fillRosNavSatFixMessage(const sbg_driver::msg::SbgGpsPos& ref_sbg_gps_msg, sensor_msgs::msg::NavSatFix &ref_nav_sat_fix_message) const;
 
   /*!
-   * Create a ROS standard FluidPressure message.
+   * Fill a ROS standard FluidPressure message.
    * 
    * \param[in] ref_sbg_air_msg     SBG-ROS AirData message.
-   * \return                        ROS standard fluid pressure message.
+   * \param[out] ref_fluid_pressure_message ROS standard fluid pressure message.
    */
-  const sensor_msgs::msg::FluidPressure createRosFluidPressureMessage(const sbg_driver::msg::SbgAirData& ref_sbg_air_msg) const;
+  void fillRosFluidPressureMessage(const sbg_driver::msg::SbgAirData& ref_sbg_air_msg, sensor_msgs::msg::FluidPressure &ref_fluid_pressure_message) const;
 
   /*!
-   * Create a ROS NMEA GGA message especially designed to support NTRIP VRS operations.
+   * Fill a ROS NMEA GGA message especially designed to support NTRIP VRS operations.
    *
    * This message is limited to 80 chars and only sent at up to 1 Hz to maximize VRS
    * providers compatibility.
@@ -670,9 +736,10 @@ public:
    * WARNING: Don't use this GGA message for navigation purposes as the accuracy is limited.
    *
    * \param[in] ref_log_gps_pos     SBG GPS Position log.
-   * \return                        ROS NMEA GGA message.
+   * \param[out] ref_nmea_gga_msg   ROS NMEA GGA message.
+   * \return                        True if a GGA message has been generated.
    */
-  const nmea_msgs::msg::Sentence createNmeaGGAMessageForNtrip(const SbgEComLogGnssPos& ref_log_gps_pos) const;
+  bool fillNmeaGGAMessageForNtrip(const SbgEComLogGnssPos& ref_log_gps_pos, nmea_msgs::msg::Sentence &ref_nmea_gga_msg) const;
 };
 }
 
@@ -0,0 +1,135 @@
+/*!
+*  \file         sbg_autobaud.h
+*  \author       SBG Systems
+*  \date         16/10/2026
+*
+*  \brief        Detect the baud rate of a device from its output stream.
+*
+*  The serial port listens briefly at each candidate baud rate, and counts
+*  the sbgECom frames with valid sync bytes, end byte and CRC. Nothing is
+*  sent to the device, so a device streaming logs is found in a few frame
+*  periods instead of a command time out per candidate.
+*
+*  \section CodeCopyright Copyright Notice
+*  MIT License
+*
+*  Copyright (c) 2023 SBG Systems
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+#ifndef SBG_ROS_AUTOBAUD_H
+#define SBG_ROS_AUTOBAUD_H
+
+// Standard headers
+#include <cstdint>
+#include <vector>
+
+// SbgECom headers
+#include <sbgEComLib.h>
+
+namespace sbg
+{
+/*!
+ * Passive baud rate detection.
+ *
+ * At a wrong baud rate, a streaming device still produces bytes, but no valid frame. A silent
+ * line at the first candidate means the device doesn't stream logs, the detection then stops
+ * so that the caller falls back to command probing.
+ */
+class SbgAutobaud
+{
+public:
+
+  /*!
+   * Result of the detection.
+   */
+  enum class Result
+  {
+    DETECTED,                                 /*!< A baud rate has been detected. */
+    SILENT,                                   /*!< The device doesn't output any data. */
+    NOT_FOUND                                 /*!< Data has been received, but at none of the candidate baud rates. */
+  };
+
+private:
+
+  //---------------------------------------------------------------------//
+  //- Private variables                                                 -//
+  //---------------------------------------------------------------------//
+
+  SbgInterface&                             ref_interface_;
+  uint32_t                                  listen_time_ms_;
+  std::vector<uint8_t>                      buffer_;
+
+  //---------------------------------------------------------------------//
+  //- Private  methods                                                  -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Count the valid frames in a buffer.
+   *
+   * \param[in]  p_buffer           Buffer.
+   * \param[in]  size               Buffer size, in bytes.
+   * \param[out] ref_consumed       Number of bytes that have been scanned, the remaining bytes may start a frame.
+   * \return                        Number of valid frames.
+   */
+  static uint32_t countValidFrames(const uint8_t *p_buffer, size_t size, size_t &ref_consumed);
+
+  /*!
+   * Listen to the interface at a baud rate.
+   *
+   * \param[in]  baud_rate          Baud rate, in bps.
+   * \param[out] ref_nr_bytes       Number of bytes received.
+   * \return                        Number of valid frames received.
+   */
+  uint32_t listen(uint32_t baud_rate, size_t &ref_nr_bytes);
+
+public:
+
+  //---------------------------------------------------------------------//
+  //- Constructor                                                       -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Constructor.
+   *
+   * \param[in] ref_interface       Serial interface, its baud rate is changed during the detection.
+   * \param[in] listen_time_ms      Maximum time spent listening at each baud rate, in ms.
+   */
+  SbgAutobaud(SbgInterface &ref_interface, uint32_t listen_time_ms);
+
+  //---------------------------------------------------------------------//
+  //- Operations                                                        -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Detect the device baud rate.
+   *
+   * Candidates are tried in order, the most likely first. Once detected, the interface is left at
+   * the detected baud rate.
+   *
+   * \param[in]  ref_baud_rates     Candidate baud rates, in bps.
+   * \param[out] ref_baud_rate      Detected baud rate, in bps.
+   * \return                        Detection result.
+   */
+  Result detect(const std::vector<uint32_t> &ref_baud_rates, uint32_t &ref_baud_rate);
+};
+}
+
+#endif // SBG_ROS_AUTOBAUD_H
@@ -0,0 +1,189 @@
+/*!
+*  \file         sbg_clock_sync.h
+*  \author       SBG Systems
+*  \date         16/10/2026
+*
+*  \brief        Estimate the host time of device time stamps.
+*
+*  The device stamps its logs with a 32 bits microsecond counter, and the
+*  host stamps the frames carrying them when they are read. The reading delay
+*  is always positive and mostly jitter, so the lower envelope of the arrival
+*  times, fitted against the device time, gives the offset and drift between
+*  both clocks without the host jitter.
+*
+*  \section CodeCopyright Copyright Notice
+*  MIT License
+*
+*  Copyright (c) 2023 SBG Systems
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+#ifndef SBG_ROS_CLOCK_SYNC_H
+#define SBG_ROS_CLOCK_SYNC_H
+
+// Standard headers
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sbg
+{
+/*!
+ * Device to host clock synchronization.
+ *
+ * Arrival times are measured on the host monotonic clock, so that host clock adjustments don't
+ * disturb the fit. The earliest arrival of each one second window is kept, and the host time is
+ * fitted as a line of the device time over the last windows. Between fits, an arrival earlier than
+ * the line lowers it at once.
+ *
+ * Estimated times are converted to the host real time clock with the offset measured along with
+ * the last arrival time.
+ */
+class SbgClockSync
+{
+private:
+
+  /*!
+   * Device time stamp and arrival time of a log.
+   */
+  struct Sample
+  {
+    int64_t                                 device_time_us;           /*!< Unwrapped device time, in us. */
+    int64_t                                 host_time_ns;             /*!< Host monotonic time, in ns. */
+  };
+
+  //---------------------------------------------------------------------//
+  //- Private variables                                                 -//
+  //---------------------------------------------------------------------//
+
+  bool                                      started_;
+  uint32_t                                  last_timestamp_;
+  int64_t                                   device_time_us_;
+
+  int64_t                                   origin_device_time_us_;
+  int64_t                                   origin_host_time_ns_;
+  int64_t                                   origin_real_time_ns_;
+  int64_t                                   real_time_offset_ns_;
+  double                                    rate_;
+
+  Sample                                    window_min_;
+  int64_t                                   window_min_residual_ns_;
+  int64_t                                   window_start_device_time_us_;
+  std::vector<Sample>                       window_mins_;
+  size_t                                    nr_window_mins_;
+  size_t                                    window_index_;
+
+  //---------------------------------------------------------------------//
+  //- Private  methods                                                  -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Unwrap a device time stamp relative to the most recent one.
+   *
+   * \param[in] timestamp           Device time stamp, in us.
+   * \return                        Unwrapped device time, in us.
+   */
+  int64_t unwrapTimestamp(uint32_t timestamp) const;
+
+  /*!
+   * Get the host monotonic time of a device time, from the current fit.
+   *
+   * \param[in] device_time_us      Unwrapped device time, in us.
+   * \return                        Host monotonic time, in ns.
+   */
+  int64_t toHostMonotonicTime(int64_t device_time_us) const;
+
+  /*!
+   * Restart the synchronization from a sample.
+   *
+   * \param[in] ref_sample          First sample.
+   */
+  void restart(const Sample &ref_sample);
+
+  /*!
+   * Set the origin of the fit, in device and host times.
+   *
+   * \param[in] device_time_us      Unwrapped device time, in us.
+   * \param[in] host_time_ns        Host monotonic time, in ns.
+   */
+  void setOrigin(int64_t device_time_us, int64_t host_time_ns);
+
+  /*!
+   * Fit the host time against the device time, over the earliest arrivals of the last windows.
+   */
+  void fit();
+
+public:
+
+  //---------------------------------------------------------------------//
+  //- Constructor                                                       -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Default constructor.
+   */
+  SbgClockSync();
+
+  //---------------------------------------------------------------------//
+  //- Parameters                                                        -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Check if the synchronization can estimate host times.
+   *
+   * \return                        True once a full window of arrivals has been fitted.
+   */
+  bool isValid() const;
+
+  /*!
+   * Get the drift of the device clock relative to the host clock.
+   *
+   * \return                        Drift, in ppm, positive if the device clock is slower.
+   */
+  double getDrift() const;
+
+  //---------------------------------------------------------------------//
+  //- Operations                                                        -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Add the arrival time of a log.
+   *
+   * A device time stamp away from the fit by more than half a second, after a device reset or a
+   * reconnection, restarts the synchronization.
+   *
+   * \param[in] timestamp           Device time stamp of the log, in us.
+   * \param[in] monotonic_time_ns   Host monotonic time at which the log has been received, in ns.
+   * \param[in] real_time_ns        Host real time at which the log has been received, in ns since the Unix epoch.
+   * \return                        True if the synchronization has been restarted.
+   */
+  bool update(uint32_t timestamp, int64_t monotonic_time_ns, int64_t real_time_ns);
+
+  /*!
+   * Get the host real time of a device time stamp.
+   *
+   * \param[in] timestamp           Device time stamp, in us.
+   * \return                        Host real time, in ns since the Unix epoch.
+   */
+  int64_t toHostTime(uint32_t timestamp) const;
+};
+}
+
+#endif // SBG_ROS_CLOCK_SYNC_H
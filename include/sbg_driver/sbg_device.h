@@ -33,19 +33,31 @@
 #define SBG_ROS_SBG_DEVICE_H
 
 // Standard headers
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 // ROS headers
 #include <std_srvs/srv/set_bool.hpp>
 #include <std_srvs/srv/trigger.hpp>
+#include <rosgraph_msgs/msg/clock.hpp>
 #include <rtcm_msgs/msg/message.hpp>
 
 // Project headers
 #include <config_applier.h>
+#include <config_cache.h>
 #include <config_store.h>
 #include <message_publisher.h>
+#include <sbg_autobaud.h>
+#include <sbg_replay_scheduler.h>
+#include <sbg_spsc_ring.h>
 
 namespace sbg
 {
@@ -56,6 +68,17 @@ class SbgDevice
 {
 private:
 
+  /*!
+   * Log received by the reader thread.
+   */
+  struct ReceivedLog
+  {
+    SbgEComClass                msg_class;
+    SbgEComMsgId                msg_id;
+    SbgEComLogUnion             log_data;
+    SbgInterfaceTimestamp       arrival_time;
+  };
+
   //---------------------------------------------------------------------//
   //- Static members definition                                         -//
   //---------------------------------------------------------------------//
@@ -74,6 +97,8 @@ private:
   rclcpp::Node&                                             ref_node_;
   MessagePublisher                                          message_publisher_;
   ConfigStore                                               config_store_;
+  uint32_t                                                  serial_number_;
+  uint32_t                                                  serial_baud_rate_;
 
   uint32_t                                                  rate_frequency_;
 
@@ -85,7 +110,34 @@ private:
 
   rclcpp::Subscription<rtcm_msgs::msg::Message>::SharedPtr  rtcm_sub_;
 
-  uint32_t                                                  log_replay_last_timestamp_;
+  std::mutex                                                replay_mutex_;
+  SbgReplayScheduler                                        replay_scheduler_;
+  ReceivedLog                                               replay_log_;
+  bool                                                      replay_log_pending_;
+  bool                                                      replay_ended_;
+  rclcpp::Service<std_srvs::srv::SetBool>::SharedPtr        replay_pause_service_;
+  rclcpp::Service<std_srvs::srv::Trigger>::SharedPtr        replay_step_service_;
+  rclcpp::Publisher<rosgraph_msgs::msg::Clock>::SharedPtr   clock_pub_;
+
+  std::vector<SbgEComLogBatchEntry>                         log_batch_;
+
+  bool                                                      use_reader_thread_;
+  std::thread                                               reader_thread_;
+  std::atomic<bool>                                         reader_running_;
+  std::unique_ptr<SbgSpscRing<ReceivedLog>>                 log_queue_;
+  std::mutex                                                log_queue_mutex_;
+  std::condition_variable                                   log_queue_cv_;
+  uint64_t                                                  log_queue_reported_drops_;
+  uint32_t                                                  interface_reported_drops_;
+
+  std::mutex                                                interface_mutex_;
+  uint32_t                                                  link_timeout_ms_;
+  uint64_t                                                  last_nr_frames_;
+  std::chrono::steady_clock::time_point                     last_frame_time_;
+  bool                                                      link_lost_;
+  std::chrono::steady_clock::time_point                     link_lost_time_;
+  std::chrono::steady_clock::time_point                     link_retry_time_;
+  uint32_t                                                  link_retry_delay_ms_;
 
   //---------------------------------------------------------------------//
   //- Private  methods                                                  -//
@@ -98,10 +150,11 @@ private:
    *  \param[in]  msg_class       Class of the message we have received
    *  \param[in]  msg             Message ID of the log received.
    *  \param[in]  p_log_data      Contains the received log data as an union.
+   *  \param[in]  p_arrival_time  Host reception time of the log.
    *  \param[in]  p_user_arg      Optional user supplied argument.
    *  \return                     SBG_NO_ERROR if the received log has been used successfully.
    */
-  static SbgErrorCode onLogReceivedCallback(SbgEComHandle* p_handle, SbgEComClass msg_class, SbgEComMsgId msg, const SbgEComLogUnion* p_log_data, void* p_user_arg);
+  static SbgErrorCode onLogReceivedCallback(SbgEComHandle* p_handle, SbgEComClass msg_class, SbgEComMsgId msg, const SbgEComLogUnion* p_log_data, const SbgInterfaceTimestamp* p_arrival_time, void* p_user_arg);
 
   /*!
    * Function to handle the received log.
@@ -109,8 +162,27 @@ private:
    * \param[in]  msg_class        Class of the message we have received
    * \param[in]  msg              Message ID of the log received.
    * \param[in]  ref_sbg_data     Contains the received log data as an union.
+   * \param[in]  ref_arrival_time Host reception time of the log, null clocks if unknown.
+   */
+  void onLogReceived(SbgEComClass msg_class, SbgEComMsgId msg, const SbgEComLogUnion& ref_sbg_data, const SbgInterfaceTimestamp& ref_arrival_time);
+
+  /*!
+   *  Callback definition called each time a batch of logs is received.
+   *
+   *  \param[in]  p_handle        Valid handle on the sbgECom instance that has called this callback.
+   *  \param[in]  p_entries       Decoded logs, in arrival order.
+   *  \param[in]  nr_entries      Number of decoded logs.
+   *  \param[in]  p_user_arg      Optional user supplied argument.
+   */
+  static void onLogBatchReceivedCallback(SbgEComHandle* p_handle, const SbgEComLogBatchEntry* p_entries, size_t nr_entries, void* p_user_arg);
+
+  /*!
+   * Function to handle a batch of received logs.
+   *
+   * \param[in]  p_entries        Decoded logs, in arrival order.
+   * \param[in]  nr_entries       Number of decoded logs.
    */
-  void onLogReceived(SbgEComClass msg_class, SbgEComMsgId msg, const SbgEComLogUnion& ref_sbg_data);
+  void onLogBatchReceived(const SbgEComLogBatchEntry* p_entries, size_t nr_entries);
 
   /*!
    * Load the parameters.
@@ -132,7 +204,23 @@ private:
   SbgErrorCode readDeviceInfo();
 
   /*!
-   * Find the baudrate currently configured on the device.
+   * Get the baud rates at which the device may be found, the most likely first.
+   *
+   * \return                      Candidate baud rates, in bps.
+   */
+  std::vector<uint32_t> getCandidateBaudRates() const;
+
+  /*!
+   * Detect the device baud rate by listening to its output stream.
+   *
+   * If no baud rate is detected, the serial interface is set back to the configured baud rate.
+   *
+   * \return                      Detection result.
+   */
+  SbgAutobaud::Result detectBaudRate();
+
+  /*!
+   * Find the baudrate currently configured on the device, by sending a command at each fallback baudrate.
    *
    * \return                      SBG_NO_ERROR if the current device baudrate was found.
    * \throw                       Unable to read the device information.
@@ -154,11 +242,136 @@ private:
    */
   std::string getVersionAsString(uint32_t sbg_version_enc) const;
 
+  /*!
+   * Start the thread reading the device, if enabled.
+   */
+  void startReaderThread();
+
+  /*!
+   * Stop the thread reading the device, if running.
+   */
+  void stopReaderThread();
+
+  /*!
+   * Reader thread main loop.
+   *
+   * Read and decode the incoming logs, and push them into the log queue.
+   */
+  void readerThreadLoop();
+
+  /*!
+   * Publish all the logs held by the log queue.
+   */
+  void drainLogQueue();
+
+  /*!
+   * Wait until the device interface becomes readable.
+   *
+   * \param[in] timeout_ms        Maximum time to wait, in milliseconds.
+   * \return                      False if the interface can't be waited on.
+   */
+  bool waitForDeviceData(uint32_t timeout_ms);
+
+  /*!
+   * Initialize the log file replay: scheduler settings, services and clock publisher.
+   */
+  void initReplay();
+
+  /*!
+   * Publish the replayed logs that are due.
+   *
+   * Logs are read one at a time from the file, so that reading never gets ahead of the schedule.
+   */
+  void handleReplay();
+
+  /*!
+   * Get the delay until the next replayed log is due.
+   *
+   * \param[in] timeout_ms        Delay returned if no log is pending, in milliseconds.
+   * \return                      Delay until the next log is due.
+   */
+  std::chrono::nanoseconds getReplayDelay(uint32_t timeout_ms);
+
+  /*!
+   * Pause or resume the log file replay.
+   *
+   * \param[in] ref_ros_request   ROS service request, true to pause the replay.
+   * \param[in] ref_ros_response  ROS service response.
+   * \return                      Always true.
+   */
+  bool processReplayPause(const std::shared_ptr<std_srvs::srv::SetBool::Request> ref_ros_request, std::shared_ptr<std_srvs::srv::SetBool::Response> ref_ros_response);
+
+  /*!
+   * Replay a single log while the replay is paused.
+   *
+   * \param[in] ref_ros_request   ROS service request.
+   * \param[in] ref_ros_response  ROS service response.
+   * \return                      Always true.
+   */
+  bool processReplayStep(const std::shared_ptr<std_srvs::srv::Trigger::Request> ref_ros_request, std::shared_ptr<std_srvs::srv::Trigger::Response> ref_ros_response);
+
+  /*!
+   * Warn if the interface reports data dropped by the operating system.
+   *
+   * Must be called from the thread reading the device.
+   */
+  void reportInterfaceDrops();
+
+  /*!
+   * Apply the UDP socket settings from the config store.
+   */
+  void configureUdpInterface();
+
+  /*!
+   * Create the serial interface with the settings from the config store.
+   *
+   * \param[in] baud_rate         Baud rate, in bps.
+   * \return                      SBG_NO_ERROR if the interface has been created.
+   */
+  SbgErrorCode createSerialInterface(uint32_t baud_rate);
+
+  /*!
+   * Get the period of the fastest periodic log output from the config store.
+   *
+   * \return                      Output period, in ms, 0 if no log is periodically output.
+   */
+  uint32_t getFastestOutputPeriod() const;
+
+  /*!
+   * Initialize the link watchdog.
+   *
+   * The time out is derived from the outputs only if the driver configures the device, otherwise
+   * the outputs actually enabled on the device are unknown and a fixed time out is used.
+   */
+  void initLinkWatchdog();
+
+  /*!
+   * Check that logs are still received from the device, and recover the link once lost.
+   *
+   * The interface doesn't report read errors, a lost link is detected when no valid frame has been
+   * received for the watchdog time out. Must be called from the thread reading the device.
+   */
+  void checkLink();
+
+  /*!
+   * Close and reopen the communication interface, with the settings used to connect.
+   *
+   * The sbgECom handle is kept, it refers to the interface by address.
+   *
+   * \return                      SBG_NO_ERROR if the interface has been reopened.
+   */
+  SbgErrorCode reopenInterface();
+
   /*!
    * Initialize the publishers according to the configuration.
    */
   void initPublishers();
 
+  /*!
+   * Register the decoders of the logs to publish, any other log is discarded before being decoded.
+   */
+  void initLogDecoders();
+
   /*!
    * Initialize the subscribers according to the configuration.
    */
@@ -278,6 +491,17 @@ public:
    * Periodic handle of the connected SBG device.
    */
   void periodicHandle();
+
+  /*!
+   * Wait until data is received from the connected SBG device.
+   *
+   * If the device is read from a dedicated thread, wait until logs are queued for publishing.
+   * If a log file is replayed, wait until the next log is due.
+   *
+   * \param[in] timeout_ms        Maximum time to wait, in milliseconds.
+   * \return                      False if the interface can't be waited on, the caller has to poll it instead.
+   */
+  bool waitForData(uint32_t timeout_ms);
 };
 }
 
@@ -0,0 +1,99 @@
+/*!
+*  \file         sbg_device_component.h
+*  \author       SBG Systems
+*  \date         16/10/2026
+*
+*  \brief        Composable node handling a connected SBG device.
+*
+*  The component runs the device loop of the sbg_device executable in its own
+*  thread, while the container executor processes the services and the
+*  subscriptions. Loaded with intra-process communications enabled, messages
+*  are delivered to the other components of the container without being
+*  serialized.
+*
+*  \section CodeCopyright Copyright Notice
+*  MIT License
+*
+*  Copyright (c) 2023 SBG Systems
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+#ifndef SBG_ROS_SBG_DEVICE_COMPONENT_H
+#define SBG_ROS_SBG_DEVICE_COMPONENT_H
+
+// Standard headers
+#include <atomic>
+#include <memory>
+#include <thread>
+
+// ROS headers
+#include <rclcpp/rclcpp.hpp>
+
+// Project headers
+#include <sbg_device.h>
+
+namespace sbg
+{
+/*!
+ * Composable node handling a connected SBG device.
+ */
+class SbgDeviceComponent : public rclcpp::Node
+{
+private:
+
+  //---------------------------------------------------------------------//
+  //- Private variables                                                 -//
+  //---------------------------------------------------------------------//
+
+  std::unique_ptr<SbgDevice>                                sbg_device_;
+  std::thread                                               device_thread_;
+  std::atomic<bool>                                         device_running_;
+
+  //---------------------------------------------------------------------//
+  //- Private  methods                                                  -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Read the device and publish the received logs until the component is destroyed.
+   */
+  void deviceLoop();
+
+public:
+
+  //---------------------------------------------------------------------//
+  //- Constructor                                                       -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Constructor, connect to the device and start publishing.
+   *
+   * \param[in] ref_options       Node options, set by the component container.
+   * \throw                       Unable to initialize the SBG device.
+   */
+  explicit SbgDeviceComponent(const rclcpp::NodeOptions &ref_options);
+
+  /*!
+   * Destructor, stop publishing and close the device.
+   */
+  ~SbgDeviceComponent();
+};
+}
+
+#endif // SBG_ROS_SBG_DEVICE_COMPONENT_H
@@ -0,0 +1,198 @@
+/*!
+*  \file         sbg_log_traits.h
+*  \author       SBG Systems
+*  \date         16/10/2026
+*
+*  \brief        Compile-time description of the published SBG logs.
+*
+*  Each published log binds its SbgEComLogUnion member, its SBG-ROS message
+*  type, the MessageWrapper method filling the message and its output topic.
+*  The message publisher generates its dispatch table from these traits, so
+*  publishing a new log only requires a new SBG_LOG_TRAITS line.
+*
+*  \section CodeCopyright Copyright Notice
+*  MIT License
+*
+*  Copyright (c) 2023 SBG Systems
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+#ifndef SBG_ROS_LOG_TRAITS_H
+#define SBG_ROS_LOG_TRAITS_H
+
+// Project headers
+#include <message_wrapper.h>
+
+namespace sbg
+{
+/*!
+ * Traits of a SBG log of the ECOM_0 class.
+ *
+ * Logs without specialization are not published.
+ */
+template <SbgEComMsgId MsgId>
+struct SbgLogTraits
+{
+  static constexpr bool is_published = false;
+};
+
+/*!
+ * Define the traits of a published SBG log.
+ *
+ * \param[in] msg_id              SBG message ID.
+ * \param[in] message_type        SBG-ROS message type.
+ * \param[in] log_member          SbgEComLogUnion member holding the log.
+ * \param[in] fill_method         MessageWrapper method filling the message from the log.
+ * \param[in] topic_name          Output topic name.
+ */
+#define SBG_LOG_TRAITS(msg_id, message_type, log_member, fill_method, topic_name)                                        \
+  template <>                                                                                                            \
+  struct SbgLogTraits<msg_id>                                                                                            \
+  {                                                                                                                      \
+    using MessageType = message_type;                                                                                    \
+                                                                                                                         \
+    static constexpr bool         is_published  = true;                                                                  \
+    static constexpr SbgEComMsgId publisher_id  = msg_id;                                                                \
+                                                                                                                         \
+    static const char *getTopicName()                                                                                    \
+    {                                                                                                                    \
+      return topic_name;                                                                                                 \
+    }                                                                                                                    \
+                                                                                                                         \
+    static void fill(MessageWrapper &ref_message_wrapper, const SbgEComLogUnion &ref_sbg_log, MessageType &ref_message)  \
+    {                                                                                                                    \
+      ref_message_wrapper.fill_method(ref_sbg_log.log_member, ref_message);                                              \
+    }                                                                                                                    \
+  }
+
+/*!
+ * Define the traits of a SBG log published with the publisher of another log.
+ *
+ * \param[in] msg_id              SBG message ID.
+ * \param[in] base_msg_id         SBG message ID owning the publisher.
+ */
+#define SBG_LOG_TRAITS_ALIAS(msg_id, base_msg_id)                                                                        \
+  template <>                                                                                                            \
+  struct SbgLogTraits<msg_id> : SbgLogTraits<base_msg_id>                                                                \
+  {                                                                                                                      \
+  }
+
+SBG_LOG_TRAITS(SBG_ECOM_LOG_STATUS,             sbg_driver::msg::SbgStatus,       statusData,     fillSbgStatusMessage,       "sbg/status");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_UTC_TIME,           sbg_driver::msg::SbgUtcTime,      utcData,        fillSbgUtcTimeMessage,      "sbg/utc_time");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_IMU_DATA,           sbg_driver::msg::SbgImuData,      imuData,        fillSbgImuDataMessage,      "sbg/imu_data");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_MAG,                sbg_driver::msg::SbgMag,          magData,        fillSbgMagMessage,          "sbg/mag");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_MAG_CALIB,          sbg_driver::msg::SbgMagCalib,     magCalibData,   fillSbgMagCalibMessage,     "sbg/mag_calib");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_EKF_EULER,          sbg_driver::msg::SbgEkfEuler,     ekfEulerData,   fillSbgEkfEulerMessage,     "sbg/ekf_euler");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_EKF_QUAT,           sbg_driver::msg::SbgEkfQuat,      ekfQuatData,    fillSbgEkfQuatMessage,      "sbg/ekf_quat");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_EKF_NAV,            sbg_driver::msg::SbgEkfNav,       ekfNavData,     fillSbgEkfNavMessage,       "sbg/ekf_nav");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_EKF_VEL_BODY,       sbg_driver::msg::SbgEkfVelBody,   ekfVelBody,     fillSbgEkfVelBodyMessage,   "sbg/ekf_vel_body");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_EKF_ROT_ACCEL_BODY, sbg_driver::msg::SbgEkfRotAccel,  ekfRotAccel,    fillSbgEkfRotAccelMessage,  "sbg/ekf_rot_accel_body");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_EKF_ROT_ACCEL_NED,  sbg_driver::msg::SbgEkfRotAccel,  ekfRotAccel,    fillSbgEkfRotAccelMessage,  "sbg/ekf_rot_accel_ned");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_SHIP_MOTION,        sbg_driver::msg::SbgShipMotion,   shipMotionData, fillSbgShipMotionMessage,   "sbg/ship_motion");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_GPS1_VEL,           sbg_driver::msg::SbgGpsVel,       gpsVelData,     fillSbgGpsVelMessage,       "sbg/gps_vel");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_GPS1_POS,           sbg_driver::msg::SbgGpsPos,       gpsPosData,     fillSbgGpsPosMessage,       "sbg/gps_pos");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_GPS1_HDT,           sbg_driver::msg::SbgGpsHdt,       gpsHdtData,     fillSbgGpsHdtMessage,       "sbg/gps_hdt");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_GPS1_RAW,           sbg_driver::msg::SbgGpsRaw,       gpsRawData,     fillSbgGpsRawMessage,       "sbg/gps_raw");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_ODO_VEL,            sbg_driver::msg::SbgOdoVel,       odometerData,   fillSbgOdoVelMessage,       "sbg/odo_vel");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_EVENT_A,            sbg_driver::msg::SbgEvent,        eventMarker,    fillSbgEventMessage,        "sbg/eventA");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_EVENT_B,            sbg_driver::msg::SbgEvent,        eventMarker,    fillSbgEventMessage,        "sbg/eventB");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_EVENT_C,            sbg_driver::msg::SbgEvent,        eventMarker,    fillSbgEventMessage,        "sbg/eventC");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_EVENT_D,            sbg_driver::msg::SbgEvent,        eventMarker,    fillSbgEventMessage,        "sbg/eventD");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_EVENT_E,            sbg_driver::msg::SbgEvent,        eventMarker,    fillSbgEventMessage,        "sbg/eventE");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_AIR_DATA,           sbg_driver::msg::SbgAirData,      airData,        fillSbgAirDataMessage,      "sbg/air_data");
+SBG_LOG_TRAITS(SBG_ECOM_LOG_IMU_SHORT,          sbg_driver::msg::SbgImuShort,     imuShort,       fillSbgImuShortMessage,     "sbg/imu_short");
+
+//
+// Logs of the secondary GNSS receiver are published on the topics of the primary receiver.
+//
+SBG_LOG_TRAITS_ALIAS(SBG_ECOM_LOG_GPS2_VEL, SBG_ECOM_LOG_GPS1_VEL);
+SBG_LOG_TRAITS_ALIAS(SBG_ECOM_LOG_GPS2_POS, SBG_ECOM_LOG_GPS1_POS);
+SBG_LOG_TRAITS_ALIAS(SBG_ECOM_LOG_GPS2_HDT, SBG_ECOM_LOG_GPS1_HDT);
+SBG_LOG_TRAITS_ALIAS(SBG_ECOM_LOG_GPS2_RAW, SBG_ECOM_LOG_GPS1_RAW);
+
+/*!
+ * Time stamp of a SBG log of the ECOM_0 class.
+ *
+ * Logs without specialization have no time stamp, such as raw GNSS and RTCM data.
+ */
+template <SbgEComMsgId MsgId>
+struct SbgLogTimestamp
+{
+  static constexpr bool has_timestamp = false;
+};
+
+/*!
+ * Define the time stamp of a SBG log.
+ *
+ * \param[in] msg_id              SBG message ID.
+ * \param[in] log_member          SbgEComLogUnion member holding the log.
+ * \param[in] timestamp_member    Log member holding the time stamp, in us.
+ */
+#define SBG_LOG_TIMESTAMP(msg_id, log_member, timestamp_member)                                                          \
+  template <>                                                                                                            \
+  struct SbgLogTimestamp<msg_id>                                                                                         \
+  {                                                                                                                      \
+    static constexpr bool has_timestamp = true;                                                                          \
+                                                                                                                         \
+    static uint32_t get(const SbgEComLogUnion &ref_sbg_log)                                                              \
+    {                                                                                                                    \
+      return ref_sbg_log.log_member.timestamp_member;                                                                    \
+    }                                                                                                                    \
+  }
+
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_STATUS,              statusData,     timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_UTC_TIME,            utcData,        timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_IMU_DATA,            imuData,        timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_MAG,                 magData,        timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_MAG_CALIB,           magCalibData,   timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_EKF_EULER,           ekfEulerData,   timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_EKF_QUAT,            ekfQuatData,    timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_EKF_NAV,             ekfNavData,     timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_EKF_VEL_BODY,        ekfVelBody,     timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_EKF_ROT_ACCEL_BODY,  ekfRotAccel,    timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_EKF_ROT_ACCEL_NED,   ekfRotAccel,    timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_SHIP_MOTION,         shipMotionData, timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_SHIP_MOTION_HP,      shipMotionData, timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_GPS1_VEL,            gpsVelData,     timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_GPS2_VEL,            gpsVelData,     timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_GPS1_POS,            gpsPosData,     timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_GPS2_POS,            gpsPosData,     timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_GPS1_HDT,            gpsHdtData,     timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_GPS2_HDT,            gpsHdtData,     timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_GPS1_SAT,            satGroupData,   timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_GPS2_SAT,            satGroupData,   timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_ODO_VEL,             odometerData,   timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_EVENT_A,             eventMarker,    timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_EVENT_B,             eventMarker,    timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_EVENT_C,             eventMarker,    timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_EVENT_D,             eventMarker,    timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_EVENT_E,             eventMarker,    timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_EVENT_OUT_A,         eventMarker,    timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_EVENT_OUT_B,         eventMarker,    timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_DVL_BOTTOM_TRACK,    dvlData,        timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_DVL_WATER_TRACK,     dvlData,        timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_AIR_DATA,            airData,        timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_USBL,                usblData,       timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_IMU_SHORT,           imuShort,       timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_DEPTH,               depthData,      timeStamp);
+SBG_LOG_TIMESTAMP(SBG_ECOM_LOG_DIAG,                diagData,       timestamp);
+}
+
+#endif // SBG_ROS_LOG_TRAITS_H
@@ -0,0 +1,190 @@
+/*!
+*  \file         sbg_replay_scheduler.h
+*  \author       SBG Systems
+*  \date         16/10/2026
+*
+*  \brief        Schedule the publication of logs replayed from a file.
+*
+*  Logs are published at absolute deadlines derived from their device
+*  time stamps, so the replay neither drifts with the processing time nor
+*  depends on the host load. The replay can run in real time, scaled by a
+*  rate factor, as fast as possible, or be paused and stepped log by log.
+*
+*  \section CodeCopyright Copyright Notice
+*  MIT License
+*
+*  Copyright (c) 2023 SBG Systems
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+#ifndef SBG_ROS_REPLAY_SCHEDULER_H
+#define SBG_ROS_REPLAY_SCHEDULER_H
+
+// Standard headers
+#include <chrono>
+#include <cstdint>
+
+// ROS headers
+#include <rclcpp/rclcpp.hpp>
+
+namespace sbg
+{
+/*!
+ * Replay scheduler.
+ *
+ * Device time stamps are 32 bits microsecond counters, they are unwrapped into a 64 bits device
+ * time. A log is due once the wall clock reaches the anchor wall time plus the device time elapsed
+ * since the anchor, divided by the replay rate. The anchor is reset when the replay is resumed or
+ * the rate changed, so that pauses and rate changes never cause a burst of late logs.
+ *
+ * The replay time is the wall time at which the replay started plus the device time elapsed since
+ * the first log. It is independent of the rate and is used to stamp the published messages.
+ */
+class SbgReplayScheduler
+{
+private:
+
+  //---------------------------------------------------------------------//
+  //- Private variables                                                 -//
+  //---------------------------------------------------------------------//
+
+  double                                    rate_;
+  bool                                      paused_;
+  uint32_t                                  nr_steps_;
+
+  bool                                      started_;
+  uint32_t                                  last_timestamp_;
+  int64_t                                   device_time_us_;
+  int64_t                                   start_device_time_us_;
+  rclcpp::Time                              start_time_;
+
+  bool                                      anchored_;
+  int64_t                                   anchor_device_time_us_;
+  std::chrono::steady_clock::time_point     anchor_wall_time_;
+
+  //---------------------------------------------------------------------//
+  //- Private  methods                                                  -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Check if a device time stamp is discontinuous with the most recent one.
+   *
+   * \param[in] timestamp           Device time stamp, in us.
+   * \return                        True if the time stamp jumped, after a device restart while recording.
+   */
+  bool isDiscontinuous(uint32_t timestamp) const;
+
+  /*!
+   * Unwrap a device time stamp relative to the most recent one.
+   *
+   * \param[in] timestamp           Device time stamp, in us.
+   * \return                        Device time, in us, the most recent device time if the time stamp is discontinuous.
+   */
+  int64_t unwrapTimestamp(uint32_t timestamp) const;
+
+  /*!
+   * Convert a device time to a replay time.
+   *
+   * \param[in] device_time_us      Device time, in us.
+   * \return                        Replay time.
+   */
+  rclcpp::Time toReplayTime(int64_t device_time_us) const;
+
+public:
+
+  //---------------------------------------------------------------------//
+  //- Constructor                                                       -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Default constructor, real time replay.
+   */
+  SbgReplayScheduler();
+
+  //---------------------------------------------------------------------//
+  //- Parameters                                                        -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Set the replay rate.
+   *
+   * \param[in] rate                Replay speed relative to real time, 0 to replay as fast as possible.
+   */
+  void setRate(double rate);
+
+  /*!
+   * Get the replay rate.
+   *
+   * \return                        Replay speed relative to real time, 0 if replayed as fast as possible.
+   */
+  double getRate() const;
+
+  /*!
+   * Pause or resume the replay.
+   *
+   * \param[in] paused              True to pause the replay.
+   */
+  void setPaused(bool paused);
+
+  /*!
+   * Check if the replay is paused.
+   *
+   * \return                        True if the replay is paused.
+   */
+  bool isPaused() const;
+
+  /*!
+   * Get the replay time of the most recent log.
+   *
+   * \return                        Replay time, zero if no log has been replayed yet.
+   */
+  rclcpp::Time getReplayTime() const;
+
+  //---------------------------------------------------------------------//
+  //- Operations                                                        -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Allow a single log to be replayed while paused.
+   */
+  void step();
+
+  /*!
+   * Get the delay until a log is due.
+   *
+   * Logs without time stamp are due immediately.
+   *
+   * \param[in] timestamp           Device time stamp of the log, in us, 0 if the log has no time stamp.
+   * \param[in] now                 Current wall time.
+   * \return                        Delay until the log is due, zero if due, maximum duration if paused.
+   */
+  std::chrono::nanoseconds getDelay(uint32_t timestamp, std::chrono::steady_clock::time_point now);
+
+  /*!
+   * Mark a due log as replayed.
+   *
+   * \param[in] timestamp           Device time stamp of the log, in us, 0 if the log has no time stamp.
+   * \return                        Replay time of the log.
+   */
+  rclcpp::Time consume(uint32_t timestamp);
+};
+}
+
+#endif // SBG_ROS_REPLAY_SCHEDULER_H
@@ -102,6 +102,16 @@ namespace sbg::helpers
    */
   bool isLeapYear(uint16_t year);
 
+  /*!
+   * Get the number of days elapsed since the Unix epoch (1 Jan 1970).
+   *
+   * \param[in] year                    Year.
+   * \param[in] month_index             Month index [1..12].
+   * \param[in] day                     Day of the month [1..31].
+   * \return                            Number of days since the epoch.
+   */
+  uint32_t getNumberOfDaysSinceEpoch(uint16_t year, uint8_t month_index, uint8_t day);
+
   /*!
    * Returns the GPS to UTC leap second offset: GPS_Time = UTC_Tme + utcOffset
    *
@@ -0,0 +1,201 @@
+/*!
+*  \file         sbg_spsc_ring.h
+*  \author       SBG Systems
+*  \date         16/10/2026
+*
+*  \brief        Bounded lock-free single producer / single consumer ring.
+*
+*  The ring is used to hand decoded logs over from the device reader thread
+*  to the publishing thread. When the consumer falls behind, the oldest
+*  entries are dropped so that the most recent data is always published.
+*
+*  \section CodeCopyright Copyright Notice
+*  MIT License
+*
+*  Copyright (c) 2023 SBG Systems
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+#ifndef SBG_ROS_SPSC_RING_H
+#define SBG_ROS_SPSC_RING_H
+
+// Standard headers
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sbg
+{
+/*!
+ * Bounded lock-free ring with a single producer thread and a single consumer thread.
+ *
+ * Indexes are free running counters. The read state holds the read index shifted by one bit, the
+ * lowest bit being set while the consumer copies the oldest entry out of the ring. The producer may
+ * only drop the oldest entry while this bit is cleared, so an entry is never overwritten while it
+ * is being read. In the rare case the ring is full while the consumer reads, the new entry is
+ * dropped instead.
+ *
+ * \template  T                           Entry type, copy assignable.
+ */
+template <class T>
+class SbgSpscRing
+{
+private:
+
+  //---------------------------------------------------------------------//
+  //- Private variables                                                 -//
+  //---------------------------------------------------------------------//
+
+  std::vector<T>                    entries_;
+
+  alignas(64) std::atomic<uint64_t> write_index_;
+  alignas(64) std::atomic<uint64_t> read_state_;
+  alignas(64) std::atomic<uint64_t> drop_count_;
+
+public:
+
+  //---------------------------------------------------------------------//
+  //- Constructor                                                       -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Constructor.
+   *
+   * \param[in] capacity              Maximum number of entries held by the ring.
+   */
+  explicit SbgSpscRing(size_t capacity):
+  entries_(capacity),
+  write_index_(0),
+  read_state_(0),
+  drop_count_(0)
+  {
+    assert(capacity > 0);
+  }
+
+  //---------------------------------------------------------------------//
+  //- Parameters                                                        -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Get the ring capacity.
+   *
+   * \return                          Maximum number of entries held by the ring.
+   */
+  size_t getCapacity() const
+  {
+    return entries_.size();
+  }
+
+  /*!
+   * Get the number of dropped entries.
+   *
+   * \return                          Number of entries dropped because the ring was full.
+   */
+  uint64_t getDropCount() const
+  {
+    return drop_count_.load(std::memory_order_relaxed);
+  }
+
+  /*!
+   * Check if the ring is empty.
+   *
+   * \return                          True if the ring holds no entry.
+   */
+  bool isEmpty() const
+  {
+    return (read_state_.load(std::memory_order_acquire) >> 1) == write_index_.load(std::memory_order_acquire);
+  }
+
+  //---------------------------------------------------------------------//
+  //- Operations                                                        -//
+  //---------------------------------------------------------------------//
+
+  /*!
+   * Push an entry, must only be called by the producer thread.
+   *
+   * If the ring is full, the oldest entry is dropped.
+   *
+   * \param[in] ref_entry             Entry to push.
+   * \return                          False if the entry itself has been dropped.
+   */
+  bool push(const T& ref_entry)
+  {
+    uint64_t write_index;
+    uint64_t read_state;
+
+    write_index = write_index_.load(std::memory_order_relaxed);
+    read_state  = read_state_.load(std::memory_order_acquire);
+
+    if ((write_index - (read_state >> 1)) >= entries_.size())
+    {
+      if (((read_state & 1) == 0) && read_state_.compare_exchange_strong(read_state, read_state + 2, std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+        drop_count_.fetch_add(1, std::memory_order_relaxed);
+      }
+      else if ((write_index - (read_state >> 1)) >= entries_.size())
+      {
+        //
+        // The consumer is reading the oldest entry, drop the new one.
+        //
+        drop_count_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+    }
+
+    entries_[write_index % entries_.size()] = ref_entry;
+    write_index_.store(write_index + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  /*!
+   * Pop the oldest entry, must only be called by the consumer thread.
+   *
+   * \param[out] ref_entry            Popped entry.
+   * \return                          False if the ring is empty.
+   */
+  bool pop(T& ref_entry)
+  {
+    uint64_t read_state;
+
+    read_state = read_state_.load(std::memory_order_acquire);
+
+    //
+    // Claim the oldest entry, the claim fails if the producer has dropped it meanwhile.
+    //
+    do
+    {
+      if ((read_state >> 1) == write_index_.load(std::memory_order_acquire))
+      {
+        return false;
+      }
+    } while (!read_state_.compare_exchange_weak(read_state, read_state | 1, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    ref_entry = entries_[(read_state >> 1) % entries_.size()];
+    read_state_.store(read_state + 2, std::memory_order_release);
+
+    return true;
+  }
+};
+}
+
+#endif // SBG_ROS_SPSC_RING_H
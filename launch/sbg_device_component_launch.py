@@ -0,0 +1,32 @@
+import os
+from ament_index_python.packages import get_package_share_directory
+from launch import LaunchDescription
+from launch_ros.actions import ComposableNodeContainer
+from launch_ros.descriptions import ComposableNode
+
+def generate_launch_description():
+	config = os.path.join(
+		get_package_share_directory('sbg_driver'),
+		'config',
+		'sbg_device_uart_default.yaml'
+	)
+
+	return LaunchDescription([
+		ComposableNodeContainer(
+			name = 'sbg_container',
+			namespace = '',
+			package = 'rclcpp_components',
+			executable = 'component_container',
+			output = 'screen',
+			composable_node_descriptions = [
+				ComposableNode(
+					package = 'sbg_driver',
+					plugin = 'sbg::SbgDeviceComponent',
+					name = 'sbg_device',
+					parameters = [config],
+					extra_arguments = [{'use_intra_process_comms': True}]
+				),
+				# Load the nodes consuming the driver topics here, with intra-process communications enabled.
+			]
+		)
+	])
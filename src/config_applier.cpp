@@ -1,6 +1,9 @@
 // File header
 #include <config_applier.h>
 
+// SbgECom headers
+#include <transfer/sbgEComTransfer.h>
+
 using sbg::ConfigApplier;
 
 /*!
@@ -346,63 +349,87 @@ void ConfigApplier::configureOdometerRejection(const SbgEComOdoRejectionConf& re
   }
 }
 
-void ConfigApplier::configureOutput(SbgEComOutputPort output_port, const ConfigStore::SbgLogOutput &ref_log_output)
+void ConfigApplier::configureOutputs(SbgEComOutputPort output_port, const std::vector<ConfigStore::SbgLogOutput> &ref_log_outputs)
 {
-  SbgErrorCode      error_code;
-  SbgEComOutputMode current_output_mode;
+  std::vector<SbgEComOutputConfEntry> output_confs;
+  std::vector<SbgEComOutputConfEntry> changed_output_confs;
 
   //
-  // Get the current output mode for the device and the selected log ID.
-  // If output modes are different, udpate the device mode with the one loaded from the parameters.
+  // Get the current output modes for the device and all the selected log IDs.
   //
-  error_code = sbgEComCmdOutputGetConf(&ref_sbg_com_handle_, output_port, ref_log_output.message_class, ref_log_output.message_id, &current_output_mode);
+  output_confs.reserve(ref_log_outputs.size());
 
-  if (error_code == SBG_INVALID_PARAMETER)
-  {
-    RCLCPP_WARN(rclcpp::get_logger("Config"), "SBG_DRIVER - [Config] Output is not available for this device : Class [%d] - Id [%d]", ref_log_output.message_class, ref_log_output.message_id);
-  }
-  else if (error_code != SBG_NO_ERROR)
+  for (const ConfigStore::SbgLogOutput &ref_log_output : ref_log_outputs)
   {
-    std::string error_message("[Config] Unable to get output for the device : Class [");
-    error_message.append(std::to_string(ref_log_output.message_class));
-    error_message.append("] - Id [");
-    error_message.append(std::to_string(ref_log_output.message_id));
-    error_message.append("] : ");
-    error_message.append(sbgErrorCodeToString(error_code));
+    SbgEComOutputConfEntry output_conf;
 
-    rclcpp::exceptions::throw_from_rcl_error(RMW_RET_ERROR, error_message);
+    output_conf.classId   = ref_log_output.message_class;
+    output_conf.msgId     = ref_log_output.message_id;
+    output_conf.mode      = SBG_ECOM_OUTPUT_MODE_DISABLED;
+    output_conf.errorCode = SBG_NO_ERROR;
+
+    output_confs.push_back(output_conf);
   }
-  else if (current_output_mode != ref_log_output.output_mode)
+
+  sbgEComCmdOutputGetConfs(&ref_sbg_com_handle_, output_port, output_confs.data(), output_confs.size());
+
+  //
+  // If output modes are different, udpate the device modes with the ones loaded from the parameters.
+  //
+  for (size_t i = 0; i < output_confs.size(); i++)
   {
-    error_code = sbgEComCmdOutputSetConf(&ref_sbg_com_handle_, output_port, ref_log_output.message_class, ref_log_output.message_id, ref_log_output.output_mode);
+    const SbgEComOutputConfEntry &ref_output_conf = output_confs[i];
 
-    if (error_code != SBG_NO_ERROR)
+    if (ref_output_conf.errorCode == SBG_INVALID_PARAMETER)
     {
-      std::string error_message("[Config] Unable to set the output configuration : Class[");
-      error_message.append(std::to_string(ref_log_output.message_class));
+      RCLCPP_WARN(rclcpp::get_logger("Config"), "SBG_DRIVER - [Config] Output is not available for this device : Class [%d] - Id [%d]", ref_output_conf.classId, ref_output_conf.msgId);
+    }
+    else if (ref_output_conf.errorCode != SBG_NO_ERROR)
+    {
+      std::string error_message("[Config] Unable to get output for the device : Class [");
+      error_message.append(std::to_string(ref_output_conf.classId));
       error_message.append("] - Id [");
-      error_message.append(std::to_string(ref_log_output.message_id));
+      error_message.append(std::to_string(ref_output_conf.msgId));
       error_message.append("] : ");
-      error_message.append(sbgErrorCodeToString(error_code));
+      error_message.append(sbgErrorCodeToString(ref_output_conf.errorCode));
 
       rclcpp::exceptions::throw_from_rcl_error(RMW_RET_ERROR, error_message);
     }
-    else
+    else if (ref_output_conf.mode != ref_log_outputs[i].output_mode)
     {
-      reboot_needed_ = true;
+      SbgEComOutputConfEntry changed_output_conf;
+
+      changed_output_conf       = ref_output_conf;
+      changed_output_conf.mode  = ref_log_outputs[i].output_mode;
+
+      changed_output_confs.push_back(changed_output_conf);
     }
   }
-}
 
-//---------------------------------------------------------------------//
-//- Parameters                                                        -//
-//---------------------------------------------------------------------//
+  if (!changed_output_confs.empty())
+  {
+    sbgEComCmdOutputSetConfs(&ref_sbg_com_handle_, output_port, changed_output_confs.data(), changed_output_confs.size());
 
-//---------------------------------------------------------------------//
-//- Operations                                                        -//
-//---------------------------------------------------------------------//
+    for (const SbgEComOutputConfEntry &ref_output_conf : changed_output_confs)
+    {
+      if (ref_output_conf.errorCode != SBG_NO_ERROR)
+      {
+        std::string error_message("[Config] Unable to set the output configuration : Class[");
+        error_message.append(std::to_string(ref_output_conf.classId));
+        error_message.append("] - Id [");
+        error_message.append(std::to_string(ref_output_conf.msgId));
+        error_message.append("] : ");
+        error_message.append(sbgErrorCodeToString(ref_output_conf.errorCode));
+
+        rclcpp::exceptions::throw_from_rcl_error(RMW_RET_ERROR, error_message);
+      }
+    }
 
-void ConfigApplier::applyConfiguration(const ConfigStore& ref_config_store)
+    reboot_needed_ = true;
+  }
+}
+
+void ConfigApplier::configureDevice(const ConfigStore& ref_config_store)
 {
   //
   // Configure the connected device.
@@ -423,11 +450,161 @@ void ConfigApplier::applyConfiguration(const ConfigStore& ref_config_store)
   //
   // Configure the output, with all output defined in the store.
   //
-  const std::vector<ConfigStore::SbgLogOutput>& ref_output_modes = ref_config_store.getOutputModes();
+  configureOutputs(ref_config_store.getOutputPort(), ref_config_store.getOutputModes());
+}
+
+uint64_t ConfigApplier::computeConfigurationHash(const ConfigStore& ref_config_store) const
+{
+  uint64_t hash;
+
+  //
+  // Structures are hashed field by field, as their padding bytes aren't initialized.
+  //
+  hash = ConfigCache::computeHash(nullptr, 0);
+
+  auto hash_value = [&hash](const auto& ref_value)
+  {
+    hash = ConfigCache::computeHash(&ref_value, sizeof(ref_value), hash);
+  };
+
+  const SbgEComInitConditionConf &ref_init_condition = ref_config_store.getInitialConditions();
+
+  hash_value(ref_init_condition.latitude);
+  hash_value(ref_init_condition.longitude);
+  hash_value(ref_init_condition.altitude);
+  hash_value(ref_init_condition.year);
+  hash_value(ref_init_condition.month);
+  hash_value(ref_init_condition.day);
+
+  hash_value(ref_config_store.getMotionProfile());
+
+  const SbgEComSensorAlignmentInfo &ref_sensor_align = ref_config_store.getSensorAlignement();
+
+  hash_value(ref_sensor_align.axisDirectionX);
+  hash_value(ref_sensor_align.axisDirectionY);
+  hash_value(ref_sensor_align.misRoll);
+  hash_value(ref_sensor_align.misPitch);
+  hash_value(ref_sensor_align.misYaw);
+
+  hash = ConfigCache::computeHash(ref_config_store.getSensorLeverArm().data(), 3 * sizeof(float), hash);
+
+  const SbgEComAidingAssignConf &ref_aiding_assign = ref_config_store.getAidingAssignement();
+
+  hash_value(ref_aiding_assign.gps1Port);
+  hash_value(ref_aiding_assign.gps1Sync);
+  hash_value(ref_aiding_assign.dvlPort);
+  hash_value(ref_aiding_assign.dvlSync);
+  hash_value(ref_aiding_assign.rtcmPort);
+  hash_value(ref_aiding_assign.airDataPort);
+  hash_value(ref_aiding_assign.odometerPinsConf);
+
+  hash_value(ref_config_store.getMagnetometerModel());
+  hash_value(ref_config_store.getMagnetometerRejection().magneticField);
+
+  hash_value(ref_config_store.getGnssModel());
+
+  const SbgEComGnssInstallation &ref_gnss_installation = ref_config_store.getGnssInstallation();
 
-  for (const ConfigStore::SbgLogOutput& ref_output : ref_output_modes)
+  hash_value(ref_gnss_installation.leverArmPrimary);
+  hash_value(ref_gnss_installation.leverArmPrimaryPrecise);
+  hash_value(ref_gnss_installation.leverArmSecondary);
+  hash_value(ref_gnss_installation.leverArmSecondaryMode);
+
+  const SbgEComGnssRejectionConf &ref_gnss_rejection = ref_config_store.getGnssRejection();
+
+  hash_value(ref_gnss_rejection.position);
+  hash_value(ref_gnss_rejection.velocity);
+  hash_value(ref_gnss_rejection.hdt);
+
+  const SbgEComOdoConf &ref_odometer = ref_config_store.getOdometerConf();
+
+  hash_value(ref_odometer.gain);
+  hash_value(ref_odometer.gainError);
+  hash_value(ref_odometer.reverseMode);
+
+  hash = ConfigCache::computeHash(ref_config_store.getOdometerLeverArm().data(), 3 * sizeof(float), hash);
+
+  hash_value(ref_config_store.getOdometerRejection().velocity);
+
+  hash_value(ref_config_store.getOutputPort());
+
+  for (const ConfigStore::SbgLogOutput &ref_log_output : ref_config_store.getOutputModes())
+  {
+    hash_value(ref_log_output.message_class);
+    hash_value(ref_log_output.message_id);
+    hash_value(ref_log_output.output_mode);
+  }
+
+  return hash;
+}
+
+SbgErrorCode ConfigApplier::computeSettingsHash(uint64_t& ref_settings_hash) const
+{
+  std::vector<uint8_t>  settings(SBG_ECOM_TRANSFER_MAX_SIZE);
+  size_t                settings_size;
+  SbgErrorCode          error_code;
+
+  error_code = sbgEComCmdExportSettings(&ref_sbg_com_handle_, settings.data(), &settings_size, settings.size());
+
+  if (error_code == SBG_NO_ERROR)
+  {
+    ref_settings_hash = ConfigCache::computeHash(settings.data(), settings_size);
+  }
+
+  return error_code;
+}
+
+//---------------------------------------------------------------------//
+//- Parameters                                                        -//
+//---------------------------------------------------------------------//
+
+//---------------------------------------------------------------------//
+//- Operations                                                        -//
+//---------------------------------------------------------------------//
+
+void ConfigApplier::applyConfiguration(const ConfigStore& ref_config_store, uint32_t serial_number)
+{
+  if (ref_config_store.getConfigCacheDirectory().empty())
+  {
+    configureDevice(ref_config_store);
+  }
+  else
   {
-    configureOutput(ref_config_store.getOutputPort(), ref_output);
+    ConfigCache   config_cache(ref_config_store.getConfigCacheDirectory());
+    uint64_t      config_hash;
+    uint64_t      settings_hash;
+    SbgErrorCode  error_code;
+
+    config_hash = computeConfigurationHash(ref_config_store);
+    error_code  = computeSettingsHash(settings_hash);
+
+    if ((error_code == SBG_NO_ERROR) && config_cache.isUpToDate(serial_number, config_hash, settings_hash))
+    {
+      RCLCPP_INFO(rclcpp::get_logger("Config"), "SBG_DRIVER - [Config] Device settings are up to date, configuration skipped");
+      return;
+    }
+    else if (error_code != SBG_NO_ERROR)
+    {
+      RCLCPP_WARN(rclcpp::get_logger("Config"), "SBG_DRIVER - [Config] Unable to export the device settings - %s", sbgErrorCodeToString(error_code));
+    }
+
+    configureDevice(ref_config_store);
+
+    //
+    // Settings are exported before being saved, as the device reboots once saved.
+    //
+    if (reboot_needed_)
+    {
+      error_code = computeSettingsHash(settings_hash);
+    }
+
+    if (error_code == SBG_NO_ERROR)
+    {
+      if (!config_cache.update(serial_number, config_hash, settings_hash))
+      {
+        RCLCPP_WARN(rclcpp::get_logger("Config"), "SBG_DRIVER - [Config] Unable to write the configuration cache to %s", ref_config_store.getConfigCacheDirectory().c_str());
+      }
+    }
   }
 
   //
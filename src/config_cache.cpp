@@ -0,0 +1,131 @@
+// File header
+#include "config_cache.h"
+
+// STL headers
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using sbg::ConfigCache;
+
+//---------------------------------------------------------------------//
+//- Constructor                                                       -//
+//---------------------------------------------------------------------//
+
+ConfigCache::ConfigCache(const std::string &ref_directory):
+directory_(ref_directory)
+{
+
+}
+
+//---------------------------------------------------------------------//
+//- Private  methods                                                  -//
+//---------------------------------------------------------------------//
+
+std::string ConfigCache::getFilePath(uint32_t serial_number) const
+{
+  return directory_ + "/sbg_" + std::to_string(serial_number) + ".cache";
+}
+
+std::string ConfigCache::getBaudRateFilePath(const std::string &ref_port_name) const
+{
+  std::string file_name(ref_port_name);
+
+  //
+  // Port names are paths on Unix, flatten them into a file name.
+  //
+  for (char &ref_char : file_name)
+  {
+    if (!std::isalnum(static_cast<unsigned char>(ref_char)))
+    {
+      ref_char = '_';
+    }
+  }
+
+  return directory_ + "/sbg_baudrate" + file_name + ".cache";
+}
+
+bool ConfigCache::writeFile(const std::string &ref_file_path, const std::string &ref_content)
+{
+  std::string   tmp_file_path;
+  bool          written;
+
+  tmp_file_path = ref_file_path + ".tmp";
+
+  //
+  // Replace the cache file atomically, so that an interrupted write never leaves a truncated entry.
+  //
+  {
+    std::ofstream file(tmp_file_path, std::ios::trunc);
+
+    file << ref_content;
+    written = static_cast<bool>(file.flush());
+  }
+
+  if (written)
+  {
+    written = (std::rename(tmp_file_path.c_str(), ref_file_path.c_str()) == 0);
+  }
+
+  if (!written)
+  {
+    std::remove(tmp_file_path.c_str());
+  }
+
+  return written;
+}
+
+//---------------------------------------------------------------------//
+//- Operations                                                        -//
+//---------------------------------------------------------------------//
+
+uint64_t ConfigCache::computeHash(const void *p_buffer, size_t size, uint64_t hash)
+{
+  const uint8_t *p_bytes = static_cast<const uint8_t*>(p_buffer);
+
+  for (size_t i = 0; i < size; i++)
+  {
+    hash ^= p_bytes[i];
+    hash *= 0x100000001b3ull;
+  }
+
+  return hash;
+}
+
+bool ConfigCache::isUpToDate(uint32_t serial_number, uint64_t config_hash, uint64_t settings_hash) const
+{
+  std::ifstream file(getFilePath(serial_number));
+  uint64_t      cached_config_hash;
+  uint64_t      cached_settings_hash;
+
+  if (file >> std::hex >> cached_config_hash >> cached_settings_hash)
+  {
+    return (cached_config_hash == config_hash) && (cached_settings_hash == settings_hash);
+  }
+  else
+  {
+    return false;
+  }
+}
+
+bool ConfigCache::update(uint32_t serial_number, uint64_t config_hash, uint64_t settings_hash) const
+{
+  std::ostringstream content;
+
+  content << std::hex << config_hash << " " << settings_hash << std::endl;
+
+  return writeFile(getFilePath(serial_number), content.str());
+}
+
+bool ConfigCache::getBaudRate(const std::string &ref_port_name, uint32_t &ref_baud_rate) const
+{
+  std::ifstream file(getBaudRateFilePath(ref_port_name));
+
+  return static_cast<bool>(file >> ref_baud_rate) && (ref_baud_rate != 0);
+}
+
+bool ConfigCache::updateBaudRate(const std::string &ref_port_name, uint32_t baud_rate) const
+{
+  return writeFile(getBaudRateFilePath(ref_port_name), std::to_string(baud_rate) + "\n");
+}
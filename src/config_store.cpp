@@ -11,11 +11,19 @@ using sbg::ConfigStore;
 //---------------------------------------------------------------------//
 
 ConfigStore::ConfigStore():
+uart_low_latency_(false),
+uart_exclusive_(false),
 serial_communication_(false),
 upd_communication_(false),
+replay_rate_(1.0),
+replay_start_paused_(false),
+replay_publish_clock_(false),
 file_communication_(false),
 configure_through_ros_(false),
 ros_standard_output_(false),
+reader_thread_(false),
+link_watchdog_(false),
+loaned_messages_(false),
 rtcm_subscribe_(false),
 nmea_publish_(false)
 {
@@ -29,6 +37,13 @@ nmea_publish_(false)
 void ConfigStore::loadDriverParameters(const rclcpp::Node& ref_node_handle)
 {
   rate_frequency_ = getParameter<uint32_t>(ref_node_handle, "driver.frequency", 400);
+
+  ref_node_handle.get_parameter_or<bool>("driver.readerThread", reader_thread_, false);
+  reader_thread_cpu_  = getParameter<int32_t>(ref_node_handle, "driver.readerThreadCpu", -1);
+  reader_queue_size_  = getParameter<uint32_t>(ref_node_handle, "driver.readerQueueSize", 128);
+
+  ref_node_handle.get_parameter_or<bool>("driver.linkWatchdog", link_watchdog_, false);
+  ref_node_handle.get_parameter_or<bool>("driver.loanedMessages", loaned_messages_, false);
 }
 
 void ConfigStore::loadOdomParameters(const rclcpp::Node& ref_node_handle)
@@ -43,12 +58,15 @@ void ConfigStore::loadOdomParameters(const rclcpp::Node& ref_node_handle)
 void ConfigStore::loadCommunicationParameters(const rclcpp::Node& ref_node_handle)
 {
   ref_node_handle.get_parameter_or<bool>("confWithRos", configure_through_ros_, false);
+  ref_node_handle.get_parameter_or<std::string>("confCacheDirectory", config_cache_directory_, "");
   
   if (ref_node_handle.has_parameter("uartConf.portName"))
   {
     serial_communication_ = true;
     ref_node_handle.get_parameter_or<std::string>("uartConf.portName", uart_port_name_, "/dev/ttyUSB0");
     ref_node_handle.get_parameter_or<std::vector<int64_t>>("uartConf.fallbackBaudRates", uart_fallback_baud_rates_, {});
+    ref_node_handle.get_parameter_or<bool>("uartConf.lowLatency", uart_low_latency_, false);
+    ref_node_handle.get_parameter_or<bool>("uartConf.exclusive", uart_exclusive_, false);
 
     uart_baud_rate_ = getParameter<uint32_t>(ref_node_handle, "uartConf.baudRate", 0);
     output_port_    = getParameter<SbgEComOutputPort>(ref_node_handle, "uartConf.portID", SBG_ECOM_OUTPUT_PORT_A);
@@ -62,11 +80,18 @@ void ConfigStore::loadCommunicationParameters(const rclcpp::Node& ref_node_handl
     sbg_ip_address_     = sbgNetworkIpFromString(ip_address.c_str());
     out_port_address_   = getParameter<uint32_t>(ref_node_handle, "ipConf.out_port", 0);
     in_port_address_    = getParameter<uint32_t>(ref_node_handle, "ipConf.in_port", 0);
+
+    udp_receive_buffer_size_  = getParameter<uint32_t>(ref_node_handle, "ipConf.receiveBufferSize", 0);
+    udp_busy_poll_            = getParameter<uint32_t>(ref_node_handle, "ipConf.busyPoll", 0);
+    udp_batch_size_           = getParameter<uint32_t>(ref_node_handle, "ipConf.batchSize", 32);
   }
   else if (ref_node_handle.has_parameter("fileConf.path"))
   {
     file_communication_ = true;
     ref_node_handle.get_parameter_or<std::string>("fileConf.path", sbg_file_, "sbg_data.dat");
+    ref_node_handle.get_parameter_or<double>("fileConf.replayRate", replay_rate_, 1.0);
+    ref_node_handle.get_parameter_or<bool>("fileConf.startPaused", replay_start_paused_, false);
+    ref_node_handle.get_parameter_or<bool>("fileConf.publishClock", replay_publish_clock_, false);
   }
   else
   {
@@ -194,6 +219,10 @@ void ConfigStore::loadOutputTimeReference(const rclcpp::Node& ref_node_handle, c
   {
     time_reference_ = TimeReference::INS_UNIX;
   }
+  else if (time_reference == "host_sync")
+  {
+    time_reference_ = TimeReference::HOST_SYNC;
+  }
   else
   {
     rclcpp::exceptions::throw_from_rcl_error(RMW_RET_ERROR, "unknown time reference: " + time_reference);
@@ -233,6 +262,11 @@ bool ConfigStore::checkConfigWithRos() const
   return configure_through_ros_;
 }
 
+const std::string &ConfigStore::getConfigCacheDirectory() const
+{
+  return config_cache_directory_;
+}
+
 bool ConfigStore::isInterfaceSerial() const
 {
   return serial_communication_;
@@ -253,6 +287,16 @@ const std::vector<int64_t> ConfigStore::getFallbackBaudRates() const
   return uart_fallback_baud_rates_;
 }
 
+bool ConfigStore::isUartLowLatency() const
+{
+  return uart_low_latency_;
+}
+
+bool ConfigStore::isUartExclusive() const
+{
+  return uart_exclusive_;
+}
+
 SbgEComOutputPort ConfigStore::getOutputPort() const
 {
   return output_port_;
@@ -278,6 +322,21 @@ uint32_t ConfigStore::getInputPortAddress() const
   return in_port_address_;
 }
 
+uint32_t ConfigStore::getUdpReceiveBufferSize() const
+{
+  return udp_receive_buffer_size_;
+}
+
+uint32_t ConfigStore::getUdpBusyPoll() const
+{
+  return udp_busy_poll_;
+}
+
+uint32_t ConfigStore::getUdpBatchSize() const
+{
+  return udp_batch_size_;
+}
+
 bool ConfigStore::isInterfaceFile() const
 {
   return file_communication_;
@@ -288,6 +347,21 @@ const std::string &ConfigStore::getFile() const
   return sbg_file_;
 }
 
+double ConfigStore::getReplayRate() const
+{
+  return replay_rate_;
+}
+
+bool ConfigStore::isReplayStartPaused() const
+{
+  return replay_start_paused_;
+}
+
+bool ConfigStore::shouldPublishReplayClock() const
+{
+  return replay_publish_clock_;
+}
+
 const SbgEComInitConditionConf &ConfigStore::getInitialConditions() const
 {
   return init_condition_conf_;
@@ -378,6 +452,31 @@ uint32_t ConfigStore::getReadingRateFrequency() const
   return rate_frequency_;
 }
 
+bool ConfigStore::useReaderThread() const
+{
+  return reader_thread_;
+}
+
+int32_t ConfigStore::getReaderThreadCpu() const
+{
+  return reader_thread_cpu_;
+}
+
+uint32_t ConfigStore::getReaderQueueSize() const
+{
+  return reader_queue_size_;
+}
+
+bool ConfigStore::useLinkWatchdog() const
+{
+  return link_watchdog_;
+}
+
+bool ConfigStore::useLoanedMessages() const
+{
+  return loaned_messages_;
+}
+
 const std::string &ConfigStore::getFrameId() const
 {
   return frame_id_;
@@ -20,6 +20,7 @@ int main(int argc, char **argv)
     loopFrequency = sbg_device.getUpdateFrequency();
     RCLCPP_INFO(node_handle->get_logger(), "SBG DRIVER - ROS Node frequency : %u Hz", loopFrequency);
     rclcpp::Rate loop_rate(loopFrequency);
+    uint32_t loopPeriodMs = std::max(1000 / loopFrequency, 1u);
 
     rclcpp::executors::SingleThreadedExecutor executor;
     executor.add_node(node_handle);
@@ -29,7 +30,15 @@ int main(int argc, char **argv)
     {
       sbg_device.periodicHandle();
       executor.spin_some(timeout);
-      loop_rate.sleep();
+
+      //
+      // Wake up as soon as data is received, the loop period only bounds the wait
+      // so that ROS callbacks are still processed when the device is silent.
+      //
+      if (!sbg_device.waitForData(loopPeriodMs))
+      {
+        loop_rate.sleep();
+      }
     }
 
     rclcpp::shutdown();
@@ -2,6 +2,8 @@
 
 using sbg::MessagePublisher;
 
+constexpr std::array<MessagePublisher::LogHandlers, SBG_ECOM_LOG_ECOM_NUM_MESSAGES> MessagePublisher::log_handlers_ = MessagePublisher::makeLogHandlersTable(std::make_index_sequence<SBG_ECOM_LOG_ECOM_NUM_MESSAGES>());
+
 /*!
  * Class to publish all SBG-ROS messages to the corresponding publishers. 
  */
@@ -10,7 +12,8 @@ using sbg::MessagePublisher;
 //---------------------------------------------------------------------//
 
 MessagePublisher::MessagePublisher():
-max_messages_(10)
+max_messages_(10),
+use_loaned_messages_(false)
 {
 }
 
@@ -18,202 +21,6 @@ max_messages_(10)
 //- Private methods                                                   -//
 //---------------------------------------------------------------------//
 
-std::string MessagePublisher::getOutputTopicName(SbgEComMsgId sbg_message_id) const
-{
-  switch (sbg_message_id)
-  {
-    case SBG_ECOM_LOG_STATUS:
-      return "sbg/status";
-
-    case SBG_ECOM_LOG_UTC_TIME:
-      return "sbg/utc_time";
-
-    case SBG_ECOM_LOG_IMU_DATA:
-      return "sbg/imu_data";
-
-    case SBG_ECOM_LOG_MAG:
-      return "sbg/mag";
-
-    case SBG_ECOM_LOG_MAG_CALIB:
-      return "sbg/mag_calib";
-
-    case SBG_ECOM_LOG_EKF_EULER:
-      return "sbg/ekf_euler";
-
-    case SBG_ECOM_LOG_EKF_QUAT:
-      return "sbg/ekf_quat";
-
-    case SBG_ECOM_LOG_EKF_NAV:
-      return "sbg/ekf_nav";
-
-    case SBG_ECOM_LOG_EKF_VEL_BODY:
-      return "sbg/ekf_vel_body";
-
-    case SBG_ECOM_LOG_EKF_ROT_ACCEL_BODY:
-      return "sbg/ekf_rot_accel_body";
-
-    case SBG_ECOM_LOG_EKF_ROT_ACCEL_NED:
-      return "sbg/ekf_rot_accel_ned";
-
-    case SBG_ECOM_LOG_SHIP_MOTION:
-      return "sbg/ship_motion";
-
-    case SBG_ECOM_LOG_GPS1_VEL:
-      return "sbg/gps_vel";
-
-    case SBG_ECOM_LOG_GPS1_POS:
-      return "sbg/gps_pos";
-
-    case SBG_ECOM_LOG_GPS1_HDT:
-      return "sbg/gps_hdt";
-
-    case SBG_ECOM_LOG_GPS1_RAW:
-      return "sbg/gps_raw";
-
-    case SBG_ECOM_LOG_ODO_VEL:
-      return "sbg/odo_vel";
-
-    case SBG_ECOM_LOG_EVENT_A:
-      return "sbg/eventA";
-
-    case SBG_ECOM_LOG_EVENT_B:
-      return "sbg/eventB";
-
-    case SBG_ECOM_LOG_EVENT_C:
-      return "sbg/eventC";
-
-    case SBG_ECOM_LOG_EVENT_D:
-      return "sbg/eventD";
-
-    case SBG_ECOM_LOG_EVENT_E:
-      return "sbg/eventE";
-
-    case SBG_ECOM_LOG_AIR_DATA:
-      return "sbg/air_data";
-
-    case SBG_ECOM_LOG_IMU_SHORT:
-      return "sbg/imu_short";
-
-    default:
-      return "undefined";
-  }
-}
-
-void MessagePublisher::initPublisher(rclcpp::Node& ref_ros_node_handle, SbgEComMsgId sbg_msg_id, SbgEComOutputMode output_conf, const std::string &ref_output_topic)
-{
-  //
-  // Check if the publisher has to be initialized.
-  //
-  if (output_conf != SBG_ECOM_OUTPUT_MODE_DISABLED)
-  {
-    switch (sbg_msg_id)
-    {
-      case SBG_ECOM_LOG_STATUS:
-        sbg_status_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgStatus>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_UTC_TIME:
-        sbg_utc_time_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgUtcTime>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_IMU_DATA:
-        sbg_imu_data_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgImuData>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_MAG:
-        sbg_mag_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgMag>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_MAG_CALIB:
-        sbg_mag_calib_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgMagCalib>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_EKF_EULER:
-        sbg_ekf_euler_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgEkfEuler>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_EKF_QUAT:
-        sbg_ekf_quat_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgEkfQuat>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_EKF_NAV:
-        sbg_ekf_nav_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgEkfNav>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_EKF_VEL_BODY:
-        sbg_ekf_vel_body_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgEkfVelBody>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_EKF_ROT_ACCEL_BODY:
-        sbg_ekf_rot_accel_body_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgEkfRotAccel>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_EKF_ROT_ACCEL_NED:
-        sbg_ekf_rot_accel_ned_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgEkfRotAccel>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_SHIP_MOTION:
-        sbg_ship_motion_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgShipMotion>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_GPS1_VEL:
-      case SBG_ECOM_LOG_GPS2_VEL:
-        sbg_gps_vel_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgGpsVel>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_GPS1_POS:
-      case SBG_ECOM_LOG_GPS2_POS:
-        sbg_gps_pos_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgGpsPos>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_GPS1_HDT:
-      case SBG_ECOM_LOG_GPS2_HDT:
-        sbg_gps_hdt_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgGpsHdt>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_GPS1_RAW:
-      case SBG_ECOM_LOG_GPS2_RAW:
-        sbg_gps_raw_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgGpsRaw>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_ODO_VEL:
-        sbg_odo_vel_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgOdoVel>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_EVENT_A:
-        sbg_event_a_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgEvent>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_EVENT_B:
-        sbg_event_b_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgEvent>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_EVENT_C:
-        sbg_event_c_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgEvent>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_EVENT_D:
-        sbg_event_d_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgEvent>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_EVENT_E:
-        sbg_event_e_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgEvent>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_IMU_SHORT:
-        sbg_imu_short_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgImuShort>(ref_output_topic, max_messages_);
-        break;
-
-      case SBG_ECOM_LOG_AIR_DATA:
-        sbg_air_data_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgAirData>(ref_output_topic, max_messages_);
-        break;
-
-      default:
-        break;
-    }
-  }
-}
-
 void MessagePublisher::defineRosStandardPublishers(rclcpp::Node& ref_ros_node_handle, bool odom_enable, bool enu_enable)
 {
   if (!enu_enable)
@@ -222,7 +29,7 @@ void MessagePublisher::defineRosStandardPublishers(rclcpp::Node& ref_ros_node_ha
     return;
   }
 
-  if (sbg_imu_data_pub_ && sbg_ekf_quat_pub_)
+  if (isLogPublished(SBG_ECOM_LOG_IMU_DATA) && isLogPublished(SBG_ECOM_LOG_EKF_QUAT))
   {
     imu_pub_ = ref_ros_node_handle.create_publisher<sensor_msgs::msg::Imu>("imu/data", max_messages_);
   }
@@ -231,7 +38,7 @@ void MessagePublisher::defineRosStandardPublishers(rclcpp::Node& ref_ros_node_ha
     RCLCPP_WARN(ref_ros_node_handle.get_logger(), "SBG_DRIVER - [Publisher] SBG Imu and/or Quat output are not configured, the standard IMU can not be defined.");
   }
 
-  if (sbg_imu_data_pub_)
+  if (isLogPublished(SBG_ECOM_LOG_IMU_DATA))
   {
     temp_pub_ = ref_ros_node_handle.create_publisher<sensor_msgs::msg::Temperature>("imu/temp", max_messages_);
   }
@@ -240,7 +47,7 @@ void MessagePublisher::defineRosStandardPublishers(rclcpp::Node& ref_ros_node_ha
     RCLCPP_WARN(ref_ros_node_handle.get_logger(), "SBG_DRIVER - [Publisher] SBG Imu data output are not configured, the standard Temperature publisher can not be defined.");
   }
 
-  if (sbg_mag_pub_)
+  if (isLogPublished(SBG_ECOM_LOG_MAG))
   {
     mag_pub_ = ref_ros_node_handle.create_publisher<sensor_msgs::msg::MagneticField>("imu/mag", max_messages_);
   }
@@ -253,7 +60,7 @@ void MessagePublisher::defineRosStandardPublishers(rclcpp::Node& ref_ros_node_ha
   // We need either Euler or quat angles, and we must have Nav and IMU data to
   // compute Body and angular velocity.
   //
-  if ((sbg_ekf_euler_pub_ || sbg_ekf_quat_pub_) && sbg_ekf_nav_pub_ && sbg_imu_data_pub_)
+  if ((isLogPublished(SBG_ECOM_LOG_EKF_EULER) || isLogPublished(SBG_ECOM_LOG_EKF_QUAT)) && isLogPublished(SBG_ECOM_LOG_EKF_NAV) && isLogPublished(SBG_ECOM_LOG_IMU_DATA))
   {
     velocity_pub_ = ref_ros_node_handle.create_publisher<geometry_msgs::msg::TwistStamped>("imu/velocity", max_messages_);
   }
@@ -262,7 +69,7 @@ void MessagePublisher::defineRosStandardPublishers(rclcpp::Node& ref_ros_node_ha
     RCLCPP_WARN(ref_ros_node_handle.get_logger(), "SBG_DRIVER - [Publisher] SBG Imu, Nav or Angles data outputs are not configured, the standard Velocity publisher can not be defined.");
   }
 
-  if (sbg_air_data_pub_)
+  if (isLogPublished(SBG_ECOM_LOG_AIR_DATA))
   {
     fluid_pub_ = ref_ros_node_handle.create_publisher<sensor_msgs::msg::FluidPressure>("imu/pres", max_messages_);
   }
@@ -271,7 +78,7 @@ void MessagePublisher::defineRosStandardPublishers(rclcpp::Node& ref_ros_node_ha
     RCLCPP_WARN(ref_ros_node_handle.get_logger(), "SBG_DRIVER - [Publisher] SBG AirData output are not configured, the standard FluidPressure publisher can not be defined.");
   }
 
-  if (sbg_ekf_nav_pub_)
+  if (isLogPublished(SBG_ECOM_LOG_EKF_NAV))
   {
     pos_ecef_pub_ = ref_ros_node_handle.create_publisher<geometry_msgs::msg::PointStamped>("imu/pos_ecef", max_messages_);
   }
@@ -280,7 +87,7 @@ void MessagePublisher::defineRosStandardPublishers(rclcpp::Node& ref_ros_node_ha
     RCLCPP_WARN(ref_ros_node_handle.get_logger(), "SBG_DRIVER - [Publisher] SBG Ekf data output are not configured, the standard ECEF position publisher can not be defined.");
   }
 
-  if (sbg_utc_time_pub_)
+  if (isLogPublished(SBG_ECOM_LOG_UTC_TIME))
   {
     utc_reference_pub_ = ref_ros_node_handle.create_publisher<sensor_msgs::msg::TimeReference>("imu/utc_ref", max_messages_);
   }
@@ -289,7 +96,7 @@ void MessagePublisher::defineRosStandardPublishers(rclcpp::Node& ref_ros_node_ha
     RCLCPP_WARN(ref_ros_node_handle.get_logger(), "SBG_DRIVER - [Publisher] SBG Utc data output are not configured, the UTC time reference publisher can not be defined.");
   }
 
-  if (sbg_gps_pos_pub_)
+  if (isLogPublished(SBG_ECOM_LOG_GPS1_POS))
   {
     nav_sat_fix_pub_ = ref_ros_node_handle.create_publisher<sensor_msgs::msg::NavSatFix>("imu/nav_sat_fix", max_messages_);
   }
@@ -300,7 +107,7 @@ void MessagePublisher::defineRosStandardPublishers(rclcpp::Node& ref_ros_node_ha
 
   if (odom_enable)
   {
-    if (sbg_imu_data_pub_ && sbg_ekf_nav_pub_ && (sbg_ekf_euler_pub_ || sbg_ekf_quat_pub_))
+    if (isLogPublished(SBG_ECOM_LOG_IMU_DATA) && isLogPublished(SBG_ECOM_LOG_EKF_NAV) && (isLogPublished(SBG_ECOM_LOG_EKF_EULER) || isLogPublished(SBG_ECOM_LOG_EKF_QUAT)))
     {
       odometry_pub_ = ref_ros_node_handle.create_publisher<nav_msgs::msg::Odometry>("imu/odometry", max_messages_);
     }
@@ -311,18 +118,29 @@ void MessagePublisher::defineRosStandardPublishers(rclcpp::Node& ref_ros_node_ha
   }
 }
 
+void MessagePublisher::defineFixedSizePublishers(rclcpp::Node& ref_ros_node_handle)
+{
+  if (isLogPublished(SBG_ECOM_LOG_IMU_DATA))
+  {
+    imu_data_fixed_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgImuDataFixed>("sbg/imu_data_fixed", max_messages_);
+  }
+
+  if (isLogPublished(SBG_ECOM_LOG_IMU_SHORT))
+  {
+    imu_short_fixed_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgImuShortFixed>("sbg/imu_short_fixed", max_messages_);
+  }
+
+  if (isLogPublished(SBG_ECOM_LOG_EKF_QUAT))
+  {
+    ekf_quat_fixed_pub_ = ref_ros_node_handle.create_publisher<sbg_driver::msg::SbgEkfQuatFixed>("sbg/ekf_quat_fixed", max_messages_);
+  }
+}
+
 void MessagePublisher::processImuMessage()
 {
   if (temp_pub_)
   {
-    if (sbg_imu_short_pub_)
-    {
-      temp_pub_->publish(message_wrapper_.createRosTemperatureMessage(sbg_imu_short_message_));
-    }
-    else if (sbg_imu_data_pub_)
-    {
-      temp_pub_->publish(message_wrapper_.createRosTemperatureMessage(sbg_imu_message_));
-    }
+    publishMessage(*temp_pub_, [&](auto &ref_message) { message_wrapper_.fillRosTemperatureMessage(imu_state_, ref_message); });
   }
 
   processRosImuMessage();
@@ -334,27 +152,13 @@ void MessagePublisher::processRosVelMessage()
 {
   if (velocity_pub_)
   {
-    if (sbg_imu_short_pub_)
+    if (isLogPublished(SBG_ECOM_LOG_EKF_QUAT))
     {
-      if (sbg_ekf_quat_pub_)
-      {
-        velocity_pub_->publish(message_wrapper_.createRosTwistStampedMessage(sbg_ekf_quat_message_, sbg_ekf_nav_message_, sbg_imu_short_message_));
-      }
-      else if (sbg_ekf_euler_pub_)
-      {
-        velocity_pub_->publish(message_wrapper_.createRosTwistStampedMessage(sbg_ekf_euler_message_, sbg_ekf_nav_message_, sbg_imu_short_message_));
-      }
+      publishMessage(*velocity_pub_, [&](auto &ref_message) { message_wrapper_.fillRosTwistStampedMessage(ekf_quat_state_, ekf_nav_state_, imu_state_, ref_message); });
     }
-    else if (sbg_imu_data_pub_)
+    else if (isLogPublished(SBG_ECOM_LOG_EKF_EULER))
     {
-      if (sbg_ekf_quat_pub_)
-      {
-        velocity_pub_->publish(message_wrapper_.createRosTwistStampedMessage(sbg_ekf_quat_message_, sbg_ekf_nav_message_, sbg_imu_message_));
-      }
-      else if (sbg_ekf_euler_pub_)
-      {
-        velocity_pub_->publish(message_wrapper_.createRosTwistStampedMessage(sbg_ekf_euler_message_, sbg_ekf_nav_message_, sbg_imu_message_));
-      }
+      publishMessage(*velocity_pub_, [&](auto &ref_message) { message_wrapper_.fillRosTwistStampedMessage(ekf_euler_state_, ekf_nav_state_, imu_state_, ref_message); });
     }
   }
 }
@@ -363,21 +167,9 @@ void MessagePublisher::processRosImuMessage()
 {
   if (imu_pub_)
   {
-    sbg_driver::msg::SbgEkfQuat ekf_quat_message_zero;
-
-    if (sbg_imu_short_pub_)
+    if (!ekf_quat_state_.valid || (imu_state_.time_stamp == ekf_quat_state_.time_stamp))
     {
-      if ((sbg_ekf_quat_message_ == ekf_quat_message_zero) || (sbg_imu_short_message_.time_stamp == sbg_ekf_quat_message_.time_stamp))
-      {
-        imu_pub_->publish(message_wrapper_.createRosImuMessage(sbg_imu_short_message_, sbg_ekf_quat_message_));
-      }
-    }
-    else if (sbg_imu_data_pub_)
-    {
-      if ((sbg_ekf_quat_message_ == ekf_quat_message_zero) || (sbg_imu_message_.time_stamp == sbg_ekf_quat_message_.time_stamp))
-      {
-        imu_pub_->publish(message_wrapper_.createRosImuMessage(sbg_imu_message_, sbg_ekf_quat_message_));
-      }
+      publishMessage(*imu_pub_, [&](auto &ref_message) { message_wrapper_.fillRosImuMessage(imu_state_, ekf_quat_state_, ref_message); });
     }
   }
 }
@@ -386,146 +178,256 @@ void MessagePublisher::processRosOdoMessage()
 {
   if (odometry_pub_)
   {
-    if (sbg_ekf_nav_message_.status.solution_mode == SBG_ECOM_SOL_MODE_NAV_POSITION)
+    if ((ekf_nav_state_.solution_mode == SBG_ECOM_SOL_MODE_NAV_POSITION) && (imu_state_.time_stamp == ekf_nav_state_.time_stamp))
     {
-      if (sbg_imu_short_pub_)
+      /*
+      * Odometry message can be generated from quaternion or euler angles.
+      * Quaternion is prefered if they are available.
+      */
+      if (isLogPublished(SBG_ECOM_LOG_EKF_QUAT))
       {
-        if (sbg_imu_short_message_.time_stamp == sbg_ekf_nav_message_.time_stamp)
+        if (imu_state_.time_stamp == ekf_quat_state_.time_stamp)
         {
-          /*
-          * Odometry message can be generated from quaternion or euler angles.
-          * Quaternion is prefered if they are available.
-          */
-          if (sbg_ekf_quat_pub_)
-          {
-            if (sbg_imu_short_message_.time_stamp == sbg_ekf_quat_message_.time_stamp)
-            {
-              odometry_pub_->publish(message_wrapper_.createRosOdoMessage(sbg_imu_short_message_, sbg_ekf_nav_message_, sbg_ekf_quat_message_, sbg_ekf_euler_message_));
-            }
-          }
-          else
-          {
-            if (sbg_imu_short_message_.time_stamp == sbg_ekf_euler_message_.time_stamp)
-            {
-              odometry_pub_->publish(message_wrapper_.createRosOdoMessage(sbg_imu_short_message_, sbg_ekf_nav_message_, sbg_ekf_euler_message_));
-            }
-          }
+          publishMessage(*odometry_pub_, [&](auto &ref_message) { message_wrapper_.fillRosOdoMessage(imu_state_, ekf_nav_state_, ekf_quat_state_, ekf_euler_state_, ref_message); });
         }
       }
-      else if (sbg_imu_data_pub_)
+      else
       {
-        if (sbg_imu_message_.time_stamp == sbg_ekf_nav_message_.time_stamp)
+        if (imu_state_.time_stamp == ekf_euler_state_.time_stamp)
         {
-          /*
-          * Odometry message can be generated from quaternion or euler angles.
-          * Quaternion is prefered if they are available.
-          */
-          if (sbg_ekf_quat_pub_)
-          {
-            if (sbg_imu_message_.time_stamp == sbg_ekf_quat_message_.time_stamp)
-            {
-              odometry_pub_->publish(message_wrapper_.createRosOdoMessage(sbg_imu_message_, sbg_ekf_nav_message_, sbg_ekf_quat_message_, sbg_ekf_euler_message_));
-            }
-          }
-          else
-          {
-            if (sbg_imu_message_.time_stamp == sbg_ekf_euler_message_.time_stamp)
-            {
-              odometry_pub_->publish(message_wrapper_.createRosOdoMessage(sbg_imu_message_, sbg_ekf_nav_message_, sbg_ekf_euler_message_));
-            }
-          }
+          publishMessage(*odometry_pub_, [&](auto &ref_message) { message_wrapper_.fillRosOdoMessage(imu_state_, ekf_nav_state_, ekf_euler_state_, ref_message); });
         }
       }
     }
   }
 }
 
-void MessagePublisher::publishMagData(const SbgEComLogUnion &ref_sbg_log)
+template <>
+void MessagePublisher::publishLog<SBG_ECOM_LOG_UTC_TIME>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id)
 {
-  sbg_driver::msg::SbgMag sbg_mag_message;
-  sbg_mag_message = message_wrapper_.createSbgMagMessage(ref_sbg_log.magData);
+  std::unique_ptr<sbg_driver::msg::SbgUtcTime> p_sbg_utc_message = std::make_unique<sbg_driver::msg::SbgUtcTime>();
 
-  if (sbg_mag_pub_)
+  SBG_UNUSED_PARAMETER(sbg_msg_id);
+
+  //
+  // The UTC log is always processed, as the message wrapper relies on it to convert timestamps.
+  //
+  message_wrapper_.fillSbgUtcTimeMessage(ref_sbg_log.utcData, *p_sbg_utc_message);
+
+  if (utc_reference_pub_)
   {
-    sbg_mag_pub_->publish(sbg_mag_message);
+    if (p_sbg_utc_message->clock_status.clock_utc_status != SBG_ECOM_UTC_STATUS_INVALID)
+    {
+      publishMessage(*utc_reference_pub_, [&](auto &ref_message) { message_wrapper_.fillRosUtcTimeReferenceMessage(*p_sbg_utc_message, ref_message); });
+    }
   }
+  if (isLogPublished(SBG_ECOM_LOG_UTC_TIME))
+  {
+    getLogPublisher<SBG_ECOM_LOG_UTC_TIME>()->publish(std::move(p_sbg_utc_message));
+  }
+}
+
+template <>
+void MessagePublisher::publishLog<SBG_ECOM_LOG_IMU_DATA>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id)
+{
+  SBG_UNUSED_PARAMETER(sbg_msg_id);
+
+  if (isLogPublished(SBG_ECOM_LOG_IMU_DATA))
+  {
+    publishMessage(*getLogPublisher<SBG_ECOM_LOG_IMU_DATA>(), [&](auto &ref_message)
+    {
+      message_wrapper_.fillSbgImuDataMessage(ref_sbg_log.imuData, ref_message);
+
+      if (imu_data_fixed_pub_)
+      {
+        publishMessage(*imu_data_fixed_pub_, [&](auto &ref_fixed_message) { message_wrapper_.fillSbgImuDataFixedMessage(ref_message, ref_fixed_message); });
+      }
+
+      //
+      // IMU short logs are preferred to build the ROS standard messages when both are output.
+      //
+      if (!isLogPublished(SBG_ECOM_LOG_IMU_SHORT))
+      {
+        message_wrapper_.fillImuState(ref_message, imu_state_);
+      }
+    });
+
+    processImuMessage();
+  }
+}
+
+template <>
+void MessagePublisher::publishLog<SBG_ECOM_LOG_MAG>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id)
+{
+  std::unique_ptr<sbg_driver::msg::SbgMag> p_sbg_mag_message = std::make_unique<sbg_driver::msg::SbgMag>();
+
+  SBG_UNUSED_PARAMETER(sbg_msg_id);
+
+  message_wrapper_.fillSbgMagMessage(ref_sbg_log.magData, *p_sbg_mag_message);
+
+  //
+  // Publish the ROS standard message first, the SBG message is then handed over to the middleware.
+  //
   if (mag_pub_)
   {
-    mag_pub_->publish(message_wrapper_.createRosMagneticMessage(sbg_mag_message));
+    publishMessage(*mag_pub_, [&](auto &ref_message) { message_wrapper_.fillRosMagneticMessage(*p_sbg_mag_message, ref_message); });
+  }
+  if (isLogPublished(SBG_ECOM_LOG_MAG))
+  {
+    getLogPublisher<SBG_ECOM_LOG_MAG>()->publish(std::move(p_sbg_mag_message));
   }
 }
 
-void MessagePublisher::publishFluidPressureData(const SbgEComLogUnion &ref_sbg_log)
+template <>
+void MessagePublisher::publishLog<SBG_ECOM_LOG_EKF_EULER>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id)
 {
-  sbg_driver::msg::SbgAirData sbg_air_data_message;
-  sbg_air_data_message = message_wrapper_.createSbgAirDataMessage(ref_sbg_log.airData);
+  SBG_UNUSED_PARAMETER(sbg_msg_id);
 
-  if (sbg_air_data_pub_)
+  if (isLogPublished(SBG_ECOM_LOG_EKF_EULER))
   {
-    sbg_air_data_pub_->publish(sbg_air_data_message);
+    publishMessage(*getLogPublisher<SBG_ECOM_LOG_EKF_EULER>(), [&](auto &ref_message)
+    {
+      message_wrapper_.fillSbgEkfEulerMessage(ref_sbg_log.ekfEulerData, ref_message);
+      message_wrapper_.fillEkfEulerState(ref_message, ekf_euler_state_);
+    });
+
+    processRosVelMessage();
+    processRosOdoMessage();
   }
-  if (fluid_pub_)
+}
+
+template <>
+void MessagePublisher::publishLog<SBG_ECOM_LOG_EKF_QUAT>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id)
+{
+  SBG_UNUSED_PARAMETER(sbg_msg_id);
+
+  if (isLogPublished(SBG_ECOM_LOG_EKF_QUAT))
   {
-    fluid_pub_->publish(message_wrapper_.createRosFluidPressureMessage(sbg_air_data_message));
+    publishMessage(*getLogPublisher<SBG_ECOM_LOG_EKF_QUAT>(), [&](auto &ref_message)
+    {
+      message_wrapper_.fillSbgEkfQuatMessage(ref_sbg_log.ekfQuatData, ref_message);
+
+      if (ekf_quat_fixed_pub_)
+      {
+        publishMessage(*ekf_quat_fixed_pub_, [&](auto &ref_fixed_message) { message_wrapper_.fillSbgEkfQuatFixedMessage(ref_message, ref_fixed_message); });
+      }
+
+      message_wrapper_.fillEkfQuatState(ref_message, ekf_quat_state_);
+    });
+
+    processRosImuMessage();
+    processRosVelMessage();
   }
 }
 
-void MessagePublisher::publishEkfNavigationData(const SbgEComLogUnion &ref_sbg_log)
+template <>
+void MessagePublisher::publishLog<SBG_ECOM_LOG_EKF_NAV>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id)
 {
-  sbg_ekf_nav_message_ = message_wrapper_.createSbgEkfNavMessage(ref_sbg_log.ekfNavData);
+  SBG_UNUSED_PARAMETER(sbg_msg_id);
 
-  if (sbg_ekf_nav_pub_)
+  //
+  // The navigation state is always updated, as the ROS standard messages rely on it.
+  //
+  if (isLogPublished(SBG_ECOM_LOG_EKF_NAV))
+  {
+    publishMessage(*getLogPublisher<SBG_ECOM_LOG_EKF_NAV>(), [&](auto &ref_message)
+    {
+      message_wrapper_.fillSbgEkfNavMessage(ref_sbg_log.ekfNavData, ref_message);
+      message_wrapper_.fillEkfNavState(ref_message, ekf_nav_state_);
+    });
+  }
+  else
   {
-    sbg_ekf_nav_pub_->publish(sbg_ekf_nav_message_);
+    sbg_driver::msg::SbgEkfNav sbg_ekf_nav_message;
+
+    message_wrapper_.fillSbgEkfNavMessage(ref_sbg_log.ekfNavData, sbg_ekf_nav_message);
+    message_wrapper_.fillEkfNavState(sbg_ekf_nav_message, ekf_nav_state_);
   }
+
   if (pos_ecef_pub_)
   {
-    pos_ecef_pub_->publish(message_wrapper_.createRosPointStampedMessage(sbg_ekf_nav_message_));
+    publishMessage(*pos_ecef_pub_, [&](auto &ref_message) { message_wrapper_.fillRosPointStampedMessage(ekf_nav_state_, ref_message); });
   }
   processRosVelMessage();
+  processRosOdoMessage();
 }
 
-void MessagePublisher::publishUtcData(const SbgEComLogUnion &ref_sbg_log)
+template <>
+void MessagePublisher::publishLog<SBG_ECOM_LOG_GPS1_POS>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id)
 {
-  sbg_driver::msg::SbgUtcTime sbg_utc_message;
+  publishGpsPosData(ref_sbg_log, sbg_msg_id);
+}
 
-  sbg_utc_message = message_wrapper_.createSbgUtcTimeMessage(ref_sbg_log.utcData);
+template <>
+void MessagePublisher::publishLog<SBG_ECOM_LOG_GPS2_POS>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id)
+{
+  publishGpsPosData(ref_sbg_log, sbg_msg_id);
+}
+
+template <>
+void MessagePublisher::publishLog<SBG_ECOM_LOG_AIR_DATA>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id)
+{
+  std::unique_ptr<sbg_driver::msg::SbgAirData> p_sbg_air_data_message = std::make_unique<sbg_driver::msg::SbgAirData>();
 
-  if (sbg_utc_time_pub_)
+  SBG_UNUSED_PARAMETER(sbg_msg_id);
+
+  message_wrapper_.fillSbgAirDataMessage(ref_sbg_log.airData, *p_sbg_air_data_message);
+
+  if (fluid_pub_)
   {
-    sbg_utc_time_pub_->publish(sbg_utc_message);
+    publishMessage(*fluid_pub_, [&](auto &ref_message) { message_wrapper_.fillRosFluidPressureMessage(*p_sbg_air_data_message, ref_message); });
   }
-  if (utc_reference_pub_)
+  if (isLogPublished(SBG_ECOM_LOG_AIR_DATA))
+  {
+    getLogPublisher<SBG_ECOM_LOG_AIR_DATA>()->publish(std::move(p_sbg_air_data_message));
+  }
+}
+
+template <>
+void MessagePublisher::publishLog<SBG_ECOM_LOG_IMU_SHORT>(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id)
+{
+  SBG_UNUSED_PARAMETER(sbg_msg_id);
+
+  if (isLogPublished(SBG_ECOM_LOG_IMU_SHORT))
   {
-    if (sbg_utc_message.clock_status.clock_utc_status != SBG_ECOM_UTC_STATUS_INVALID)
+    publishMessage(*getLogPublisher<SBG_ECOM_LOG_IMU_SHORT>(), [&](auto &ref_message)
     {
-      utc_reference_pub_->publish(message_wrapper_.createRosUtcTimeReferenceMessage(sbg_utc_message));
-    }
+      message_wrapper_.fillSbgImuShortMessage(ref_sbg_log.imuShort, ref_message);
+
+      if (imu_short_fixed_pub_)
+      {
+        publishMessage(*imu_short_fixed_pub_, [&](auto &ref_fixed_message) { message_wrapper_.fillSbgImuShortFixedMessage(ref_message, ref_fixed_message); });
+      }
+
+      message_wrapper_.fillImuState(ref_message, imu_state_);
+    });
+
+    processImuMessage();
   }
 }
 
 void MessagePublisher::publishGpsPosData(const SbgEComLogUnion &ref_sbg_log, SbgEComMsgId sbg_msg_id)
 {
-  sbg_driver::msg::SbgGpsPos sbg_gps_pos_message;
+  std::unique_ptr<sbg_driver::msg::SbgGpsPos> p_sbg_gps_pos_message = std::make_unique<sbg_driver::msg::SbgGpsPos>();
 
-  sbg_gps_pos_message = message_wrapper_.createSbgGpsPosMessage(ref_sbg_log.gpsPosData);
+  message_wrapper_.fillSbgGpsPosMessage(ref_sbg_log.gpsPosData, *p_sbg_gps_pos_message);
 
-  if (sbg_gps_pos_pub_)
+  if (nav_sat_fix_pub_)
   {
-    sbg_gps_pos_pub_->publish(sbg_gps_pos_message);
+    publishMessage(*nav_sat_fix_pub_, [&](auto &ref_message) { message_wrapper_.fillRosNavSatFixMessage(*p_sbg_gps_pos_message, ref_message); });
   }
-  if (nav_sat_fix_pub_)
+  if (isLogPublished(SBG_ECOM_LOG_GPS1_POS))
   {
-    nav_sat_fix_pub_->publish(message_wrapper_.createRosNavSatFixMessage(sbg_gps_pos_message));
+    getLogPublisher<SBG_ECOM_LOG_GPS1_POS>()->publish(std::move(p_sbg_gps_pos_message));
   }
   if (nmea_gga_pub_ && sbg_msg_id == SBG_ECOM_LOG_GPS1_POS)
   {
-    const nmea_msgs::msg::Sentence  nmea_gga_msg = message_wrapper_.createNmeaGGAMessageForNtrip(ref_sbg_log.gpsPosData);
+    std::unique_ptr<nmea_msgs::msg::Sentence> p_nmea_gga_msg = std::make_unique<nmea_msgs::msg::Sentence>();
 
     // Only publish if a valid NMEA GGA message has been generated
-    if (nmea_gga_msg.sentence.size() > 0)
+    if (message_wrapper_.fillNmeaGGAMessageForNtrip(ref_sbg_log.gpsPosData, *p_nmea_gga_msg))
     {
-      nmea_gga_pub_->publish(nmea_gga_msg);
+      nmea_gga_pub_->publish(std::move(p_nmea_gga_msg));
     }
   }
 }
@@ -553,9 +455,24 @@ void MessagePublisher::initPublishers(rclcpp::Node& ref_ros_node_handle, const C
   message_wrapper_.setOdomBaseFrameId(ref_config_store.getOdomBaseFrameId());
   message_wrapper_.setOdomInitFrameId(ref_config_store.getOdomInitFrameId());
 
+  use_loaned_messages_ = ref_config_store.useLoanedMessages();
+
   for (const ConfigStore::SbgLogOutput &ref_output : ref_output_modes)
   {
-    initPublisher(ref_ros_node_handle, ref_output.message_id, ref_output.output_mode, getOutputTopicName(ref_output.message_id));
+    if ((ref_output.output_mode != SBG_ECOM_OUTPUT_MODE_DISABLED) && (ref_output.message_class == SBG_ECOM_CLASS_LOG_ECOM_0) && (ref_output.message_id < log_handlers_.size()))
+    {
+      const LogHandlers &ref_log_handlers = log_handlers_[ref_output.message_id];
+
+      if (ref_log_handlers.init_function)
+      {
+        (this->*ref_log_handlers.init_function)(ref_ros_node_handle);
+      }
+    }
+  }
+
+  if (use_loaned_messages_)
+  {
+    defineFixedSizePublishers(ref_ros_node_handle);
   }
 
   if (ref_config_store.shouldPublishNmea())
@@ -569,326 +486,43 @@ void MessagePublisher::initPublishers(rclcpp::Node& ref_ros_node_handle, const C
   }
 }
 
-void MessagePublisher::publish(SbgEComClass sbg_msg_class, SbgEComMsgId sbg_msg_id, const SbgEComLogUnion &ref_sbg_log)
+void MessagePublisher::publish(SbgEComClass sbg_msg_class, SbgEComMsgId sbg_msg_id, const SbgEComLogUnion &ref_sbg_log, const SbgInterfaceTimestamp &ref_arrival_time)
 {
   //
-  // Publish the message with the corresponding publisher and SBG message ID.
-  // For each log, check if the publisher has been initialized.
+  // Dispatch the log to the handlers generated from its traits, indexed by SBG message ID.
   //
-  if (sbg_msg_class == SBG_ECOM_CLASS_LOG_ECOM_0)
+  if ((sbg_msg_class == SBG_ECOM_CLASS_LOG_ECOM_0) && (sbg_msg_id < log_handlers_.size()))
   {
-    switch (sbg_msg_id)
-    {
-      case SBG_ECOM_LOG_STATUS:
+    const LogHandlers &ref_log_handlers = log_handlers_[sbg_msg_id];
 
-        if (sbg_status_pub_)
-        {
-          sbg_status_pub_->publish(message_wrapper_.createSbgStatusMessage(ref_sbg_log.statusData));
-        }
-        break;
-
-      case SBG_ECOM_LOG_UTC_TIME:
-        publishUtcData(ref_sbg_log);
-        break;
-
-      case SBG_ECOM_LOG_IMU_DATA:
-        if (sbg_imu_data_pub_)
-        {
-          sbg_imu_message_ = message_wrapper_.createSbgImuDataMessage(ref_sbg_log.imuData);
-          sbg_imu_data_pub_->publish(sbg_imu_message_);
-          processImuMessage();
-        }
-        break;
-
-      case SBG_ECOM_LOG_MAG:
-        publishMagData(ref_sbg_log);
-        break;
+    message_wrapper_.setArrivalTime(ref_arrival_time, ref_log_handlers.timestamp_function ? ref_log_handlers.timestamp_function(ref_sbg_log) : 0);
 
-      case SBG_ECOM_LOG_MAG_CALIB:
-        if (sbg_mag_calib_pub_)
-        {
-          sbg_mag_calib_pub_->publish(message_wrapper_.createSbgMagCalibMessage(ref_sbg_log.magCalibData));
-        }
-        break;
-
-      case SBG_ECOM_LOG_EKF_EULER:
-        if (sbg_ekf_euler_pub_)
-        {
-          sbg_ekf_euler_message_ = message_wrapper_.createSbgEkfEulerMessage(ref_sbg_log.ekfEulerData);
-          sbg_ekf_euler_pub_->publish(sbg_ekf_euler_message_);
-          processRosVelMessage();
-          processRosOdoMessage();
-        }
-        break;
-
-      case SBG_ECOM_LOG_EKF_QUAT:
-        if (sbg_ekf_quat_pub_)
-        {
-          sbg_ekf_quat_message_ = message_wrapper_.createSbgEkfQuatMessage(ref_sbg_log.ekfQuatData);
-          sbg_ekf_quat_pub_->publish(sbg_ekf_quat_message_);
-          processRosImuMessage();
-          processRosVelMessage();
-        }
-        break;
-
-      case SBG_ECOM_LOG_EKF_NAV:
-        publishEkfNavigationData(ref_sbg_log);
-        processRosOdoMessage();
-        break;
-
-      case SBG_ECOM_LOG_EKF_VEL_BODY:
-        if (sbg_ekf_vel_body_pub_)
-        {
-          sbg_ekf_vel_body_pub_->publish(message_wrapper_.createSbgEkfVelBodyMessage(ref_sbg_log.ekfVelBody));
-        }
-        break;
-
-      case SBG_ECOM_LOG_EKF_ROT_ACCEL_BODY:
-        if (sbg_ekf_rot_accel_body_pub_)
-        {
-          sbg_ekf_rot_accel_body_pub_->publish(message_wrapper_.createSbgEkfRotAccelMessage(ref_sbg_log.ekfRotAccel));
-        }
-        break;
-
-      case SBG_ECOM_LOG_EKF_ROT_ACCEL_NED:
-        if (sbg_ekf_rot_accel_ned_pub_)
-        {
-          sbg_ekf_rot_accel_ned_pub_->publish(message_wrapper_.createSbgEkfRotAccelMessage(ref_sbg_log.ekfRotAccel));
-        }
-        break;
-
-      case SBG_ECOM_LOG_SHIP_MOTION:
-        if (sbg_ship_motion_pub_)
-        {
-          sbg_ship_motion_pub_->publish(message_wrapper_.createSbgShipMotionMessage(ref_sbg_log.shipMotionData));
-        }
-        break;
-
-      case SBG_ECOM_LOG_GPS1_VEL:
-      case SBG_ECOM_LOG_GPS2_VEL:
-        if (sbg_gps_vel_pub_)
-        {
-          sbg_gps_vel_pub_->publish(message_wrapper_.createSbgGpsVelMessage(ref_sbg_log.gpsVelData));
-        }
-        break;
-
-      case SBG_ECOM_LOG_GPS1_POS:
-      case SBG_ECOM_LOG_GPS2_POS:
-        publishGpsPosData(ref_sbg_log, sbg_msg_id);
-        break;
-
-      case SBG_ECOM_LOG_GPS1_HDT:
-      case SBG_ECOM_LOG_GPS2_HDT:
-        if (sbg_gps_hdt_pub_)
-        {
-          sbg_gps_hdt_pub_->publish(message_wrapper_.createSbgGpsHdtMessage(ref_sbg_log.gpsHdtData));
-        }
-        break;
-
-      case SBG_ECOM_LOG_GPS1_RAW:
-      case SBG_ECOM_LOG_GPS2_RAW:
-        if (sbg_gps_raw_pub_)
-        {
-          sbg_gps_raw_pub_->publish(message_wrapper_.createSbgGpsRawMessage(ref_sbg_log.gpsRawData));
-        }
-        break;
-
-      case SBG_ECOM_LOG_ODO_VEL:
-        if (sbg_odo_vel_pub_)
-        {
-          sbg_odo_vel_pub_->publish(message_wrapper_.createSbgOdoVelMessage(ref_sbg_log.odometerData));
-        }
-        break;
-
-      case SBG_ECOM_LOG_EVENT_A:
-        if (sbg_event_a_pub_)
-        {
-          sbg_event_a_pub_->publish(message_wrapper_.createSbgEventMessage(ref_sbg_log.eventMarker));
-        }
-        break;
-
-      case SBG_ECOM_LOG_EVENT_B:
-        if (sbg_event_b_pub_)
-        {
-          sbg_event_b_pub_->publish(message_wrapper_.createSbgEventMessage(ref_sbg_log.eventMarker));
-        }
-        break;
-
-      case SBG_ECOM_LOG_EVENT_C:
-        if (sbg_event_c_pub_)
-        {
-          sbg_event_c_pub_->publish(message_wrapper_.createSbgEventMessage(ref_sbg_log.eventMarker));
-        }
-        break;
-
-      case SBG_ECOM_LOG_EVENT_D:
-        if (sbg_event_d_pub_)
-        {
-          sbg_event_d_pub_->publish(message_wrapper_.createSbgEventMessage(ref_sbg_log.eventMarker));
-        }
-        break;
-
-      case SBG_ECOM_LOG_EVENT_E:
-        if (sbg_event_e_pub_)
-        {
-          sbg_event_e_pub_->publish(message_wrapper_.createSbgEventMessage(ref_sbg_log.eventMarker));
-        }
-        break;
-
-      case SBG_ECOM_LOG_IMU_SHORT:
-        if (sbg_imu_short_pub_)
-        {
-          sbg_imu_short_message_ = message_wrapper_.createSbgImuShortMessage(ref_sbg_log.imuShort);
-          sbg_imu_short_pub_->publish(sbg_imu_short_message_);
-          processImuMessage();
-        }
-        break;
-
-      case SBG_ECOM_LOG_AIR_DATA:
-        publishFluidPressureData(ref_sbg_log);
-        break;
-
-      default:
-        break;
+    if (ref_log_handlers.publish_function)
+    {
+      (this->*ref_log_handlers.publish_function)(ref_sbg_log, sbg_msg_id);
     }
   }
-  else if (sbg_msg_class == SBG_ECOM_CLASS_LOG_ECOM_1)
+  else
   {
-    switch (sbg_msg_id)
-    {
-      default:
-        break;
-    }
+    message_wrapper_.setArrivalTime(ref_arrival_time, 0);
   }
 }
 
-uint32_t MessagePublisher::getTimestamp(SbgEComClass sbg_msg_class, SbgEComMsgId sbg_msg_id, const SbgEComLogUnion &ref_sbg_log)
+uint32_t MessagePublisher::getTimestamp(SbgEComClass sbg_msg_class, SbgEComMsgId sbg_msg_id, const SbgEComLogUnion &ref_sbg_log) const
 {
   uint32_t timestamp;
 
-  if (sbg_msg_class == SBG_ECOM_CLASS_LOG_ECOM_0)
+  timestamp = 0;
+
+  if ((sbg_msg_class == SBG_ECOM_CLASS_LOG_ECOM_0) && (sbg_msg_id < log_handlers_.size()))
   {
-    switch (sbg_msg_id)
+    const LogHandlers &ref_log_handlers = log_handlers_[sbg_msg_id];
+
+    if (ref_log_handlers.timestamp_function)
     {
-    case SBG_ECOM_LOG_STATUS:
-      timestamp = ref_sbg_log.statusData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_UTC_TIME:
-      timestamp = ref_sbg_log.utcData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_IMU_DATA:
-      timestamp = ref_sbg_log.imuData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_MAG:
-      timestamp = ref_sbg_log.magData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_MAG_CALIB:
-      timestamp = ref_sbg_log.magCalibData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_EKF_EULER:
-      timestamp = ref_sbg_log.ekfEulerData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_EKF_QUAT:
-      timestamp = ref_sbg_log.ekfQuatData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_EKF_NAV:
-      timestamp = ref_sbg_log.ekfNavData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_SHIP_MOTION:
-    case SBG_ECOM_LOG_SHIP_MOTION_HP:
-      timestamp = ref_sbg_log.shipMotionData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_GPS1_VEL:
-    case SBG_ECOM_LOG_GPS2_VEL:
-      timestamp = ref_sbg_log.gpsVelData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_GPS1_POS:
-    case SBG_ECOM_LOG_GPS2_POS:
-      timestamp = ref_sbg_log.gpsPosData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_GPS1_HDT:
-    case SBG_ECOM_LOG_GPS2_HDT:
-      timestamp = ref_sbg_log.gpsHdtData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_ODO_VEL:
-      timestamp = ref_sbg_log.odometerData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_EVENT_A:
-    case SBG_ECOM_LOG_EVENT_B:
-    case SBG_ECOM_LOG_EVENT_C:
-    case SBG_ECOM_LOG_EVENT_D:
-    case SBG_ECOM_LOG_EVENT_E:
-    case SBG_ECOM_LOG_EVENT_OUT_A:
-    case SBG_ECOM_LOG_EVENT_OUT_B:
-      timestamp = ref_sbg_log.eventMarker.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_DVL_BOTTOM_TRACK:
-    case SBG_ECOM_LOG_DVL_WATER_TRACK:
-      timestamp = ref_sbg_log.dvlData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_GPS1_RAW:
-    case SBG_ECOM_LOG_GPS2_RAW:
-      timestamp = 0;
-      break;
-
-    case SBG_ECOM_LOG_AIR_DATA:
-      timestamp = ref_sbg_log.airData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_USBL:
-      timestamp = ref_sbg_log.usblData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_IMU_SHORT:
-      timestamp = ref_sbg_log.imuShort.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_DEPTH:
-      timestamp = ref_sbg_log.depthData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_DIAG:
-      timestamp = ref_sbg_log.diagData.timestamp;
-      break;
-
-    case SBG_ECOM_LOG_RTCM_RAW:
-      timestamp = 0;
-      break;
-
-    case SBG_ECOM_LOG_GPS1_SAT:
-    case SBG_ECOM_LOG_GPS2_SAT:
-      timestamp = ref_sbg_log.satGroupData.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_EKF_ROT_ACCEL_BODY:
-    case SBG_ECOM_LOG_EKF_ROT_ACCEL_NED:
-      timestamp = ref_sbg_log.ekfRotAccel.timeStamp;
-      break;
-
-    case SBG_ECOM_LOG_EKF_VEL_BODY:
-      timestamp = ref_sbg_log.ekfVelBody.timeStamp;
-      break;
+      timestamp = ref_log_handlers.timestamp_function(ref_sbg_log);
     }
   }
-  else
-  {
-    timestamp = 0;
-  }
 
   return timestamp;
 }
@@ -0,0 +1,169 @@
+// File header
+#include "sbg_autobaud.h"
+
+// STL headers
+#include <chrono>
+#include <cstring>
+
+using sbg::SbgAutobaud;
+
+/*!
+ * Number of valid frames telling the baud rate.
+ */
+#define SBG_AUTOBAUD_NR_FRAMES                              (2)
+
+//---------------------------------------------------------------------//
+//- Constructor                                                       -//
+//---------------------------------------------------------------------//
+
+SbgAutobaud::SbgAutobaud(SbgInterface &ref_interface, uint32_t listen_time_ms):
+ref_interface_(ref_interface),
+listen_time_ms_(listen_time_ms),
+buffer_(2 * SBG_ECOM_MAX_BUFFER_SIZE)
+{
+
+}
+
+//---------------------------------------------------------------------//
+//- Private  methods                                                  -//
+//---------------------------------------------------------------------//
+
+uint32_t SbgAutobaud::countValidFrames(const uint8_t *p_buffer, size_t size, size_t &ref_consumed)
+{
+  uint32_t  nr_frames;
+  size_t    index;
+
+  nr_frames = 0;
+  index     = 0;
+
+  while ((index + 1) < size)
+  {
+    if ((p_buffer[index] == SBG_ECOM_SYNC_1) && (p_buffer[index + 1] == SBG_ECOM_SYNC_2))
+    {
+      size_t payload_size;
+
+      if ((size - index) < 6)
+      {
+        break;
+      }
+
+      payload_size = p_buffer[index + 4] | (p_buffer[index + 5] << 8);
+
+      if (payload_size <= SBG_ECOM_MAX_PAYLOAD_SIZE)
+      {
+        if ((size - index) < (payload_size + 9))
+        {
+          break;
+        }
+
+        //
+        // The CRC spans from the header (excluding the SYNC bytes) up to the CRC bytes.
+        //
+        if ((p_buffer[index + payload_size + 8] == SBG_ECOM_ETX) &&
+            (sbgCrc16Compute(&p_buffer[index + 2], payload_size + 4) == (p_buffer[index + payload_size + 6] | (p_buffer[index + payload_size + 7] << 8))))
+        {
+          nr_frames++;
+          index += payload_size + 9;
+          continue;
+        }
+      }
+    }
+
+    index++;
+  }
+
+  //
+  // Keep a trailing first SYNC byte, it may start a frame.
+  //
+  if ((index == (size - 1)) && (p_buffer[index] != SBG_ECOM_SYNC_1))
+  {
+    index++;
+  }
+
+  ref_consumed = index;
+
+  return nr_frames;
+}
+
+uint32_t SbgAutobaud::listen(uint32_t baud_rate, size_t &ref_nr_bytes)
+{
+  std::chrono::steady_clock::time_point deadline;
+  uint32_t                              nr_frames;
+  size_t                                size;
+
+  nr_frames     = 0;
+  size          = 0;
+  ref_nr_bytes  = 0;
+
+  if (sbgInterfaceSetSpeed(&ref_interface_, baud_rate) != SBG_NO_ERROR)
+  {
+    return 0;
+  }
+
+  sbgInterfaceFlush(&ref_interface_, SBG_IF_FLUSH_INPUT);
+
+  deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(listen_time_ms_);
+
+  //
+  // Two valid frames are enough to tell the baud rate, the remaining time is only spent on a device
+  // with a low output rate.
+  //
+  while (nr_frames < SBG_AUTOBAUD_NR_FRAMES)
+  {
+    std::chrono::steady_clock::time_point now;
+    size_t                                nr_read_bytes;
+    size_t                                consumed;
+
+    now = std::chrono::steady_clock::now();
+
+    if (now >= deadline)
+    {
+      break;
+    }
+
+    if (sbgInterfaceWaitReadable(&ref_interface_, static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count()) + 1) == SBG_INVALID_PARAMETER)
+    {
+      sbgSleep(1);
+    }
+
+    if (sbgInterfaceRead(&ref_interface_, &buffer_[size], &nr_read_bytes, buffer_.size() - size) == SBG_NO_ERROR)
+    {
+      ref_nr_bytes  += nr_read_bytes;
+      size          += nr_read_bytes;
+
+      nr_frames += countValidFrames(buffer_.data(), size, consumed);
+
+      memmove(buffer_.data(), &buffer_[consumed], size - consumed);
+      size -= consumed;
+    }
+  }
+
+  return nr_frames;
+}
+
+//---------------------------------------------------------------------//
+//- Operations                                                        -//
+//---------------------------------------------------------------------//
+
+SbgAutobaud::Result SbgAutobaud::detect(const std::vector<uint32_t> &ref_baud_rates, uint32_t &ref_baud_rate)
+{
+  for (size_t i = 0; i < ref_baud_rates.size(); i++)
+  {
+    size_t nr_bytes;
+
+    if (listen(ref_baud_rates[i], nr_bytes) >= SBG_AUTOBAUD_NR_FRAMES)
+    {
+      ref_baud_rate = ref_baud_rates[i];
+      return Result::DETECTED;
+    }
+    else if ((i == 0) && (nr_bytes == 0))
+    {
+      //
+      // At a wrong baud rate, a streaming device still produces bytes.
+      //
+      return Result::SILENT;
+    }
+  }
+
+  return Result::NOT_FOUND;
+}
@@ -0,0 +1,252 @@
+// File header
+#include "sbg_clock_sync.h"
+
+// STL headers
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+using sbg::SbgClockSync;
+
+/*!
+ * Device time spanned by a window, in us.
+ */
+#define SBG_CLOCK_SYNC_WINDOW_US                            (1000000)
+
+/*!
+ * Number of windows the fit is computed over.
+ */
+#define SBG_CLOCK_SYNC_NR_WINDOWS                           (16)
+
+/*!
+ * Nominal rate, in host ns per device us.
+ */
+#define SBG_CLOCK_SYNC_NOMINAL_RATE                         (1000.0)
+
+/*!
+ * Maximum drift between both clocks, in ppm.
+ */
+#define SBG_CLOCK_SYNC_MAX_DRIFT_PPM                        (500.0)
+
+/*!
+ * Distance to the fit restarting the synchronization, in ns.
+ */
+#define SBG_CLOCK_SYNC_RESTART_NS                           (500000000ll)
+
+//---------------------------------------------------------------------//
+//- Constructor                                                       -//
+//---------------------------------------------------------------------//
+
+SbgClockSync::SbgClockSync():
+started_(false),
+last_timestamp_(0),
+device_time_us_(0),
+origin_device_time_us_(0),
+origin_host_time_ns_(0),
+origin_real_time_ns_(0),
+real_time_offset_ns_(0),
+rate_(SBG_CLOCK_SYNC_NOMINAL_RATE),
+window_min_{0, 0},
+window_min_residual_ns_(std::numeric_limits<int64_t>::max()),
+window_start_device_time_us_(0),
+window_mins_(SBG_CLOCK_SYNC_NR_WINDOWS),
+nr_window_mins_(0),
+window_index_(0)
+{
+
+}
+
+//---------------------------------------------------------------------//
+//- Private  methods                                                  -//
+//---------------------------------------------------------------------//
+
+int64_t SbgClockSync::unwrapTimestamp(uint32_t timestamp) const
+{
+  //
+  // Logs are slightly out of order, the signed difference handles both older logs and the counter wrap.
+  //
+  return device_time_us_ + static_cast<int32_t>(timestamp - last_timestamp_);
+}
+
+int64_t SbgClockSync::toHostMonotonicTime(int64_t device_time_us) const
+{
+  return origin_host_time_ns_ + static_cast<int64_t>(rate_ * (device_time_us - origin_device_time_us_));
+}
+
+void SbgClockSync::restart(const Sample &ref_sample)
+{
+  rate_                         = SBG_CLOCK_SYNC_NOMINAL_RATE;
+  nr_window_mins_               = 0;
+  window_index_                 = 0;
+  window_min_                   = ref_sample;
+  window_min_residual_ns_       = 0;
+  window_start_device_time_us_  = ref_sample.device_time_us;
+
+  setOrigin(ref_sample.device_time_us, ref_sample.host_time_ns);
+}
+
+void SbgClockSync::setOrigin(int64_t device_time_us, int64_t host_time_ns)
+{
+  origin_device_time_us_  = device_time_us;
+  origin_host_time_ns_    = host_time_ns;
+  origin_real_time_ns_    = host_time_ns + real_time_offset_ns_;
+}
+
+void SbgClockSync::fit()
+{
+  const Sample  &ref_last = window_mins_[(window_index_ + SBG_CLOCK_SYNC_NR_WINDOWS - 1) % SBG_CLOCK_SYNC_NR_WINDOWS];
+  double        mean_x;
+  double        mean_y;
+  double        sxx;
+  double        sxy;
+  double        rate;
+  double        intercept;
+
+  if (nr_window_mins_ < 2)
+  {
+    setOrigin(ref_last.device_time_us, ref_last.host_time_ns);
+    return;
+  }
+
+  //
+  // Least squares over the window minimums, relative to the last one to keep the full double precision.
+  //
+  mean_x  = 0.0;
+  mean_y  = 0.0;
+
+  for (size_t i = 0; i < nr_window_mins_; i++)
+  {
+    mean_x += static_cast<double>(window_mins_[i].device_time_us - ref_last.device_time_us);
+    mean_y += static_cast<double>(window_mins_[i].host_time_ns - ref_last.host_time_ns);
+  }
+
+  mean_x /= nr_window_mins_;
+  mean_y /= nr_window_mins_;
+
+  sxx = 0.0;
+  sxy = 0.0;
+
+  for (size_t i = 0; i < nr_window_mins_; i++)
+  {
+    double dx = static_cast<double>(window_mins_[i].device_time_us - ref_last.device_time_us) - mean_x;
+    double dy = static_cast<double>(window_mins_[i].host_time_ns - ref_last.host_time_ns) - mean_y;
+
+    sxx += dx * dx;
+    sxy += dx * dy;
+  }
+
+  if (sxx > 0.0)
+  {
+    rate = std::min(std::max(sxy / sxx, SBG_CLOCK_SYNC_NOMINAL_RATE * (1.0 - SBG_CLOCK_SYNC_MAX_DRIFT_PPM * 1e-6)),
+                    SBG_CLOCK_SYNC_NOMINAL_RATE * (1.0 + SBG_CLOCK_SYNC_MAX_DRIFT_PPM * 1e-6));
+  }
+  else
+  {
+    rate = rate_;
+  }
+
+  //
+  // The line is then lowered onto the earliest arrival, as reading delays only add to the host time.
+  //
+  intercept = std::numeric_limits<double>::max();
+
+  for (size_t i = 0; i < nr_window_mins_; i++)
+  {
+    intercept = std::min(intercept, static_cast<double>(window_mins_[i].host_time_ns - ref_last.host_time_ns) - rate * static_cast<double>(window_mins_[i].device_time_us - ref_last.device_time_us));
+  }
+
+  rate_ = rate;
+  setOrigin(ref_last.device_time_us, ref_last.host_time_ns + static_cast<int64_t>(intercept));
+}
+
+//---------------------------------------------------------------------//
+//- Parameters                                                        -//
+//---------------------------------------------------------------------//
+
+bool SbgClockSync::isValid() const
+{
+  return nr_window_mins_ != 0;
+}
+
+double SbgClockSync::getDrift() const
+{
+  return (rate_ / SBG_CLOCK_SYNC_NOMINAL_RATE - 1.0) * 1e6;
+}
+
+//---------------------------------------------------------------------//
+//- Operations                                                        -//
+//---------------------------------------------------------------------//
+
+bool SbgClockSync::update(uint32_t timestamp, int64_t monotonic_time_ns, int64_t real_time_ns)
+{
+  Sample  sample;
+  int64_t residual_ns;
+
+  real_time_offset_ns_ = real_time_ns - monotonic_time_ns;
+
+  if (!started_)
+  {
+    started_          = true;
+    last_timestamp_   = timestamp;
+    device_time_us_   = timestamp;
+
+    restart({device_time_us_, monotonic_time_ns});
+    return true;
+  }
+
+  sample.device_time_us = unwrapTimestamp(timestamp);
+  sample.host_time_ns   = monotonic_time_ns;
+
+  if (sample.device_time_us > device_time_us_)
+  {
+    device_time_us_ = sample.device_time_us;
+    last_timestamp_ = timestamp;
+  }
+
+  residual_ns = sample.host_time_ns - toHostMonotonicTime(sample.device_time_us);
+
+  if (std::llabs(residual_ns) > SBG_CLOCK_SYNC_RESTART_NS)
+  {
+    device_time_us_ = timestamp;
+    last_timestamp_ = timestamp;
+    sample.device_time_us = device_time_us_;
+
+    restart(sample);
+    return true;
+  }
+
+  //
+  // An arrival earlier than the fit means the fit is late, lower it at once.
+  //
+  if (residual_ns < 0)
+  {
+    origin_host_time_ns_ += residual_ns;
+  }
+
+  origin_real_time_ns_ = origin_host_time_ns_ + real_time_offset_ns_;
+
+  if (residual_ns < window_min_residual_ns_)
+  {
+    window_min_             = sample;
+    window_min_residual_ns_ = residual_ns;
+  }
+
+  if ((sample.device_time_us - window_start_device_time_us_) >= SBG_CLOCK_SYNC_WINDOW_US)
+  {
+    window_mins_[window_index_] = window_min_;
+    window_index_               = (window_index_ + 1) % SBG_CLOCK_SYNC_NR_WINDOWS;
+    nr_window_mins_             = std::min(nr_window_mins_ + 1, static_cast<size_t>(SBG_CLOCK_SYNC_NR_WINDOWS));
+
+    fit();
+
+    window_min_residual_ns_       = std::numeric_limits<int64_t>::max();
+    window_start_device_time_us_  = sample.device_time_us;
+  }
+
+  return false;
+}
+
+int64_t SbgClockSync::toHostTime(uint32_t timestamp) const
+{
+  return origin_real_time_ns_ + static_cast<int64_t>(rate_ * (unwrapTimestamp(timestamp) - origin_device_time_us_));
+}
@@ -2,9 +2,15 @@
 #include "sbg_device.h"
 
 // Standard headers
+#include <algorithm>
 #include <iomanip>
 #include <fstream>
 #include <ctime>
+#include <cinttypes>
+#include <cstring>
+#ifdef __linux__
+#include <pthread.h>
+#endif
 
 // SbgECom headers
 #include <version/sbgVersion.h>
@@ -13,6 +19,11 @@
 using namespace std;
 using sbg::SbgDevice;
 
+/*!
+ * Link watchdog time out used when the device outputs are unknown, in ms.
+ */
+#define SBG_DEVICE_LINK_TIMEOUT_MS                          (1000)
+
 // From ros_com/recorder
 std::string timeToStr()
 {
@@ -51,9 +62,21 @@ std::map<SbgEComMagCalibBandwidth, std::string> SbgDevice::g_mag_calib_bandwidth
 
 SbgDevice::SbgDevice(rclcpp::Node& ref_node_handle):
 ref_node_(ref_node_handle),
+serial_number_(0),
+serial_baud_rate_(0),
 mag_calibration_ongoing_(false),
 mag_calibration_done_(false),
-log_replay_last_timestamp_(0)
+replay_log_pending_(false),
+replay_ended_(false),
+log_batch_(32),
+use_reader_thread_(false),
+reader_running_(false),
+log_queue_reported_drops_(0),
+interface_reported_drops_(0),
+link_timeout_ms_(0),
+last_nr_frames_(0),
+link_lost_(false),
+link_retry_delay_ms_(0)
 {
   loadParameters();
   connect();
@@ -63,6 +86,8 @@ SbgDevice::~SbgDevice()
 {
   SbgErrorCode error_code;
 
+  stopReaderThread();
+
   error_code = sbgEComClose(&com_handle_);
 
   if (error_code != SBG_NO_ERROR)
@@ -82,7 +107,7 @@ SbgDevice::~SbgDevice()
 //- Private  methods                                                  -//
 //---------------------------------------------------------------------//
 
-SbgErrorCode SbgDevice::onLogReceivedCallback(SbgEComHandle* p_handle, SbgEComClass msg_class, SbgEComMsgId msg, const SbgEComLogUnion* p_log_data, void* p_user_arg)
+SbgErrorCode SbgDevice::onLogReceivedCallback(SbgEComHandle* p_handle, SbgEComClass msg_class, SbgEComMsgId msg, const SbgEComLogUnion* p_log_data, const SbgInterfaceTimestamp* p_arrival_time, void* p_user_arg)
 {
   assert(p_user_arg);
 
@@ -91,40 +116,555 @@ SbgErrorCode SbgDevice::onLogReceivedCallback(SbgEComHandle* p_handle, SbgEComCl
   SbgDevice *p_sbg_device;
   p_sbg_device = (SbgDevice*)(p_user_arg);
 
-  p_sbg_device->onLogReceived(msg_class, msg, *p_log_data);
+  p_sbg_device->onLogReceived(msg_class, msg, *p_log_data, *p_arrival_time);
 
   return SBG_NO_ERROR;
 }
 
-void SbgDevice::onLogReceived(SbgEComClass msg_class, SbgEComMsgId msg, const SbgEComLogUnion& ref_sbg_data)
+void SbgDevice::onLogReceived(SbgEComClass msg_class, SbgEComMsgId msg, const SbgEComLogUnion& ref_sbg_data, const SbgInterfaceTimestamp& ref_arrival_time)
 {
-  //
-  // If Sbg driver is reading from file
-  //
   if (config_store_.isInterfaceFile())
   {
-    uint32_t time_to_sleep = 0;
-    uint32_t timestamp = message_publisher_.getTimestamp(msg_class, msg, ref_sbg_data);
-
     //
-    // GPS Raw logs don't contain timestamp as the other structures
+    // Replayed logs are held until the replay scheduler reports them as due.
     //
-    if (timestamp > log_replay_last_timestamp_)
+    replay_log_.msg_class     = msg_class;
+    replay_log_.msg_id        = msg;
+    replay_log_.log_data      = ref_sbg_data;
+    replay_log_.arrival_time  = ref_arrival_time;
+    replay_log_pending_       = true;
+  }
+  else
+  {
+    //
+    // Publish the received SBG log.
+    //
+    message_publisher_.publish(msg_class, msg, ref_sbg_data, ref_arrival_time);
+  }
+}
+
+void SbgDevice::onLogBatchReceivedCallback(SbgEComHandle* p_handle, const SbgEComLogBatchEntry* p_entries, size_t nr_entries, void* p_user_arg)
+{
+  assert(p_user_arg);
+
+  SBG_UNUSED_PARAMETER(p_handle);
+
+  SbgDevice *p_sbg_device;
+  p_sbg_device = (SbgDevice*)(p_user_arg);
+
+  p_sbg_device->onLogBatchReceived(p_entries, nr_entries);
+}
+
+void SbgDevice::onLogBatchReceived(const SbgEComLogBatchEntry* p_entries, size_t nr_entries)
+{
+  if (log_queue_)
+  {
+    ReceivedLog received_log;
+
+    for (size_t i = 0; i < nr_entries; i++)
+    {
+      received_log.msg_class    = p_entries[i].msgClass;
+      received_log.msg_id       = p_entries[i].msgId;
+      received_log.log_data     = p_entries[i].logData;
+      received_log.arrival_time = p_entries[i].arrivalTime;
+
+      log_queue_->push(received_log);
+    }
+
+    log_queue_cv_.notify_one();
+  }
+  else
+  {
+    for (size_t i = 0; i < nr_entries; i++)
+    {
+      onLogReceived(p_entries[i].msgClass, p_entries[i].msgId, p_entries[i].logData, p_entries[i].arrivalTime);
+    }
+  }
+}
+
+void SbgDevice::startReaderThread()
+{
+  if (use_reader_thread_)
+  {
+    log_queue_.reset(new SbgSpscRing<ReceivedLog>(config_store_.getReaderQueueSize()));
+
+    reader_running_ = true;
+    reader_thread_  = std::thread(&SbgDevice::readerThreadLoop, this);
+
+#ifdef __linux__
+    if (config_store_.getReaderThreadCpu() >= 0)
     {
-      if (log_replay_last_timestamp_ != 0)
+      cpu_set_t cpu_set;
+      int       ret;
+
+      CPU_ZERO(&cpu_set);
+      CPU_SET(config_store_.getReaderThreadCpu(), &cpu_set);
+
+      ret = pthread_setaffinity_np(reader_thread_.native_handle(), sizeof(cpu_set), &cpu_set);
+
+      if (ret != 0)
       {
-        time_to_sleep = timestamp - log_replay_last_timestamp_;
+        RCLCPP_WARN(ref_node_.get_logger(), "SBG DRIVER [Init] - Unable to pin the reader thread to CPU %d: %s", config_store_.getReaderThreadCpu(), strerror(ret));
       }
-      log_replay_last_timestamp_ = timestamp;
     }
+#endif
+
+    RCLCPP_INFO(ref_node_.get_logger(), "SBG DRIVER [Init] - Device read from a dedicated thread, queue size: %zu", log_queue_->getCapacity());
+  }
+}
+
+void SbgDevice::stopReaderThread()
+{
+  if (reader_thread_.joinable())
+  {
+    reader_running_ = false;
+    reader_thread_.join();
+  }
+}
+
+void SbgDevice::readerThreadLoop()
+{
+  uint32_t loop_period_ms;
+
+  loop_period_ms = std::max(1000 / rate_frequency_, 1u);
+
+  while (reader_running_)
+  {
+    sbgEComHandleBatch(&com_handle_, log_batch_.data(), log_batch_.size());
+    reportInterfaceDrops();
+    checkLink();
+
+    if (!waitForDeviceData(loop_period_ms))
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(loop_period_ms));
+    }
+  }
+}
+
+void SbgDevice::drainLogQueue()
+{
+  ReceivedLog received_log;
+  uint64_t    drop_count;
 
-    usleep(time_to_sleep);
+  while (log_queue_->pop(received_log))
+  {
+    onLogReceived(received_log.msg_class, received_log.msg_id, received_log.log_data, received_log.arrival_time);
   }
 
+  drop_count = log_queue_->getDropCount();
+
+  if (drop_count != log_queue_reported_drops_)
+  {
+    RCLCPP_WARN_THROTTLE(ref_node_.get_logger(), *ref_node_.get_clock(), 1000, "SBG DRIVER - %" PRIu64 " logs dropped, publishing can't keep up with the device.", drop_count);
+    log_queue_reported_drops_ = drop_count;
+  }
+}
+
+void SbgDevice::initReplay()
+{
+  replay_scheduler_.setRate(config_store_.getReplayRate());
+  replay_scheduler_.setPaused(config_store_.isReplayStartPaused());
+
+  replay_pause_service_ = ref_node_.create_service<std_srvs::srv::SetBool>("sbg/replay_pause", std::bind(&SbgDevice::processReplayPause, this, std::placeholders::_1, std::placeholders::_2));
+  replay_step_service_  = ref_node_.create_service<std_srvs::srv::Trigger>("sbg/replay_step", std::bind(&SbgDevice::processReplayStep, this, std::placeholders::_1, std::placeholders::_2));
+
+  if (config_store_.shouldPublishReplayClock())
+  {
+    clock_pub_ = ref_node_.create_publisher<rosgraph_msgs::msg::Clock>("/clock", 10);
+  }
+
+  if (replay_scheduler_.getRate() > 0.0)
+  {
+    RCLCPP_INFO(ref_node_.get_logger(), "SBG DRIVER [Init] - Log file replayed at %.2fx real time%s", replay_scheduler_.getRate(), replay_scheduler_.isPaused() ? ", paused" : "");
+  }
+  else
+  {
+    RCLCPP_INFO(ref_node_.get_logger(), "SBG DRIVER [Init] - Log file replayed as fast as possible%s", replay_scheduler_.isPaused() ? ", paused" : "");
+  }
+}
+
+void SbgDevice::handleReplay()
+{
+  std::lock_guard<std::mutex>  lock(replay_mutex_);
+  SbgErrorCode                 error_code;
+  size_t                       nr_published;
+  uint32_t                     timestamp;
+
+  nr_published = 0;
+
   //
-  // Publish the received SBG log.
+  // Publish at most a batch of logs per call, so that ROS callbacks are still processed when replaying as fast as possible.
   //
-  message_publisher_.publish(msg_class, msg, ref_sbg_data);
+  while (nr_published < log_batch_.size())
+  {
+    if (!replay_log_pending_)
+    {
+      //
+      // Frames that aren't decoded are consumed without setting a pending log, keep reading.
+      //
+      error_code = sbgEComHandleOneLog(&com_handle_);
+
+      if (error_code == SBG_NOT_READY)
+      {
+        if (!replay_ended_)
+        {
+          RCLCPP_INFO(ref_node_.get_logger(), "SBG DRIVER - End of the log file reached.");
+          replay_ended_ = true;
+        }
+
+        break;
+      }
+    }
+    else
+    {
+      timestamp = message_publisher_.getTimestamp(replay_log_.msg_class, replay_log_.msg_id, replay_log_.log_data);
+
+      if (replay_scheduler_.getDelay(timestamp, std::chrono::steady_clock::now()) != std::chrono::nanoseconds::zero())
+      {
+        break;
+      }
+
+      //
+      // Replayed logs are stamped with the replay time, they don't have a host monotonic arrival time.
+      //
+      replay_log_.arrival_time.monotonicNs  = 0;
+      replay_log_.arrival_time.realTimeNs   = replay_scheduler_.consume(timestamp).nanoseconds();
+
+      message_publisher_.publish(replay_log_.msg_class, replay_log_.msg_id, replay_log_.log_data, replay_log_.arrival_time);
+      replay_log_pending_ = false;
+      nr_published++;
+    }
+  }
+
+  if (clock_pub_ && (nr_published != 0))
+  {
+    rosgraph_msgs::msg::Clock clock_message;
+
+    clock_message.clock = replay_scheduler_.getReplayTime();
+    clock_pub_->publish(clock_message);
+  }
+}
+
+std::chrono::nanoseconds SbgDevice::getReplayDelay(uint32_t timeout_ms)
+{
+  std::lock_guard<std::mutex>  lock(replay_mutex_);
+  std::chrono::nanoseconds     delay;
+
+  if (replay_log_pending_)
+  {
+    delay = replay_scheduler_.getDelay(message_publisher_.getTimestamp(replay_log_.msg_class, replay_log_.msg_id, replay_log_.log_data), std::chrono::steady_clock::now());
+  }
+  else if (replay_ended_)
+  {
+    delay = std::chrono::milliseconds(timeout_ms);
+  }
+  else
+  {
+    delay = std::chrono::nanoseconds::zero();
+  }
+
+  return std::min(delay, std::chrono::nanoseconds(std::chrono::milliseconds(timeout_ms)));
+}
+
+bool SbgDevice::processReplayPause(const std::shared_ptr<std_srvs::srv::SetBool::Request> ref_ros_request, std::shared_ptr<std_srvs::srv::SetBool::Response> ref_ros_response)
+{
+  std::lock_guard<std::mutex> lock(replay_mutex_);
+
+  replay_scheduler_.setPaused(ref_ros_request->data);
+
+  ref_ros_response->success = true;
+  ref_ros_response->message = replay_scheduler_.isPaused() ? "Replay paused." : "Replay resumed.";
+
+  return true;
+}
+
+bool SbgDevice::processReplayStep(const std::shared_ptr<std_srvs::srv::Trigger::Request> ref_ros_request, std::shared_ptr<std_srvs::srv::Trigger::Response> ref_ros_response)
+{
+  std::lock_guard<std::mutex> lock(replay_mutex_);
+
+  SBG_UNUSED_PARAMETER(ref_ros_request);
+
+  if (replay_scheduler_.isPaused())
+  {
+    replay_scheduler_.step();
+
+    ref_ros_response->success = true;
+    ref_ros_response->message = "Replay stepped by one log.";
+  }
+  else
+  {
+    ref_ros_response->success = false;
+    ref_ros_response->message = "The replay isn't paused.";
+  }
+
+  return true;
+}
+
+void SbgDevice::reportInterfaceDrops()
+{
+  uint32_t drop_count;
+
+  if (sbg_interface_.type == SBG_IF_TYPE_ETH_UDP)
+  {
+    drop_count = sbgInterfaceUdpGetNrDrops(&sbg_interface_);
+
+    if (drop_count != interface_reported_drops_)
+    {
+      RCLCPP_WARN_THROTTLE(ref_node_.get_logger(), *ref_node_.get_clock(), 1000, "SBG DRIVER - %" PRIu32 " datagrams dropped by the kernel, consider increasing ipConf.receiveBufferSize.", drop_count);
+      interface_reported_drops_ = drop_count;
+    }
+  }
+}
+
+SbgErrorCode SbgDevice::createSerialInterface(uint32_t baud_rate)
+{
+  uint32_t options;
+
+  options = 0;
+
+  if (config_store_.isUartLowLatency())
+  {
+    options |= SBG_IF_SERIAL_LOW_LATENCY;
+  }
+
+  if (config_store_.isUartExclusive())
+  {
+    options |= SBG_IF_SERIAL_EXCLUSIVE;
+  }
+
+  serial_baud_rate_ = baud_rate;
+
+  return sbgInterfaceSerialCreateEx(&sbg_interface_, config_store_.getUartPortName().c_str(), baud_rate, options);
+}
+
+uint32_t SbgDevice::getFastestOutputPeriod() const
+{
+  uint32_t period_ms;
+
+  period_ms = 0;
+
+  for (const auto &ref_output : config_store_.getOutputModes())
+  {
+    uint32_t output_period_ms;
+
+    //
+    // Event driven outputs, such as new data or sync inputs, have no guaranteed rate.
+    //
+    if (ref_output.output_mode == SBG_ECOM_OUTPUT_MODE_DISABLED)
+    {
+      continue;
+    }
+    else if (ref_output.output_mode <= SBG_ECOM_OUTPUT_MODE_DIV_200)
+    {
+      output_period_ms = ref_output.output_mode * 5;
+    }
+    else if (ref_output.output_mode <= SBG_ECOM_OUTPUT_MODE_4_MS)
+    {
+      output_period_ms = ref_output.output_mode - 1000;
+    }
+    else if (ref_output.output_mode == SBG_ECOM_OUTPUT_MODE_PPS)
+    {
+      output_period_ms = 1000;
+    }
+    else if (ref_output.output_mode == SBG_ECOM_OUTPUT_MODE_HIGH_FREQ_LOOP)
+    {
+      output_period_ms = 1;
+    }
+    else
+    {
+      continue;
+    }
+
+    if ((period_ms == 0) || (output_period_ms < period_ms))
+    {
+      period_ms = output_period_ms;
+    }
+  }
+
+  return period_ms;
+}
+
+void SbgDevice::initLinkWatchdog()
+{
+  SbgEComProtocolStats stats;
+
+  if (!config_store_.useLinkWatchdog() || config_store_.isInterfaceFile())
+  {
+    link_timeout_ms_ = 0;
+  }
+  else if (config_store_.checkConfigWithRos())
+  {
+    uint32_t period_ms;
+
+    //
+    // A few missed periods are tolerated, the device may delay logs while processing a command.
+    //
+    period_ms         = getFastestOutputPeriod();
+    link_timeout_ms_  = (period_ms != 0) ? std::max(5 * period_ms, 200u) : 0;
+  }
+  else
+  {
+    link_timeout_ms_ = SBG_DEVICE_LINK_TIMEOUT_MS;
+  }
+
+  if (link_timeout_ms_ != 0)
+  {
+    sbgEComGetStats(&com_handle_, &stats);
+
+    last_nr_frames_   = stats.nrFrames;
+    last_frame_time_  = std::chrono::steady_clock::now();
+
+    RCLCPP_INFO(ref_node_.get_logger(), "SBG DRIVER [Init] - Link watchdog enabled, time out: %" PRIu32 " ms", link_timeout_ms_);
+  }
+}
+
+void SbgDevice::checkLink()
+{
+  std::chrono::steady_clock::time_point now;
+  SbgEComProtocolStats                  stats;
+  uint32_t                              elapsed_ms;
+
+  if (link_timeout_ms_ == 0)
+  {
+    return;
+  }
+
+  //
+  // Any valid frame proves the link is alive, whether its log is decoded and published or not.
+  //
+  now = std::chrono::steady_clock::now();
+
+  sbgEComGetStats(&com_handle_, &stats);
+
+  if (stats.nrFrames != last_nr_frames_)
+  {
+    last_nr_frames_   = stats.nrFrames;
+    last_frame_time_  = now;
+  }
+
+  elapsed_ms = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(now - last_frame_time_).count());
+
+  if (elapsed_ms < link_timeout_ms_)
+  {
+    if (link_lost_)
+    {
+      RCLCPP_INFO(ref_node_.get_logger(), "SBG DRIVER - Link restored after a %.3f s outage.", std::chrono::duration<double>(last_frame_time_ - link_lost_time_).count());
+      link_lost_ = false;
+    }
+  }
+  else if (!link_lost_)
+  {
+    RCLCPP_WARN(ref_node_.get_logger(), "SBG DRIVER - No frame received for %" PRIu32 " ms, reopening the interface.", elapsed_ms);
+
+    //
+    // The protocol resynchronizes on SYNC bytes by itself, a link without any valid frame has to be reopened.
+    //
+    link_lost_            = true;
+    link_lost_time_       = last_frame_time_;
+    link_retry_delay_ms_  = 100;
+    link_retry_time_      = now;
+  }
+  else if (now >= link_retry_time_)
+  {
+    SbgErrorCode error_code;
+
+    error_code = reopenInterface();
+
+    if (error_code != SBG_NO_ERROR)
+    {
+      RCLCPP_WARN_THROTTLE(ref_node_.get_logger(), *ref_node_.get_clock(), 5000, "SBG DRIVER - Unable to reopen the interface - %s", sbgErrorCodeToString(error_code));
+    }
+    else
+    {
+      RCLCPP_WARN_THROTTLE(ref_node_.get_logger(), *ref_node_.get_clock(), 5000, "SBG DRIVER - Link lost for %.1f s, interface reopened.", elapsed_ms / 1000.0);
+    }
+
+    //
+    // Back off exponentially, so that a disconnected device doesn't keep the interface busy.
+    //
+    link_retry_delay_ms_  = std::min(link_retry_delay_ms_ * 2, 2000u);
+    link_retry_time_      = std::chrono::steady_clock::now() + std::chrono::milliseconds(std::max(link_timeout_ms_, link_retry_delay_ms_));
+  }
+}
+
+SbgErrorCode SbgDevice::reopenInterface()
+{
+  std::lock_guard<std::mutex>  lock(interface_mutex_);
+  SbgErrorCode                 error_code;
+
+  //
+  // A destroyed interface is zeroed, reads from the protocol fail until it is created again.
+  //
+  sbgInterfaceDestroy(&sbg_interface_);
+
+  if (config_store_.isInterfaceSerial())
+  {
+    error_code = createSerialInterface(serial_baud_rate_);
+  }
+  else
+  {
+    error_code = sbgInterfaceUdpCreate(&sbg_interface_, config_store_.getIpAddress(), config_store_.getInputPortAddress(), config_store_.getOutputPortAddress());
+
+    if (error_code == SBG_NO_ERROR)
+    {
+      configureUdpInterface();
+      interface_reported_drops_ = 0;
+    }
+  }
+
+  if (error_code == SBG_NO_ERROR)
+  {
+    //
+    // Discard any partial frame received on the previous interface, without blocking the caller.
+    //
+    sbgEComProtocolClearIncoming(&com_handle_.protocolHandle);
+  }
+
+  return error_code;
+}
+
+void SbgDevice::configureUdpInterface()
+{
+  SbgErrorCode error_code;
+
+  //
+  // Socket settings only affect latency and robustness to bursts, failures are not fatal.
+  //
+  if (config_store_.getUdpReceiveBufferSize() != 0)
+  {
+    error_code = sbgInterfaceUdpSetReceiveBufferSize(&sbg_interface_, config_store_.getUdpReceiveBufferSize());
+
+    if (error_code != SBG_NO_ERROR)
+    {
+      RCLCPP_WARN(ref_node_.get_logger(), "SBG DRIVER [Init] - Unable to set the UDP receive buffer size - %s", sbgErrorCodeToString(error_code));
+    }
+  }
+
+  if (config_store_.getUdpBusyPoll() != 0)
+  {
+    error_code = sbgInterfaceUdpSetBusyPoll(&sbg_interface_, config_store_.getUdpBusyPoll());
+
+    if (error_code != SBG_NO_ERROR)
+    {
+      RCLCPP_WARN(ref_node_.get_logger(), "SBG DRIVER [Init] - Unable to set the UDP busy polling time - %s", sbgErrorCodeToString(error_code));
+    }
+  }
+
+  error_code = sbgInterfaceUdpSetBatchSize(&sbg_interface_, config_store_.getUdpBatchSize());
+
+  if (error_code != SBG_NO_ERROR)
+  {
+    RCLCPP_WARN(ref_node_.get_logger(), "SBG DRIVER [Init] - Unable to enable batched UDP reception - %s", sbgErrorCodeToString(error_code));
+  }
+}
+
+bool SbgDevice::waitForDeviceData(uint32_t timeout_ms)
+{
+  SbgErrorCode error_code;
+
+  error_code = sbgEComProtocolWaitReadable(&com_handle_.protocolHandle, timeout_ms);
+
+  return (error_code == SBG_NO_ERROR) || (error_code == SBG_TIME_OUT);
 }
 
 void SbgDevice::loadParameters()
@@ -136,12 +676,26 @@ void SbgDevice::loadParameters()
   node_opt.automatically_declare_parameters_from_overrides(true);
   rclcpp::Node n_private("npv", "", node_opt);
   config_store_.loadFromRosNodeHandle(n_private);
+
+  use_reader_thread_ = config_store_.useReaderThread();
+
+  if (use_reader_thread_ && config_store_.isInterfaceFile())
+  {
+    //
+    // Log replay is paced by the publishing side, reading ahead would only fill the queue and drop logs.
+    //
+    RCLCPP_WARN(ref_node_.get_logger(), "SBG DRIVER [Init] - The reader thread isn't used to replay a log file.");
+    use_reader_thread_ = false;
+  }
 }
 
 void SbgDevice::connect()
 {
-  SbgErrorCode error_code;
-  error_code = SBG_NO_ERROR;
+  SbgErrorCode        error_code;
+  SbgAutobaud::Result autobaud_result;
+
+  error_code      = SBG_NO_ERROR;
+  autobaud_result = SbgAutobaud::Result::SILENT;
 
   //
   // Initialize the communication interface from the config store, then initialize the sbgECom protocol to communicate with the device.
@@ -149,7 +703,12 @@ void SbgDevice::connect()
   if (config_store_.isInterfaceSerial())
   {
     RCLCPP_INFO(ref_node_.get_logger(), "SBG_DRIVER - serial interface %s at %d bps", config_store_.getUartPortName().c_str(), config_store_.getBaudRate());
-    error_code = sbgInterfaceSerialCreate(&sbg_interface_, config_store_.getUartPortName().c_str(), config_store_.getBaudRate());
+    error_code = createSerialInterface(config_store_.getBaudRate());
+
+    if (error_code == SBG_NO_ERROR)
+    {
+      autobaud_result = detectBaudRate();
+    }
   }
   else if (config_store_.isInterfaceUdp())
   {
@@ -157,10 +716,15 @@ void SbgDevice::connect()
     sbgNetworkIpToString(config_store_.getIpAddress(), ip, sizeof(ip));
     RCLCPP_INFO(ref_node_.get_logger(), "SBG_DRIVER - UDP interface %s %d->%d", ip, config_store_.getInputPortAddress(), config_store_.getOutputPortAddress());
     error_code = sbgInterfaceUdpCreate(&sbg_interface_, config_store_.getIpAddress(), config_store_.getInputPortAddress(), config_store_.getOutputPortAddress());
+
+    if (error_code == SBG_NO_ERROR)
+    {
+      configureUdpInterface();
+    }
   }
   else if (config_store_.isInterfaceFile())
   {
-    error_code = sbgInterfaceFileOpen(&sbg_interface_, config_store_.getFile().c_str());
+    error_code = sbgInterfaceFileMapOpen(&sbg_interface_, config_store_.getFile().c_str());
   }
   else
   {
@@ -184,24 +748,103 @@ void SbgDevice::connect()
     error_code = readDeviceInfo();
   }
 
-  if (error_code == SBG_NO_ERROR)
+  if (error_code == SBG_TIME_OUT && config_store_.isInterfaceSerial() && autobaud_result != SbgAutobaud::Result::DETECTED)
   {
-    return;
+    // readDeviceInfo() not successful - the device doesn't output logs, and the baudrate configured
+    // on the device could be different from the one configured in the config file. Retry with different baudrates.
+    error_code = findCurrentDeviceBaudrate();
   }
 
-  if (error_code == SBG_TIME_OUT && config_store_.isInterfaceSerial())
+  if (error_code == SBG_NO_ERROR && config_store_.isInterfaceSerial())
   {
-    // readDeviceInfo() not successful - error could be that the baudrate configured on the device
-    // is different from the one configured in the config file. Retry with different baudrates.
-    error_code = findCurrentDeviceBaudrate();
-
-    if (error_code == SBG_NO_ERROR && config_store_.checkConfigWithRos())
+    if (serial_baud_rate_ != config_store_.getBaudRate() && config_store_.checkConfigWithRos())
     {
       setDeviceBaudrate();
     }
+
+    if (!config_store_.getConfigCacheDirectory().empty())
+    {
+      ConfigCache config_cache(config_store_.getConfigCacheDirectory());
+      uint32_t    cached_baud_rate;
+
+      if (!config_cache.getBaudRate(config_store_.getUartPortName(), cached_baud_rate) || cached_baud_rate != serial_baud_rate_)
+      {
+        config_cache.updateBaudRate(config_store_.getUartPortName(), serial_baud_rate_);
+      }
+    }
   }
 }
 
+std::vector<uint32_t> SbgDevice::getCandidateBaudRates() const
+{
+  //
+  // Standard device baud rates, the factory default first.
+  //
+  static const uint32_t   standard_baud_rates[] = { 115200, 921600, 460800, 230400, 57600, 38400, 19200, 9600, 4800 };
+  std::vector<uint32_t>   baud_rates;
+  uint32_t                cached_baud_rate;
+
+  auto add_baud_rate = [&baud_rates](int64_t baud_rate)
+  {
+    // Baudrate should be an uint32 but rclcpp only support int64 vectors
+    if (baud_rate > 0 && baud_rate <= UINT32_MAX && std::find(baud_rates.begin(), baud_rates.end(), baud_rate) == baud_rates.end())
+    {
+      baud_rates.push_back(static_cast<uint32_t>(baud_rate));
+    }
+  };
+
+  if (!config_store_.getConfigCacheDirectory().empty() && ConfigCache(config_store_.getConfigCacheDirectory()).getBaudRate(config_store_.getUartPortName(), cached_baud_rate))
+  {
+    add_baud_rate(cached_baud_rate);
+  }
+
+  add_baud_rate(config_store_.getBaudRate());
+
+  for (const auto br : config_store_.getFallbackBaudRates())
+  {
+    add_baud_rate(br);
+  }
+
+  for (const auto br : standard_baud_rates)
+  {
+    add_baud_rate(br);
+  }
+
+  return baud_rates;
+}
+
+SbgAutobaud::Result SbgDevice::detectBaudRate()
+{
+  SbgAutobaud         autobaud(sbg_interface_, 100);
+  SbgAutobaud::Result result;
+  uint32_t            baud_rate;
+
+  result = autobaud.detect(getCandidateBaudRates(), baud_rate);
+
+  if (result == SbgAutobaud::Result::DETECTED)
+  {
+    RCLCPP_INFO(ref_node_.get_logger(), "SBG_DRIVER - [Init] Device output detected at %u bps", baud_rate);
+
+    serial_baud_rate_ = baud_rate;
+  }
+  else
+  {
+    if (result == SbgAutobaud::Result::SILENT)
+    {
+      RCLCPP_INFO(ref_node_.get_logger(), "SBG_DRIVER - [Init] No output received from the device, probing it with commands");
+    }
+    else
+    {
+      RCLCPP_WARN(ref_node_.get_logger(), "SBG_DRIVER - [Init] Unable to detect the baud rate from the device output, probing it with commands");
+    }
+
+    sbgInterfaceSetSpeed(&sbg_interface_, config_store_.getBaudRate());
+    sbgInterfaceFlush(&sbg_interface_, SBG_IF_FLUSH_INPUT);
+  }
+
+  return result;
+}
+
 SbgErrorCode SbgDevice::findCurrentDeviceBaudrate()
 {
   SbgErrorCode         error_code = SBG_ERROR;
@@ -220,7 +863,7 @@ SbgErrorCode SbgDevice::findCurrentDeviceBaudrate()
     sbgEComClose(&com_handle_);
     sbgInterfaceDestroy(&sbg_interface_);
 
-    error_code = sbgInterfaceSerialCreate(&sbg_interface_, config_store_.getUartPortName().c_str(), br);
+    error_code = createSerialInterface(br);
 
     if (error_code != SBG_NO_ERROR)
     {
@@ -276,7 +919,7 @@ void SbgDevice::setDeviceBaudrate()
   sbgEComClose(&com_handle_);
   sbgInterfaceDestroy(&sbg_interface_);
 
-  error_code = sbgInterfaceSerialCreate(&sbg_interface_, config_store_.getUartPortName().c_str(), config_store_.getBaudRate());
+  error_code = createSerialInterface(config_store_.getBaudRate());
 
   if (error_code != SBG_NO_ERROR)
   {
@@ -305,6 +948,8 @@ SbgErrorCode SbgDevice::readDeviceInfo()
     RCLCPP_INFO(ref_node_.get_logger(), "SBG_DRIVER - productCode = %s", device_info.productCode);
     RCLCPP_INFO(ref_node_.get_logger(), "SBG_DRIVER - serialNumber = %u", device_info.serialNumber);
 
+    serial_number_ = device_info.serialNumber;
+
     RCLCPP_INFO(ref_node_.get_logger(), "SBG_DRIVER - calibationRev = %s", getVersionAsString(device_info.calibationRev).c_str());
     RCLCPP_INFO(ref_node_.get_logger(), "SBG_DRIVER - calibrationDate = %u / %u / %u", device_info.calibrationDay, device_info.calibrationMonth, device_info.calibrationYear);
 
@@ -334,6 +979,52 @@ void SbgDevice::initPublishers()
   rate_frequency_ = config_store_.getReadingRateFrequency();
 }
 
+void SbgDevice::initLogDecoders()
+{
+  SbgEComLogRegistry *p_log_registry;
+
+  p_log_registry = sbgEComGetLogRegistry(&com_handle_);
+
+  sbgEComLogRegistrySetAllEnabled(p_log_registry, false);
+
+  for (const ConfigStore::SbgLogOutput &ref_output : config_store_.getOutputModes())
+  {
+    if (ref_output.output_mode != SBG_ECOM_OUTPUT_MODE_DISABLED)
+    {
+      sbgEComLogRegistryRegister(p_log_registry, ref_output.message_class, ref_output.message_id, nullptr);
+
+      //
+      // Secondary GNSS logs are published on the same topics as the primary ones.
+      //
+      if (ref_output.message_class == SBG_ECOM_CLASS_LOG_ECOM_0)
+      {
+        switch (ref_output.message_id)
+        {
+          case SBG_ECOM_LOG_GPS1_VEL:
+            sbgEComLogRegistryRegister(p_log_registry, SBG_ECOM_CLASS_LOG_ECOM_0, SBG_ECOM_LOG_GPS2_VEL, nullptr);
+            break;
+          case SBG_ECOM_LOG_GPS1_POS:
+            sbgEComLogRegistryRegister(p_log_registry, SBG_ECOM_CLASS_LOG_ECOM_0, SBG_ECOM_LOG_GPS2_POS, nullptr);
+            break;
+          case SBG_ECOM_LOG_GPS1_HDT:
+            sbgEComLogRegistryRegister(p_log_registry, SBG_ECOM_CLASS_LOG_ECOM_0, SBG_ECOM_LOG_GPS2_HDT, nullptr);
+            break;
+          case SBG_ECOM_LOG_GPS1_RAW:
+            sbgEComLogRegistryRegister(p_log_registry, SBG_ECOM_CLASS_LOG_ECOM_0, SBG_ECOM_LOG_GPS2_RAW, nullptr);
+            break;
+          default:
+            break;
+        }
+      }
+    }
+  }
+
+  //
+  // The UTC time log is always decoded as it is used to compute the INS time reference.
+  //
+  sbgEComLogRegistryRegister(p_log_registry, SBG_ECOM_CLASS_LOG_ECOM_0, SBG_ECOM_LOG_UTC_TIME, nullptr);
+}
+
 void SbgDevice::initSubscribers()
 {
   if (config_store_.shouldSubscribeToRtcm())
@@ -351,7 +1042,7 @@ void SbgDevice::configure()
   if (config_store_.checkConfigWithRos())
   {
     ConfigApplier configApplier(com_handle_);
-    configApplier.applyConfiguration(config_store_);
+    configApplier.applyConfiguration(config_store_, serial_number_);
   }
 }
 
@@ -592,6 +1283,8 @@ void SbgDevice::exportMagCalibrationResults() const
 
 void SbgDevice::writeRtcmMessageToDevice(const rtcm_msgs::msg::Message::SharedPtr msg)
 {
+  std::lock_guard<std::mutex> lock(interface_mutex_);
+
   auto rtcm_data = msg->message;
   auto error_code = sbgInterfaceWrite(&sbg_interface_, rtcm_data.data(), rtcm_data.size());
 
@@ -620,11 +1313,24 @@ uint32_t SbgDevice::getUpdateFrequency() const
 void SbgDevice::initDeviceForReceivingData()
 {
   initPublishers();
+  initLogDecoders();
   configure();
 
-  sbgEComSetReceiveLogCallback(&com_handle_, onLogReceivedCallback, this);
+  //
+  // Logs are received by batch, the single log callback handles logs received while waiting for a command answer.
+  //
+  sbgEComSetReceiveLogCallback2(&com_handle_, onLogReceivedCallback, this);
+  sbgEComSetReceiveLogBatchCallback(&com_handle_, onLogBatchReceivedCallback, this);
 
   initSubscribers();
+
+  if (config_store_.isInterfaceFile())
+  {
+    initReplay();
+  }
+
+  initLinkWatchdog();
+  startReaderThread();
 }
 
 void SbgDevice::initDeviceForMagCalibration()
@@ -637,5 +1343,45 @@ void SbgDevice::initDeviceForMagCalibration()
 
 void SbgDevice::periodicHandle()
 {
-  sbgEComHandle(&com_handle_);
+  if (log_queue_)
+  {
+    drainLogQueue();
+  }
+  else if (config_store_.isInterfaceFile())
+  {
+    handleReplay();
+  }
+  else
+  {
+    sbgEComHandleBatch(&com_handle_, log_batch_.data(), log_batch_.size());
+    reportInterfaceDrops();
+    checkLink();
+  }
+}
+
+bool SbgDevice::waitForData(uint32_t timeout_ms)
+{
+  bool data_ready;
+
+  if (log_queue_)
+  {
+    std::unique_lock<std::mutex> lock(log_queue_mutex_);
+
+    //
+    // The reader thread notifies without holding the mutex, a missed notification only delays publishing up to the time out.
+    //
+    log_queue_cv_.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this]{ return !log_queue_->isEmpty(); });
+    data_ready = true;
+  }
+  else if (config_store_.isInterfaceFile())
+  {
+    std::this_thread::sleep_for(getReplayDelay(timeout_ms));
+    data_ready = true;
+  }
+  else
+  {
+    data_ready = waitForDeviceData(timeout_ms);
+  }
+
+  return data_ready;
 }
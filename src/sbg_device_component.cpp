@@ -0,0 +1,77 @@
+// File header
+#include "sbg_device_component.h"
+
+// STL headers
+#include <algorithm>
+
+// ROS headers
+#include <rclcpp_components/register_node_macro.hpp>
+
+using sbg::SbgDeviceComponent;
+
+//---------------------------------------------------------------------//
+//- Constructor                                                       -//
+//---------------------------------------------------------------------//
+
+SbgDeviceComponent::SbgDeviceComponent(const rclcpp::NodeOptions &ref_options):
+rclcpp::Node("sbg_device", ref_options),
+device_running_(false)
+{
+  RCLCPP_INFO(get_logger(), "SBG DRIVER - Init component, load params and connect to the device.");
+  sbg_device_.reset(new SbgDevice(*this));
+
+  RCLCPP_INFO(get_logger(), "SBG DRIVER - Initialize device for receiving data");
+  sbg_device_->initDeviceForReceivingData();
+
+  device_running_ = true;
+  device_thread_  = std::thread(&SbgDeviceComponent::deviceLoop, this);
+}
+
+SbgDeviceComponent::~SbgDeviceComponent()
+{
+  if (device_thread_.joinable())
+  {
+    device_running_ = false;
+    device_thread_.join();
+  }
+}
+
+//---------------------------------------------------------------------//
+//- Private  methods                                                  -//
+//---------------------------------------------------------------------//
+
+void SbgDeviceComponent::deviceLoop()
+{
+  uint32_t loop_frequency;
+  uint32_t loop_period_ms;
+
+  loop_frequency  = sbg_device_->getUpdateFrequency();
+  loop_period_ms  = std::max(1000 / loop_frequency, 1u);
+
+  RCLCPP_INFO(get_logger(), "SBG DRIVER - ROS Node frequency : %u Hz", loop_frequency);
+
+  //
+  // Same loop as the sbg_device executable, ROS callbacks are processed by the container executor.
+  // An exception only stops this device, the other nodes of the container keep running.
+  //
+  try
+  {
+    while (device_running_ && rclcpp::ok(get_node_options().context()))
+    {
+      sbg_device_->periodicHandle();
+
+      if (!sbg_device_->waitForData(loop_period_ms))
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(loop_period_ms));
+      }
+    }
+  }
+  catch (std::exception const& refE)
+  {
+    RCLCPP_ERROR(get_logger(), "SBG_DRIVER - %s", refE.what());
+  }
+
+  device_running_ = false;
+}
+
+RCLCPP_COMPONENTS_REGISTER_NODE(sbg::SbgDeviceComponent)
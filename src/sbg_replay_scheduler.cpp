@@ -0,0 +1,217 @@
+// File header
+#include "sbg_replay_scheduler.h"
+
+// STL headers
+#include <algorithm>
+
+using sbg::SbgReplayScheduler;
+
+/*!
+ * Maximum backward jump of the device time stamp between logs, as logs are slightly out of order, in us.
+ */
+#define SBG_REPLAY_SCHEDULER_MAX_BACKWARD_US                (1000000)
+
+/*!
+ * Maximum forward jump of the device time stamp between logs, in us.
+ */
+#define SBG_REPLAY_SCHEDULER_MAX_FORWARD_US                 (5000000)
+
+//---------------------------------------------------------------------//
+//- Constructor                                                       -//
+//---------------------------------------------------------------------//
+
+SbgReplayScheduler::SbgReplayScheduler():
+rate_(1.0),
+paused_(false),
+nr_steps_(0),
+started_(false),
+last_timestamp_(0),
+device_time_us_(0),
+start_device_time_us_(0),
+start_time_(0, 0, RCL_SYSTEM_TIME),
+anchored_(false),
+anchor_device_time_us_(0)
+{
+
+}
+
+//---------------------------------------------------------------------//
+//- Private  methods                                                  -//
+//---------------------------------------------------------------------//
+
+bool SbgReplayScheduler::isDiscontinuous(uint32_t timestamp) const
+{
+  int32_t offset_us;
+
+  //
+  // A restart can move the time stamp back by more than half the counter range, which reads as a
+  // forward jump, so large jumps in both directions are discontinuities.
+  //
+  offset_us = static_cast<int32_t>(timestamp - last_timestamp_);
+
+  return started_ && ((offset_us < -SBG_REPLAY_SCHEDULER_MAX_BACKWARD_US) || (offset_us > SBG_REPLAY_SCHEDULER_MAX_FORWARD_US));
+}
+
+int64_t SbgReplayScheduler::unwrapTimestamp(uint32_t timestamp) const
+{
+  int64_t device_time_us;
+
+  if (isDiscontinuous(timestamp))
+  {
+    device_time_us = device_time_us_;
+  }
+  else if (started_)
+  {
+    //
+    // Logs are slightly out of order, the signed difference handles both older logs and the counter wrap.
+    //
+    device_time_us = device_time_us_ + static_cast<int32_t>(timestamp - last_timestamp_);
+  }
+  else
+  {
+    device_time_us = timestamp;
+  }
+
+  return device_time_us;
+}
+
+rclcpp::Time SbgReplayScheduler::toReplayTime(int64_t device_time_us) const
+{
+  return rclcpp::Time(start_time_.nanoseconds() + (device_time_us - start_device_time_us_) * 1000, RCL_SYSTEM_TIME);
+}
+
+//---------------------------------------------------------------------//
+//- Parameters                                                        -//
+//---------------------------------------------------------------------//
+
+void SbgReplayScheduler::setRate(double rate)
+{
+  rate_     = std::max(rate, 0.0);
+  anchored_ = false;
+}
+
+double SbgReplayScheduler::getRate() const
+{
+  return rate_;
+}
+
+void SbgReplayScheduler::setPaused(bool paused)
+{
+  if (paused_ && !paused)
+  {
+    nr_steps_ = 0;
+    anchored_ = false;
+  }
+
+  paused_ = paused;
+}
+
+bool SbgReplayScheduler::isPaused() const
+{
+  return paused_;
+}
+
+rclcpp::Time SbgReplayScheduler::getReplayTime() const
+{
+  if (started_)
+  {
+    return toReplayTime(device_time_us_);
+  }
+  else
+  {
+    return start_time_;
+  }
+}
+
+//---------------------------------------------------------------------//
+//- Operations                                                        -//
+//---------------------------------------------------------------------//
+
+void SbgReplayScheduler::step()
+{
+  if (paused_)
+  {
+    nr_steps_++;
+  }
+}
+
+std::chrono::nanoseconds SbgReplayScheduler::getDelay(uint32_t timestamp, std::chrono::steady_clock::time_point now)
+{
+  std::chrono::nanoseconds  delay;
+  int64_t                   device_time_us;
+
+  delay = std::chrono::nanoseconds::zero();
+
+  if (paused_ && (nr_steps_ == 0))
+  {
+    delay = std::chrono::nanoseconds::max();
+  }
+  else if ((timestamp != 0) && (rate_ > 0.0) && !paused_)
+  {
+    device_time_us = unwrapTimestamp(timestamp);
+
+    if (!anchored_)
+    {
+      anchored_               = true;
+      anchor_device_time_us_  = started_ ? device_time_us_ : device_time_us;
+      anchor_wall_time_       = now;
+    }
+
+    if (device_time_us > anchor_device_time_us_)
+    {
+      std::chrono::steady_clock::time_point deadline;
+
+      deadline  = anchor_wall_time_ + std::chrono::nanoseconds(static_cast<int64_t>((device_time_us - anchor_device_time_us_) * 1000 / rate_));
+      delay     = std::max(std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now), std::chrono::nanoseconds::zero());
+    }
+  }
+
+  return delay;
+}
+
+rclcpp::Time SbgReplayScheduler::consume(uint32_t timestamp)
+{
+  int64_t device_time_us;
+
+  if (paused_ && (nr_steps_ > 0))
+  {
+    nr_steps_--;
+  }
+
+  //
+  // GPS raw logs don't have a time stamp, they are stamped with the most recent device time.
+  //
+  if (timestamp != 0)
+  {
+    device_time_us = unwrapTimestamp(timestamp);
+
+    if (!started_)
+    {
+      started_              = true;
+      start_device_time_us_ = device_time_us;
+      start_time_           = rclcpp::Clock(RCL_SYSTEM_TIME).now();
+      device_time_us_       = device_time_us;
+      last_timestamp_       = timestamp;
+    }
+    else if (isDiscontinuous(timestamp))
+    {
+      //
+      // The device has been restarted while recording. Continue from the current device time so that
+      // the replay time remains monotonic, and schedule the next logs from this one.
+      //
+      last_timestamp_ = timestamp;
+      anchored_       = false;
+    }
+    else if (device_time_us > device_time_us_)
+    {
+      device_time_us_ = device_time_us;
+      last_timestamp_ = timestamp;
+    }
+
+    return toReplayTime(device_time_us);
+  }
+  else
+  {
+    return getReplayTime();
+  }
+}
@@ -79,6 +79,27 @@ bool sbg::helpers::isLeapYear(uint16_t year)
   return ((year % 4 == 0) && (year % 100 != 0)) || (year % 400 == 0);
 }
 
+uint32_t sbg::helpers::getNumberOfDaysSinceEpoch(uint16_t year, uint8_t month_index, uint8_t day)
+{
+  uint32_t  shifted_year;
+  uint32_t  era;
+  uint32_t  year_of_era;
+  uint32_t  day_of_year;
+  uint32_t  day_of_era;
+
+  //
+  // Closed form count, with years starting in March so that the leap day is the last day of the year.
+  // Eras are the 400 years Gregorian cycles, of 146097 days. The 1 Jan 1970 is the day 719468 since 1 Mar 0.
+  //
+  shifted_year  = (month_index <= 2) ? (year - 1u) : year;
+  era           = shifted_year / 400;
+  year_of_era   = shifted_year - era * 400;
+  day_of_year   = (153 * ((month_index > 2) ? (month_index - 3u) : (month_index + 9u)) + 2) / 5 + day - 1;
+  day_of_era    = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+
+  return era * 146097 + day_of_era - 719468;
+}
+
 int32_t sbg::helpers::getUtcOffset(bool first_valid_utc, uint32_t gps_tow, uint8_t sec)
 {
   constexpr int32_t   DEFAULT_UTC_OFFSET  = 18;   /*!< Driver default GPS to UTC offset in seconds. */
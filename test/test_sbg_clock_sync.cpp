@@ -0,0 +1,232 @@
+// Project headers
+#include <sbg_clock_sync.h>
+
+// STL headers
+#include <cmath>
+#include <random>
+
+// Google test headers
+#include <gtest/gtest.h>
+
+using sbg::SbgClockSync;
+
+namespace
+{
+/*!
+ * Offset of the host real time clock relative to its monotonic clock, in ns.
+ */
+constexpr int64_t kRealTimeOffsetNs = 1700000000000000000ll;
+
+/*!
+ * Simulated device sending a log every 10 ms, received after a random delay.
+ */
+class DeviceSimulator
+{
+private:
+
+  std::mt19937                              generator_;
+  std::exponential_distribution<double>     delay_distribution_;
+  uint32_t                                  timestamp_;
+  int64_t                                   device_time_us_;
+  int64_t                                   host_origin_ns_;
+  double                                    drift_ppm_;
+
+public:
+
+  /*!
+   * Constructor.
+   *
+   * \param[in] timestamp           First device time stamp, in us.
+   * \param[in] drift_ppm           Drift of the device clock, in ppm, positive if slower.
+   */
+  DeviceSimulator(uint32_t timestamp, double drift_ppm):
+  generator_(42),
+  delay_distribution_(1.0 / 200000.0),
+  timestamp_(timestamp),
+  device_time_us_(0),
+  host_origin_ns_(5000000000ll),
+  drift_ppm_(drift_ppm)
+  {
+
+  }
+
+  /*!
+   * Get the device time stamp of the current log.
+   *
+   * \return                        Device time stamp, in us.
+   */
+  uint32_t getTimestamp() const
+  {
+    return timestamp_;
+  }
+
+  /*!
+   * Get the host monotonic time at which the current log has been sent.
+   *
+   * \return                        Host monotonic time, in ns.
+   */
+  int64_t getSendTime() const
+  {
+    return host_origin_ns_ + static_cast<int64_t>(std::llround(device_time_us_ * 1000.0 * (1.0 + drift_ppm_ * 1e-6)));
+  }
+
+  /*!
+   * Get the host monotonic time at which the current log is received.
+   *
+   * \return                        Host monotonic time, in ns.
+   */
+  int64_t getArrivalTime()
+  {
+    return getSendTime() + 50000 + static_cast<int64_t>(delay_distribution_(generator_));
+  }
+
+  /*!
+   * Move to the next log.
+   *
+   * \param[in] period_us           Device time to the next log, in us.
+   */
+  void step(uint32_t period_us = 10000)
+  {
+    timestamp_      += period_us;
+    device_time_us_ += period_us;
+  }
+
+  /*!
+   * Feed logs to a synchronization.
+   *
+   * \param[in] ref_clock_sync      Synchronization to feed.
+   * \param[in] duration_us         Device time to simulate, in us.
+   * \return                        Number of restarts.
+   */
+  size_t run(SbgClockSync &ref_clock_sync, int64_t duration_us)
+  {
+    size_t nr_restarts = 0;
+
+    for (int64_t elapsed_us = 0; elapsed_us < duration_us; elapsed_us += 10000)
+    {
+      int64_t arrival_time_ns = getArrivalTime();
+
+      if (ref_clock_sync.update(timestamp_, arrival_time_ns, arrival_time_ns + kRealTimeOffsetNs))
+      {
+        nr_restarts++;
+      }
+
+      step();
+    }
+
+    return nr_restarts;
+  }
+};
+}
+
+TEST(SbgClockSync, ValidAfterFirstWindow)
+{
+  SbgClockSync    clock_sync;
+  DeviceSimulator device(1000000, 0.0);
+
+  EXPECT_FALSE(clock_sync.isValid());
+  EXPECT_EQ(device.run(clock_sync, 500000), 1u);
+  EXPECT_FALSE(clock_sync.isValid());
+  EXPECT_EQ(device.run(clock_sync, 1000000), 0u);
+  EXPECT_TRUE(clock_sync.isValid());
+}
+
+TEST(SbgClockSync, TracksDrift)
+{
+  SbgClockSync    clock_sync;
+  DeviceSimulator device(1000000, 80.0);
+
+  device.run(clock_sync, 30000000);
+
+  ASSERT_TRUE(clock_sync.isValid());
+  EXPECT_NEAR(clock_sync.getDrift(), 80.0, 5.0);
+
+  //
+  // Estimated times stay close to the send times, including a few logs ahead of the last one.
+  //
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    EXPECT_NEAR(static_cast<double>(clock_sync.toHostTime(device.getTimestamp()) - kRealTimeOffsetNs),
+                static_cast<double>(device.getSendTime()), 200000.0);
+    device.step();
+  }
+}
+
+TEST(SbgClockSync, HandlesCounterWrap)
+{
+  SbgClockSync    clock_sync;
+  DeviceSimulator device(0xFFFFFFFFu - 10000000u, 20.0);
+  int64_t         previous_time_ns;
+
+  EXPECT_EQ(device.run(clock_sync, 9000000), 1u);
+  ASSERT_TRUE(clock_sync.isValid());
+
+  //
+  // Host times keep increasing by one period across the wrap.
+  //
+  previous_time_ns = clock_sync.toHostTime(device.getTimestamp());
+
+  for (uint32_t i = 0; i < 300; i++)
+  {
+    int64_t arrival_time_ns;
+    int64_t time_ns;
+
+    arrival_time_ns = device.getArrivalTime();
+    EXPECT_FALSE(clock_sync.update(device.getTimestamp(), arrival_time_ns, arrival_time_ns + kRealTimeOffsetNs));
+    device.step();
+
+    time_ns = clock_sync.toHostTime(device.getTimestamp());
+    EXPECT_NEAR(static_cast<double>(time_ns - previous_time_ns), 10000000.0, 100000.0);
+    EXPECT_NEAR(static_cast<double>(time_ns - kRealTimeOffsetNs), static_cast<double>(device.getSendTime()), 200000.0);
+    previous_time_ns = time_ns;
+  }
+
+  EXPECT_LT(device.getTimestamp(), 10000000u);
+}
+
+TEST(SbgClockSync, RestartsOnTimestampJump)
+{
+  SbgClockSync    clock_sync;
+  DeviceSimulator device(1000000, 0.0);
+  int64_t         arrival_time_ns;
+
+  device.run(clock_sync, 5000000);
+  ASSERT_TRUE(clock_sync.isValid());
+
+  //
+  // A device reset moves the time stamp by more than half a second from the fit.
+  //
+  arrival_time_ns = device.getArrivalTime();
+  EXPECT_TRUE(clock_sync.update(device.getTimestamp() - 600000, arrival_time_ns, arrival_time_ns + kRealTimeOffsetNs));
+  EXPECT_FALSE(clock_sync.isValid());
+}
+
+TEST(SbgClockSync, RestartsOnArrivalJump)
+{
+  SbgClockSync    clock_sync;
+  DeviceSimulator device(1000000, 0.0);
+  int64_t         arrival_time_ns;
+
+  device.run(clock_sync, 5000000);
+  ASSERT_TRUE(clock_sync.isValid());
+
+  arrival_time_ns = device.getArrivalTime() + 600000000ll;
+  EXPECT_TRUE(clock_sync.update(device.getTimestamp(), arrival_time_ns, arrival_time_ns + kRealTimeOffsetNs));
+  EXPECT_FALSE(clock_sync.isValid());
+}
+
+TEST(SbgClockSync, ClampsDrift)
+{
+  SbgClockSync    slow_clock_sync;
+  SbgClockSync    fast_clock_sync;
+  DeviceSimulator slow_device(1000000, 2000.0);
+  DeviceSimulator fast_device(1000000, -2000.0);
+
+  EXPECT_EQ(slow_device.run(slow_clock_sync, 30000000), 1u);
+  EXPECT_EQ(fast_device.run(fast_clock_sync, 30000000), 1u);
+
+  ASSERT_TRUE(slow_clock_sync.isValid());
+  ASSERT_TRUE(fast_clock_sync.isValid());
+  EXPECT_NEAR(slow_clock_sync.getDrift(), 500.0, 1e-6);
+  EXPECT_NEAR(fast_clock_sync.getDrift(), -500.0, 1e-6);
+}
@@ -0,0 +1,345 @@
+// SbgECom headers
+#include <sbgEComLib.h>
+
+// STL headers
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Google test headers
+#include <gtest/gtest.h>
+
+namespace
+{
+/*!
+ * Number of messages configured by each batch.
+ */
+constexpr size_t kNrEntries = 40;
+
+/*!
+ * Simulated device answering output configuration commands over a lossy link.
+ *
+ * Requests and answers are each lost with a given probability, answers are received after a short delay.
+ * Messages whose ID is a multiple of three aren't supported, and are answered by a NACK.
+ */
+class LossyDevice
+{
+private:
+
+  /*!
+   * Answer frame in flight.
+   */
+  struct Answer
+  {
+    std::chrono::steady_clock::time_point   delivery_time;            /*!< Time at which the frame is received. */
+    std::vector<uint8_t>                    frame;                    /*!< Frame bytes. */
+  };
+
+  std::mt19937                              generator_;
+  std::bernoulli_distribution               request_loss_;
+  std::bernoulli_distribution               answer_loss_;
+  std::map<uint8_t, uint16_t>               modes_;
+  std::deque<Answer>                        answers_;
+  std::vector<uint8_t>                      rx_bytes_;
+
+  /*!
+   * Queue an answer frame, unless it's lost.
+   *
+   * \param[in] msg_id              Message ID.
+   * \param[in] msg_class           Message class.
+   * \param[in] ref_payload         Payload.
+   */
+  void queueAnswer(uint8_t msg_id, uint8_t msg_class, const std::vector<uint8_t> &ref_payload)
+  {
+    std::vector<uint8_t>  frame;
+    uint16_t              crc;
+
+    if (answer_loss_(generator_))
+    {
+      return;
+    }
+
+    frame = { SBG_ECOM_SYNC_1, SBG_ECOM_SYNC_2, msg_id, msg_class, static_cast<uint8_t>(ref_payload.size()), static_cast<uint8_t>(ref_payload.size() >> 8) };
+    frame.insert(frame.end(), ref_payload.begin(), ref_payload.end());
+
+    crc = sbgCrc16Compute(&frame[2], frame.size() - 2);
+
+    frame.push_back(static_cast<uint8_t>(crc));
+    frame.push_back(static_cast<uint8_t>(crc >> 8));
+    frame.push_back(SBG_ECOM_ETX);
+
+    answers_.push_back({ std::chrono::steady_clock::now() + std::chrono::milliseconds(1), frame });
+  }
+
+  /*!
+   * Queue an ACK frame.
+   *
+   * \param[in] error_code          Command result.
+   */
+  void queueAck(SbgErrorCode error_code)
+  {
+    queueAnswer(SBG_ECOM_CMD_ACK, SBG_ECOM_CLASS_LOG_CMD_0, { SBG_ECOM_CMD_OUTPUT_CONF, SBG_ECOM_CLASS_LOG_CMD_0, static_cast<uint8_t>(error_code), static_cast<uint8_t>(error_code >> 8) });
+  }
+
+  /*!
+   * Execute an output configuration command.
+   *
+   * \param[in] p_payload           Command payload.
+   * \param[in] size                Command payload size, in bytes.
+   */
+  void processOutputConf(const uint8_t *p_payload, size_t size)
+  {
+    auto it = modes_.find(p_payload[1]);
+
+    if (it == modes_.end())
+    {
+      queueAck(SBG_INVALID_PARAMETER);
+    }
+    else if (size == 5)
+    {
+      it->second = static_cast<uint16_t>(p_payload[3] | (p_payload[4] << 8));
+      queueAck(SBG_NO_ERROR);
+    }
+    else
+    {
+      queueAnswer(SBG_ECOM_CMD_OUTPUT_CONF, SBG_ECOM_CLASS_LOG_CMD_0, { p_payload[0], p_payload[1], p_payload[2], static_cast<uint8_t>(it->second), static_cast<uint8_t>(it->second >> 8) });
+    }
+  }
+
+  /*!
+   * Move the answers received by now to the received bytes.
+   */
+  void deliverAnswers()
+  {
+    auto now = std::chrono::steady_clock::now();
+
+    while (!answers_.empty() && (answers_.front().delivery_time <= now))
+    {
+      rx_bytes_.insert(rx_bytes_.end(), answers_.front().frame.begin(), answers_.front().frame.end());
+      answers_.pop_front();
+    }
+  }
+
+  static SbgErrorCode onWrite(SbgInterface *p_interface, const void *p_buffer, size_t bytes_to_write)
+  {
+    LossyDevice   *p_device = static_cast<LossyDevice *>(p_interface->handle);
+    const uint8_t *p_frame  = static_cast<const uint8_t *>(p_buffer);
+
+    //
+    // Each write holds a whole standard frame.
+    //
+    if ((bytes_to_write >= 9) && !p_device->request_loss_(p_device->generator_) &&
+        (p_frame[3] == SBG_ECOM_CLASS_LOG_CMD_0) && (p_frame[2] == SBG_ECOM_CMD_OUTPUT_CONF))
+    {
+      p_device->processOutputConf(&p_frame[6], static_cast<size_t>(p_frame[4] | (p_frame[5] << 8)));
+    }
+
+    return SBG_NO_ERROR;
+  }
+
+  static SbgErrorCode onRead(SbgInterface *p_interface, void *p_buffer, size_t *p_read_bytes, size_t bytes_to_read)
+  {
+    LossyDevice *p_device = static_cast<LossyDevice *>(p_interface->handle);
+    size_t       size;
+
+    p_device->deliverAnswers();
+
+    size = std::min(bytes_to_read, p_device->rx_bytes_.size());
+
+    memcpy(p_buffer, p_device->rx_bytes_.data(), size);
+    p_device->rx_bytes_.erase(p_device->rx_bytes_.begin(), p_device->rx_bytes_.begin() + size);
+
+    *p_read_bytes = size;
+
+    return SBG_NO_ERROR;
+  }
+
+  static SbgErrorCode onWaitReadable(SbgInterface *p_interface, uint32_t time_out)
+  {
+    LossyDevice *p_device = static_cast<LossyDevice *>(p_interface->handle);
+    auto         deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(time_out);
+
+    for (;;)
+    {
+      p_device->deliverAnswers();
+
+      if (!p_device->rx_bytes_.empty())
+      {
+        return SBG_NO_ERROR;
+      }
+      else if (std::chrono::steady_clock::now() >= deadline)
+      {
+        return SBG_TIME_OUT;
+      }
+
+      std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+  }
+
+public:
+
+  /*!
+   * Constructor.
+   *
+   * \param[in] seed                Random generator seed.
+   * \param[in] request_loss        Probability of losing a request.
+   * \param[in] answer_loss         Probability of losing an answer.
+   */
+  LossyDevice(uint32_t seed, double request_loss, double answer_loss):
+  generator_(seed),
+  request_loss_(request_loss),
+  answer_loss_(answer_loss)
+  {
+    for (uint8_t msg_id = 1; msg_id <= kNrEntries; msg_id++)
+    {
+      if ((msg_id % 3) != 0)
+      {
+        modes_[msg_id] = SBG_ECOM_OUTPUT_MODE_DISABLED;
+      }
+    }
+  }
+
+  /*!
+   * Check if a message is supported.
+   *
+   * \param[in] msg_id              Message ID.
+   * \return                        True if the message is supported.
+   */
+  bool isSupported(uint8_t msg_id) const
+  {
+    return modes_.count(msg_id) != 0;
+  }
+
+  /*!
+   * Get the output mode of a supported message.
+   *
+   * \param[in] msg_id              Message ID.
+   * \return                        Output mode.
+   */
+  uint16_t getMode(uint8_t msg_id) const
+  {
+    return modes_.at(msg_id);
+  }
+
+  /*!
+   * Initialize an interface connected to the device.
+   *
+   * \param[out] p_interface        Interface.
+   */
+  void initInterface(SbgInterface *p_interface)
+  {
+    sbgInterfaceZeroInit(p_interface);
+
+    p_interface->handle             = this;
+    p_interface->pWriteFunc         = onWrite;
+    p_interface->pReadFunc          = onRead;
+    p_interface->pWaitReadableFunc  = onWaitReadable;
+  }
+};
+
+/*!
+ * Get the output mode set for a message.
+ *
+ * \param[in] msg_id                Message ID.
+ * \return                          Output mode.
+ */
+SbgEComOutputMode getTestMode(uint8_t msg_id)
+{
+  return (msg_id % 2) ? SBG_ECOM_OUTPUT_MODE_DIV_8 : SBG_ECOM_OUTPUT_MODE_MAIN_LOOP;
+}
+
+/*!
+ * Set, then get, the output modes of all the messages with pipelined commands, and check each result.
+ *
+ * \param[in] seed                  Random generator seed.
+ * \param[in] request_loss          Probability of losing a request.
+ * \param[in] answer_loss           Probability of losing an answer.
+ */
+void checkBatches(uint32_t seed, double request_loss, double answer_loss)
+{
+  LossyDevice             device(seed, request_loss, answer_loss);
+  SbgInterface            interface;
+  SbgEComHandle           handle;
+  SbgEComOutputConfEntry  entries[kNrEntries];
+
+  device.initInterface(&interface);
+  ASSERT_EQ(sbgEComInit(&handle, &interface), SBG_NO_ERROR);
+
+  //
+  // Enough trials for every command to get through, so that any wrong result is a matching error.
+  //
+  sbgEComSetCmdTrialsAndTimeOut(&handle, 10, 20);
+
+  for (uint8_t i = 0; i < kNrEntries; i++)
+  {
+    entries[i].classId  = SBG_ECOM_CLASS_LOG_ECOM_0;
+    entries[i].msgId    = static_cast<uint8_t>(i + 1);
+    entries[i].mode     = getTestMode(entries[i].msgId);
+  }
+
+  sbgEComCmdOutputSetConfs(&handle, SBG_ECOM_OUTPUT_PORT_A, entries, kNrEntries);
+
+  for (uint8_t i = 0; i < kNrEntries; i++)
+  {
+    uint8_t msg_id = entries[i].msgId;
+
+    if (device.isSupported(msg_id))
+    {
+      EXPECT_EQ(entries[i].errorCode, SBG_NO_ERROR) << "set, message " << static_cast<int>(msg_id);
+      EXPECT_EQ(device.getMode(msg_id), getTestMode(msg_id)) << "set, message " << static_cast<int>(msg_id);
+    }
+    else
+    {
+      EXPECT_EQ(entries[i].errorCode, SBG_INVALID_PARAMETER) << "set, message " << static_cast<int>(msg_id);
+    }
+
+    entries[i].mode = SBG_ECOM_OUTPUT_MODE_DISABLED;
+  }
+
+  sbgEComCmdOutputGetConfs(&handle, SBG_ECOM_OUTPUT_PORT_A, entries, kNrEntries);
+
+  for (uint8_t i = 0; i < kNrEntries; i++)
+  {
+    uint8_t msg_id = entries[i].msgId;
+
+    if (device.isSupported(msg_id))
+    {
+      EXPECT_EQ(entries[i].errorCode, SBG_NO_ERROR) << "get, message " << static_cast<int>(msg_id);
+      EXPECT_EQ(entries[i].mode, getTestMode(msg_id)) << "get, message " << static_cast<int>(msg_id);
+    }
+    else
+    {
+      EXPECT_EQ(entries[i].errorCode, SBG_INVALID_PARAMETER) << "get, message " << static_cast<int>(msg_id);
+    }
+  }
+
+  sbgEComClose(&handle);
+}
+}
+
+TEST(SbgEComCmdPipeline, LosslessLink)
+{
+  checkBatches(1, 0.0, 0.0);
+}
+
+TEST(SbgEComCmdPipeline, LostRequests)
+{
+  for (uint32_t seed = 1; seed <= 5; seed++)
+  {
+    SCOPED_TRACE(seed);
+    checkBatches(seed, 0.1, 0.0);
+  }
+}
+
+TEST(SbgEComCmdPipeline, LostAnswers)
+{
+  for (uint32_t seed = 1; seed <= 5; seed++)
+  {
+    SCOPED_TRACE(seed);
+    checkBatches(seed, 0.0, 0.1);
+  }
+}
@@ -0,0 +1,131 @@
+// Project headers
+#include <sbg_spsc_ring.h>
+
+// STL headers
+#include <atomic>
+#include <thread>
+
+// Google test headers
+#include <gtest/gtest.h>
+
+using sbg::SbgSpscRing;
+
+TEST(SbgSpscRing, PopsInPushOrder)
+{
+  SbgSpscRing<uint32_t> ring(4);
+  uint32_t              entry;
+
+  EXPECT_TRUE(ring.isEmpty());
+  EXPECT_FALSE(ring.pop(entry));
+
+  for (uint32_t i = 0; i < 3; i++)
+  {
+    EXPECT_TRUE(ring.push(i));
+  }
+
+  EXPECT_FALSE(ring.isEmpty());
+
+  for (uint32_t i = 0; i < 3; i++)
+  {
+    ASSERT_TRUE(ring.pop(entry));
+    EXPECT_EQ(entry, i);
+  }
+
+  EXPECT_TRUE(ring.isEmpty());
+  EXPECT_EQ(ring.getDropCount(), 0u);
+}
+
+TEST(SbgSpscRing, WrapsAroundCapacity)
+{
+  SbgSpscRing<uint32_t> ring(3);
+  uint32_t              entry;
+
+  //
+  // Interleave pushes and pops so that the indexes wrap several times.
+  //
+  for (uint32_t i = 0; i < 100; i++)
+  {
+    ASSERT_TRUE(ring.push(2 * i));
+    ASSERT_TRUE(ring.push(2 * i + 1));
+
+    ASSERT_TRUE(ring.pop(entry));
+    EXPECT_EQ(entry, 2 * i);
+    ASSERT_TRUE(ring.pop(entry));
+    EXPECT_EQ(entry, 2 * i + 1);
+  }
+
+  EXPECT_TRUE(ring.isEmpty());
+  EXPECT_EQ(ring.getDropCount(), 0u);
+}
+
+TEST(SbgSpscRing, DropsOldestWhenFull)
+{
+  SbgSpscRing<uint32_t> ring(4);
+  uint32_t              entry;
+
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    EXPECT_TRUE(ring.push(i));
+  }
+
+  EXPECT_EQ(ring.getDropCount(), 6u);
+
+  for (uint32_t i = 6; i < 10; i++)
+  {
+    ASSERT_TRUE(ring.pop(entry));
+    EXPECT_EQ(entry, i);
+  }
+
+  EXPECT_FALSE(ring.pop(entry));
+}
+
+TEST(SbgSpscRing, ConcurrentProducerAndConsumer)
+{
+  const uint32_t        nr_entries = 200000;
+  SbgSpscRing<uint32_t> ring(64);
+  std::atomic<bool>     producer_done(false);
+  std::thread           producer;
+  uint32_t              nr_popped;
+  uint32_t              last_entry;
+  bool                  in_order;
+
+  producer = std::thread([&ring, &producer_done, nr_entries]()
+  {
+    for (uint32_t i = 1; i <= nr_entries; i++)
+    {
+      ring.push(i);
+    }
+
+    producer_done.store(true, std::memory_order_release);
+  });
+
+  nr_popped   = 0;
+  last_entry  = 0;
+  in_order    = true;
+
+  //
+  // Entries may be dropped, but those received are never duplicated nor reordered.
+  //
+  for (;;)
+  {
+    bool      done = producer_done.load(std::memory_order_acquire);
+    uint32_t  entry;
+
+    if (ring.pop(entry))
+    {
+      in_order    = in_order && (entry > last_entry);
+      last_entry  = entry;
+      nr_popped++;
+    }
+    else if (done)
+    {
+      break;
+    }
+  }
+
+  producer.join();
+
+  EXPECT_TRUE(in_order);
+  EXPECT_TRUE(ring.isEmpty());
+  EXPECT_EQ(nr_popped + ring.getDropCount(), nr_entries);
+}